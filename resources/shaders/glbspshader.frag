@@ -21,23 +21,19 @@ struct Sunlight {
     vec3 specular;
 };
 
+// must match ShaderPointLight in ShaderLights.h, std140 layout
 struct PointLight {
-
-    float type;  // 0- off, 1- stat, 2 - mob
-
     vec3 position;
-    float sector;
-
-    //float constant;
-    //float linear;
-    //float quadratic;
-
+    float type;  // 0- off, 1- stat, 2 - mob
 
+    vec3 ambient;
     float radius;
 
-    vec3 ambient;
     vec3 diffuse;
+    float sector;
+
     vec3 specular;
+    float unused;
 };
 
 uniform int waterframe;
@@ -48,8 +44,11 @@ uniform int flowtimerms; // TODO(Nik-RE-dev): use a single timer for everything
 uniform int watertiles;
 uniform float gamma;
 
+#define MAX_POINT_LIGHTS 40
+layout(std140) uniform PointLights {
+    PointLight fspointlights[MAX_POINT_LIGHTS];
+};
 #define num_point_lights 40
-uniform PointLight fspointlights[num_point_lights];
 
 uniform sampler2DArray textureArray0;
 
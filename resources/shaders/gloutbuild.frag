@@ -21,16 +21,19 @@ struct Sunlight {
     vec3 specular;
 };
 
+// must match ShaderPointLight in ShaderLights.h, std140 layout
 struct PointLight {
-
+    vec3 position;
     float type;  // 0- off, 1- stat, 2 - mob
 
-    vec3 position;
+    vec3 ambient;
     float radius;
 
-    vec3 ambient;
     vec3 diffuse;
+    float sector;
+
     vec3 specular;
+    float unused;
 };
 
 struct FogParam {
@@ -48,8 +51,11 @@ uniform int flowtimerms; // TODO(Nik-RE-dev): use a single timer for everything
 uniform int watertiles;
 uniform float gamma;
 
+#define MAX_POINT_LIGHTS 40
+layout(std140) uniform PointLights {
+    PointLight fspointlights[MAX_POINT_LIGHTS];
+};
 #define num_point_lights 20
-uniform PointLight fspointlights[num_point_lights];
 
 uniform sampler2DArray textureArray0;
 uniform FogParam fog;
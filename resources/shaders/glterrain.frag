@@ -20,22 +20,19 @@ struct Sunlight {
     vec3 specular;
 };
 
+// must match ShaderPointLight in ShaderLights.h, std140 layout
 struct PointLight {
-
-    float type;  // 0- off, 1- stat, 2 - mob
-
     vec3 position;
+    float type;  // 0- off, 1- stat, 2 - mob
 
-    // dont use these atm
-    //float constant;
-    //float linear;
-    //float quadratic;
-
+    vec3 ambient;
     float radius;
 
-    vec3 ambient;
     vec3 diffuse;
+    float sector;
+
     vec3 specular;
+    float unused;
 };
 
 struct FogParam {
@@ -50,8 +47,11 @@ uniform Sunlight sun;
 uniform vec3 CameraPos;
 uniform float gamma;
 
+#define MAX_POINT_LIGHTS 40
+layout(std140) uniform PointLights {
+    PointLight fspointlights[MAX_POINT_LIGHTS];
+};
 #define num_point_lights 20
-uniform PointLight fspointlights[num_point_lights];
 
 uniform sampler2DArray textureArray0;
 uniform sampler2DArray textureArray1;
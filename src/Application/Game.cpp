@@ -10,6 +10,7 @@
 #include "Engine/AssetsManager.h"
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
+#include "Engine/EngineProfiler.h"
 #include "Engine/Data/AwardEnums.h"
 #include "Engine/Data/HouseEnumFunctions.h"
 #include "Engine/Events/Processor.h"
@@ -277,6 +278,8 @@ bool IsWindowSwitchable() {
 }
 
 void Game::processQueuedMessages() {
+    EngineProfilerScope profilerScope(engine->profiler, ENGINE_PHASE_EVENTS);
+
     GUIWindow *pWindow2;        // ecx@248
     int v37;                    // eax@341
     ODMFace *pODMFace;          // ecx@412
@@ -4,6 +4,7 @@
 #include <vector>
 #include <tuple>
 #include <string>
+#include <utility>
 
 #include "Arcomage/Arcomage.h"
 
@@ -29,7 +30,6 @@
 #include "Media/Audio/AudioPlayer.h"
 #include "Media/MediaPlayer.h"
 
-#include "Library/Image/PCX.h"
 #include "Library/Logger/Logger.h"
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Platform/Interface/PlatformGamepad.h"
@@ -158,7 +158,14 @@ void GameWindowHandler::OnScreenshot() {
         engine->config->settings.ScreenshotNumber.increment();
         std::string path = fmt::format("screenshot_{:05}.pcx", engine->config->settings.ScreenshotNumber.value());
 
-        ufs->write(path, pcx::encode(render->MakeFullScreenshot()));
+        // Encoding & writing happen on a later frame, so that taking a screenshot doesn't stall the game.
+        ScreenCaptureRequest request;
+        request.encodePcx = true;
+        request.callback = [path] (ScreenCaptureResult result) {
+            if (result.pcx)
+                ufs->write(path, result.pcx);
+        };
+        render->captureScreenAsync(std::move(request));
     }
 }
 
@@ -26,6 +26,7 @@
 #include "Engine/Components/Control/EngineControlComponent.h"
 #include "Engine/Components/Control/EngineController.h"
 #include "Engine/Components/Deterministic/EngineDeterministicComponent.h"
+#include "Engine/Components/Profiling/EngineProfilingComponent.h"
 #include "Engine/Components/Random/EngineRandomComponent.h"
 
 #include "GUI/Overlay/OverlaySystem.h"
@@ -139,6 +140,7 @@ void GameStarter::initWithLogger() {
     _application->installComponent(std::make_unique<EngineTracePlayer>());
     _application->installComponent(std::make_unique<GameTraceHandler>());
     _application->installComponent(std::make_unique<EngineRandomComponent>());
+    _application->installComponent(std::make_unique<EngineProfilingComponent>());
     _application->component<EngineRandomComponent>()->setTracing(_options.tracingRng);
 
     // Init main window. Should happen before the renderer init, which depends on window dimensions & mode.
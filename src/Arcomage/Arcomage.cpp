@@ -18,9 +18,10 @@
 #include "Media/Audio/AudioPlayer.h"
 #include "Media/MediaPlayer.h"
 
-
 #include "Utility/IndexedArray.h"
 
+#include "ArcomageRules.h"
+
 void SetStartConditions();
 void SetStartGameData();
 void FillPlayerDeck();
@@ -29,9 +30,6 @@ void GetNextCardFromDeck(int player_num);
 int GetEmptyCardSlotIndex(int player_num);
 void IncreaseResourcesInTurn(int player_num);
 void TurnChange();
-bool IsGameOver();
-int CalculateCardPower(ArcomagePlayer *player, ArcomagePlayer *enemy,
-                       ArcomageCard *pCard, int mastery);
 char PlayerTurn(int player_num);
 void DrawGameUI(int animation_stage);
 void DrawSparks();
@@ -52,7 +50,6 @@ bool PlayCard(int player_num, int card_slot_num);
 bool CanCardBePlayed(int player_num, int hand_card_indx);
 void ApplyCardToPlayer(int player_num, int uCardID);
 int new_explosion_effect(Pointi *startXY, int effect_value);
-int ApplyDamageToBuildings(int player_num, int damage);
 void GameResultsApply();
 
 void am_DrawText(std::string_view str, Pointi *pXY);
@@ -103,13 +100,6 @@ ArcomageDeck deckMaster;
 char Player2Name[] = "Enemy";
 char Player1Name[] = "Player";
 
-struct am_ai_cardpowerstruct {
-    int slot_index;
-    int card_power;
-};
-
-am_ai_cardpowerstruct cards_power[10];
-
 bool Player_Gets_First_Turn = true;  // who starts the game
 bool Player_Cards_Shift = true;  // shifts the cards round at the bottom of the screen so they arent all level
 char use_start_bonus = 1;
@@ -567,312 +557,19 @@ bool ArcomageGame::LoadSprites() {
     return true;
 }
 
-int CalculateCardPower(ArcomagePlayer *player, ArcomagePlayer *enemy,
-                       ArcomageCard *pCard, int mastery) {
-    enum class V_IND {
-        P_TOWER_M10,
-        P_WALL_M10,
-        E_TOWER,
-        E_WALL,
-        E_BUILDINGS,
-        E_QUARRY,
-        E_MAGIC,
-        E_ZOO,
-        E_RES
-    };
-    using enum V_IND;
-
-    // mastery coeffs
-    // base mastery focus on growing walls + tower
-    // second level high priority on resource gen
-    static constexpr IndexedArray<std::array<int, 2>, P_TOWER_M10, E_RES> mastery_coeff = {
-        {P_TOWER_M10,   {{10, 5}}},
-        {P_WALL_M10,    {{2, 1}}},
-        {E_TOWER,       {{1, 10}}},
-        {E_WALL,        {{1, 3}}},
-        {E_BUILDINGS,   {{1, 7}}},
-        {E_QUARRY,      {{1, 5}}},
-        {E_MAGIC,       {{1, 40}}},
-        {E_ZOO,         {{1, 40}}},
-        {E_RES,         {{1, 2}}}
-    };
-
-    int card_power = 0;
-    int element_power = 0;
-
-    if (pCard->to_player_tower == 99 || pCard->to_pl_enm_tower == 99 ||
-        pCard->to_player_tower2 == 99 || pCard->to_pl_enm_tower2 == 99) {
-        element_power = enemy->tower_height - player->tower_height;
-    } else {
-        element_power = pCard->to_player_tower + pCard->to_pl_enm_tower +
-                        pCard->to_player_tower2 + pCard->to_pl_enm_tower2;
-    }
-
-    if (player->tower_height >= 10) {
-        card_power += mastery_coeff[P_TOWER_M10][mastery] * element_power;
-    } else {
-        card_power += 20 * element_power;
-    }
-
-    if (pCard->to_player_wall == 99 || pCard->to_pl_enm_wall == 99 ||
-        pCard->to_player_wall2 == 99 || pCard->to_pl_enm_wall2 == 99) {
-        element_power = enemy->wall_height - player->wall_height;
-    } else {
-        element_power = pCard->to_player_wall + pCard->to_pl_enm_wall +
-                        pCard->to_player_wall2 + pCard->to_pl_enm_wall2;
-    }
-
-    if (player->wall_height >= 10) {
-        card_power += mastery_coeff[P_WALL_M10][mastery] * element_power;  // 1
-    } else {
-        card_power += 5 * element_power;
-    }
-
-    card_power +=
-        7 * (pCard->to_player_buildings + pCard->to_pl_enm_buildings +
-             pCard->to_player_buildings2 + pCard->to_pl_enm_buildings2);
-
-    if (pCard->to_player_quarry_lvl == 99 ||
-        pCard->to_pl_enm_quarry_lvl == 99 ||
-        pCard->to_player_quarry_lvl2 == 99 ||
-        pCard->to_pl_enm_quarry_lvl2 == 99) {
-        element_power = enemy->quarry_level - player->quarry_level;
-    } else {
-        element_power =
-            pCard->to_player_quarry_lvl + pCard->to_pl_enm_quarry_lvl +
-            pCard->to_player_quarry_lvl2 + pCard->to_pl_enm_quarry_lvl;
-    }
-
-    card_power += 40 * element_power;
-
-    if (pCard->to_player_magic_lvl == 99 || pCard->to_pl_enm_magic_lvl == 99 ||
-        pCard->to_player_magic_lvl2 == 99 ||
-        pCard->to_pl_enm_magic_lvl2 == 99) {
-        element_power = enemy->magic_level - player->magic_level;
-    } else {
-        element_power =
-            pCard->to_player_magic_lvl + pCard->to_pl_enm_magic_lvl +
-            pCard->to_player_magic_lvl2 + pCard->to_pl_enm_magic_lvl2;
-    }
-    card_power += 40 * element_power;
-
-    if (pCard->to_player_zoo_lvl == 99 || pCard->to_pl_enm_zoo_lvl == 99 ||
-        pCard->to_player_zoo_lvl2 == 99 || pCard->to_pl_enm_zoo_lvl2 == 99) {
-        element_power = enemy->zoo_level - player->zoo_level;
-    } else {
-        element_power = pCard->to_player_zoo_lvl + pCard->to_pl_enm_zoo_lvl +
-                        pCard->to_player_zoo_lvl2 + pCard->to_pl_enm_zoo_lvl2;
-    }
-    card_power += 40 * element_power;
-
-    if (pCard->to_player_bricks == 99 || pCard->to_pl_enm_bricks == 99 ||
-        pCard->to_player_bricks2 == 99 || pCard->to_pl_enm_bricks2 == 99) {
-        element_power = enemy->resource_bricks - player->resource_bricks;
-    } else {
-        element_power = pCard->to_player_bricks + pCard->to_pl_enm_bricks +
-                        pCard->to_player_bricks2 + pCard->to_pl_enm_bricks2;
-    }
-    card_power += 2 * element_power;
-
-    if (pCard->to_player_gems == 99 || pCard->to_pl_enm_gems == 99 ||
-        pCard->to_player_gems2 == 99 || pCard->to_pl_enm_gems2 == 99) {
-        element_power = enemy->resource_gems - player->resource_gems;
-    } else {
-        element_power = pCard->to_player_gems + pCard->to_pl_enm_gems +
-                        pCard->to_player_gems2 + pCard->to_pl_enm_gems2;
-    }
-    card_power += 2 * element_power;
-
-    if (pCard->to_player_beasts == 99 || pCard->to_pl_enm_beasts == 99 ||
-        pCard->to_player_beasts2 == 99 || pCard->to_pl_enm_beasts2 == 99) {
-        element_power = enemy->resource_beasts - player->resource_beasts;
-    } else {
-        element_power = pCard->to_player_beasts + pCard->to_pl_enm_beasts +
-                        pCard->to_player_beasts2 + pCard->to_pl_enm_beasts2;
-    }
-    card_power += 2 * element_power;
-
-    if (pCard->to_enemy_tower == 99 || pCard->to_enemy_tower2 == 99) {
-        element_power = player->tower_height - enemy->tower_height;
-    } else {
-        element_power = -(pCard->to_enemy_tower + pCard->to_enemy_tower2);
-    }
-    card_power += mastery_coeff[E_TOWER][mastery] * element_power;
-
-    if (pCard->to_enemy_wall == 99 || pCard->to_enemy_wall2 == 99) {
-        element_power = player->wall_height - enemy->wall_height;
-    } else {
-        element_power = -(pCard->to_enemy_wall + pCard->to_enemy_wall2);
-    }
-    card_power += mastery_coeff[E_WALL][mastery] * element_power;
-
-    card_power -= mastery_coeff[E_BUILDINGS][mastery] *
-                  (pCard->to_enemy_buildings + pCard->to_enemy_buildings2);
-
-    if (pCard->to_enemy_quarry_lvl == 99 || pCard->to_enemy_quarry_lvl2 == 99) {
-        element_power = player->quarry_level - enemy->quarry_level;  // 5
-    } else {
-        element_power =
-            -(pCard->to_enemy_quarry_lvl + pCard->to_enemy_quarry_lvl2);  // 5
-    }
-    card_power += mastery_coeff[E_QUARRY][mastery] * element_power;
-
-    if (pCard->to_enemy_magic_lvl == 99 || pCard->to_enemy_magic_lvl2 == 99) {
-        element_power = player->magic_level - enemy->magic_level;  // 40
-    } else {
-        element_power =
-            -(pCard->to_enemy_magic_lvl + pCard->to_enemy_magic_lvl2);
-    }
-    card_power += mastery_coeff[E_MAGIC][mastery] * element_power;
-
-    if (pCard->to_enemy_zoo_lvl == 99 || pCard->to_enemy_zoo_lvl2 == 99) {
-        element_power = player->zoo_level - enemy->zoo_level;  // 40
-    } else {
-        element_power = -(pCard->to_enemy_zoo_lvl + pCard->to_enemy_zoo_lvl2);
-    }
-    card_power += mastery_coeff[E_ZOO][mastery] * element_power;
-
-    if (pCard->to_enemy_bricks == 99 || pCard->to_enemy_bricks2 == 99) {
-        element_power = player->resource_bricks - enemy->resource_bricks;  // 2
-    } else {
-        element_power = -(pCard->to_enemy_bricks + pCard->to_enemy_bricks2);
-    }
-    card_power += mastery_coeff[E_RES][mastery] * element_power;
-
-    if (pCard->to_enemy_gems == 99 || pCard->to_enemy_gems2 == 99) {
-        element_power = player->resource_gems - enemy->resource_gems;  // 2
-    } else {
-        element_power = -(pCard->to_enemy_gems + pCard->to_enemy_gems2);
-    }
-    card_power += mastery_coeff[E_RES][mastery] * element_power;
-
-    if (pCard->to_enemy_beasts == 99 || pCard->to_enemy_beasts2 == 99) {
-        element_power = player->resource_beasts - enemy->resource_beasts;  // 2
-    } else {
-        element_power = -(pCard->to_enemy_beasts + pCard->to_enemy_beasts2);
-    }
-    card_power += mastery_coeff[E_RES][mastery] * element_power;
-
-    if (pCard->field_30 || pCard->field_4D) {
-        card_power *= 10;
-    }
-
-    if (pCard->card_resource_type == 1) {
-        element_power = player->resource_bricks - pCard->needed_bricks;
-    } else if (pCard->card_resource_type == 2) {
-        element_power = player->resource_gems - pCard->needed_gems;
-    } else if (pCard->card_resource_type == 3) {
-        element_power = player->resource_beasts - pCard->needed_beasts;
-    }
-    if (element_power > 3) {
-        element_power = 3;
-    }
-    card_power += 5 * element_power;
-
-    if (enemy->tower_height <= pCard->to_enemy_tower2 + pCard->to_enemy_tower) {
-        card_power += 9999;
-    }
-
-    if (pCard->to_enemy_tower2 + pCard->to_enemy_tower + pCard->to_enemy_wall +
-            pCard->to_enemy_wall2 + pCard->to_enemy_buildings +
-            pCard->to_enemy_buildings2 >=
-        enemy->wall_height + enemy->tower_height) {
-        card_power += 9999;
-    }
-
-    if ((pCard->to_player_tower2 + pCard->to_pl_enm_tower2 +
-         pCard->to_player_tower + pCard->to_pl_enm_tower +
-         player->tower_height) >= max_tower_height) {
-        card_power += 9999;
-    }
-
-    return card_power;
-}
-
 bool OpponentsAITurn(int player_num) {
     assert(player_num != 0);
 
-    int ai_player_cards_count = GetPlayerHandCardCount(player_num);
-    if (ai_player_cards_count == 0) return true;
+    if (GetPlayerHandCardCount(player_num) == 0) return true;
 
     // opponent_mastery = 2; // testing
 
     opponents_turn = 1;
-    if (opponent_mastery == 0) {
-        // select card at random to play
-        int random_card_slot;
-        if (need_to_discard_card == 0) {
-            for (int i = 0; i < 10; ++i) {
-                random_card_slot = grng->randomInSegment(0, ai_player_cards_count - 1);
-                if (CanCardBePlayed(player_num, random_card_slot))
-                    return PlayCard(player_num, random_card_slot);
-            }
-        }
-
-        // if that fails discard card at random
-        random_card_slot = grng->randomInSegment(0, ai_player_cards_count - 1);
-        return DiscardCard(player_num, random_card_slot);
-
-    } else if ((opponent_mastery == 1) || (opponent_mastery == 2)) {
-        // apply some cunning
-        ArcomagePlayer *player = &am_Players[player_num];
-        ArcomagePlayer *enemy = &am_Players[(player_num + 1) % 2];
-
-        // wipe cards power array - set negative for unfilled card slots
-        for (int i = 0; i < 10; ++i) {
-            if (i >= ai_player_cards_count) {
-                cards_power[i].slot_index = -1;
-                cards_power[i].card_power = -9999;
-            } else {
-                cards_power[i].slot_index = i;
-                cards_power[i].card_power = 0;
-            }
-        }
-
-        // calculate how effective each card would be
-        for (int i = 0; i < ai_player_cards_count; ++i) {
-            ArcomageCard *calc_card = &pCards[am_Players[player_num].cards_at_hand[cards_power[i].slot_index]];
-            cards_power[i].card_power =
-                CalculateCardPower(player, enemy, calc_card, opponent_mastery - 1);
-        }
-
-        // bubble sort the card powers in order
-        for (int j = ai_player_cards_count - 1; j >= 0; --j) {
-            for (int m = 0; m < j; ++m) {
-                if (cards_power[m].card_power < cards_power[m + 1].card_power) {
-                    int tempslot = cards_power[m].slot_index;
-                    int temppow = cards_power[m].card_power;
-                    cards_power[m].slot_index = cards_power[m + 1].slot_index;
-                    cards_power[m].card_power = cards_power[m + 1].card_power;
-                    cards_power[m + 1].slot_index = tempslot;
-                    cards_power[m + 1].card_power = temppow;
-                }
-            }
-        }
-
-        // if we have to discard pick the least powerful to chuck
-        int discard_slot = 0;
-        for (int i = ai_player_cards_count - 1; i; --i) {
-            if (i >= 0) {
-                if (pCards[am_Players[player_num].cards_at_hand[cards_power[i].slot_index]].can_be_discarded) {
-                    discard_slot = cards_power[i].slot_index;
-                }
-            }
-        }
-
-        if (!need_to_discard_card) {
-            // try and play most powerful card
-            for (int i = 0; i < ai_player_cards_count - 1; ++i) {
-                if (CanCardBePlayed(player_num, cards_power[i].slot_index) && cards_power[i].card_power) {
-                    return PlayCard(player_num, cards_power[i].slot_index);
-                }
-            }
-        }
-
-        // fall back - have to discard
-        return DiscardCard(player_num, discard_slot);
-    }
-    return true;  // result != 0;
+    ArcomageAiMove move = chooseArcomageAiMove(am_Players[player_num], am_Players[(player_num + 1) % 2],
+                                               need_to_discard_card, opponent_mastery, max_tower_height, grng);
+    if (move.discard)
+        return DiscardCard(player_num, move.slot);
+    return PlayCard(player_num, move.slot);
 }
 
 void ArcomageGame::Loop() {
@@ -898,7 +595,7 @@ void ArcomageGame::Loop() {
                 if (pArcomageGame->force_am_exit) break;
             }
         }
-        pArcomageGame->GameOver = IsGameOver();
+        pArcomageGame->GameOver = isArcomageGameOver(am_Players, max_tower_height, max_resources_amount);
         if (!pArcomageGame->GameOver) TurnChange();
         if (pArcomageGame->force_am_exit) pArcomageGame->GameOver = 1;
     }
@@ -1001,10 +698,8 @@ void ArcomageGame::Loop() {
 }
 
 void SetStartGameData() {
-    signed int j;                       // edx@7
-    int card_id_counter;                // edx@13
-    signed int i;                       // ecx@13
-    signed int card_dispenser_counter;  // eax@13
+    signed int j;  // edx@7
+    signed int i;  // ecx@13
 
     SetStartConditions();
 
@@ -1035,77 +730,13 @@ void SetStartGameData() {
             }
         }
     }
-    deckMaster.name = "Master Deck";
-    for (i = 0, card_dispenser_counter = -2, card_id_counter = 0; i < DECK_SIZE;
-         ++i, ++card_dispenser_counter) {
-        deckMaster.cardsInUse[i] = 0;
-        deckMaster.cards_IDs[i] = card_id_counter;
-        switch (card_dispenser_counter) {
-            case 0:
-            case 2:
-            case 6:
-            case 9:
-            case 13:
-            case 18:
-            case 23:
-            case 33:
-            case 36:
-            case 38:
-            case 44:
-            case 46:
-            case 52:
-            case 57:
-            case 69:
-            case 71:
-            case 75:
-            case 79:
-            case 81:
-            case 84:
-            case 89:
-                break;
-            default:
-                ++card_id_counter;
-        }
-    }
+    fillArcomageMasterDeck(&deckMaster);
     FillPlayerDeck();
 }
 
 void FillPlayerDeck() {
-    int m;
-    int rand_deck_pos = 0;
-    char card_taken_flags[DECK_SIZE];
-    int i, j;
-
     ArcomageGame::playSound(20);
-    memset(deckMaster.cardsInUse, 0, DECK_SIZE);
-    memset(card_taken_flags, 0, DECK_SIZE);
-
-    for (i = 0; i < 2; ++i) {
-        for (j = 0; j < 10; ++j) {
-            if (am_Players[i].cards_at_hand[j] > -1) {
-                for (m = 0; m < DECK_SIZE; ++m) {
-                    if (deckMaster.cards_IDs[m] ==
-                            am_Players[i].cards_at_hand[j] &&
-                        deckMaster.cardsInUse[m] == 0) {
-                        // mark which cards are already in players hands
-                        deckMaster.cardsInUse[m] = 1;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    for (i = 0; i < DECK_SIZE; ++i) {
-        do {
-            rand_deck_pos = grng->random(DECK_SIZE);
-        } while (card_taken_flags[rand_deck_pos] == 1);
-
-        card_taken_flags[rand_deck_pos] = 1;
-        playDeck.cards_IDs[i] = deckMaster.cards_IDs[rand_deck_pos];
-        playDeck.cardsInUse[i] = deckMaster.cardsInUse[rand_deck_pos];
-    }
-
+    shuffleArcomageDeck(&deckMaster, &playDeck, am_Players, grng);
     deck_walk_index = 0;
 }
 
@@ -1118,25 +749,11 @@ void InitalHandsFill() {
 }
 
 void GetNextCardFromDeck(int player_num) {
-    signed int deck_index;      // eax@1
-    int new_card_id;            // edi@1
+    int new_card_id;
     signed int card_slot_indx;  // eax@7
 
-    deck_index = deck_walk_index;
-    for (;;) {
-        if (deck_index >= DECK_SIZE) {
-            FillPlayerDeck();
-            deck_index = deck_walk_index = 0;
-        }
-        if (!playDeck.cardsInUse[deck_index]) {
-            new_card_id = playDeck.cards_IDs[deck_index];
-            ++deck_index;
-            deck_walk_index = deck_index;
-            break;
-        }
-        ++deck_index;
-        deck_walk_index = deck_index;
-    }
+    while ((new_card_id = takeArcomageDeckCard(playDeck, &deck_walk_index)) == -1)
+        FillPlayerDeck();
 
     ArcomageGame::playSound(21);
     card_slot_indx = GetEmptyCardSlotIndex(player_num);
@@ -1181,21 +798,6 @@ void TurnChange() {
     }
 }
 
-bool IsGameOver() {
-    // check if victory conditions have been met
-    bool result = false;
-    for (int i = 0; i < 2; ++i) {
-        if (am_Players[i].tower_height <= 0) result = true;
-        if (am_Players[i].tower_height >= max_tower_height) result = true;
-        if (am_Players[i].resource_bricks >= max_resources_amount ||
-            am_Players[i].resource_gems >= max_resources_amount ||
-            am_Players[i].resource_beasts >= max_resources_amount)
-            result = true;
-    }
-
-    return result;
-}
-
 char PlayerTurn(int player_num) {
     // Rect pSrcXYZW;
     Pointi pTargetXY;
@@ -2000,12 +1602,7 @@ void ArcomageGame::GetCardRect(int uCardID, Recti *pCardRect) {
 }
 
 int GetPlayerHandCardCount(int player_num) {
-    int card_count = 0;
-    for (int i = 0; i < 10; ++i) {
-        if (am_Players[player_num].cards_at_hand[i] != -1) ++card_count;
-    }
-
-    return card_count;
+    return arcomageHandCardCount(am_Players[player_num]);
 }
 
 signed int DrawCardsRectangles(int player_num) {
@@ -2140,314 +1737,42 @@ bool PlayCard(int player_num, int card_slot_num) {
 }
 
 bool CanCardBePlayed(int player_num, int hand_card_indx) {
-    bool result = true;
-    ArcomagePlayer *pPlayer = &am_Players[player_num];
-    ArcomageCard *test_card = &pCards[pPlayer->cards_at_hand[hand_card_indx]];
-
-    // test card conditions
-    if (test_card->needed_quarry_level > pPlayer->quarry_level) result = false;
-    if (test_card->needed_magic_level > pPlayer->magic_level) result = false;
-    if (test_card->needed_zoo_level > pPlayer->zoo_level) result = false;
-    if (test_card->needed_bricks > pPlayer->resource_bricks) result = false;
-    if (test_card->needed_gems > pPlayer->resource_gems) result = false;
-    if (test_card->needed_beasts > pPlayer->resource_beasts) result = false;
-
-    return result;
+    const ArcomagePlayer &player = am_Players[player_num];
+    return canArcomageCardBePlayed(player, pCards[player.cards_at_hand[hand_card_indx]]);
 }
 
 void ApplyCardToPlayer(int player_num, int uCardID) {
-#define APPLY_TO_PLAYER(PLAYER, ENEMY, FIELD, VAL, RES)   \
-    if (VAL != 0) {                                       \
-        if (VAL == 99) {                                  \
-            if (PLAYER->FIELD < ENEMY->FIELD) {           \
-                PLAYER->FIELD = ENEMY->FIELD;             \
-                RES = ENEMY->FIELD - PLAYER->FIELD;       \
-            }                                             \
-        } else {                                          \
-            PLAYER->FIELD += (signed int)(VAL);           \
-            if (PLAYER->FIELD < 0) PLAYER->FIELD = 0;     \
-            RES = (signed int)(VAL);                      \
-        }                                                 \
-    }
-
-#define APPLY_TO_ENEMY(PLAYER, ENEMY, FIELD, VAL, RES) \
-    APPLY_TO_PLAYER(ENEMY, PLAYER, FIELD, VAL, RES)
-
-#define APPLY_TO_BOTH(PLAYER, ENEMY, FIELD, VAL, RES_P, RES_E) \
-    if (VAL != 0) {                                            \
-        if (VAL == 99) {                                       \
-            if (PLAYER->FIELD != ENEMY->FIELD) {               \
-                if (PLAYER->FIELD <= ENEMY->FIELD) {           \
-                    PLAYER->FIELD = ENEMY->FIELD;              \
-                    RES_P = ENEMY->FIELD - PLAYER->FIELD;      \
-                } else {                                       \
-                    ENEMY->FIELD = PLAYER->FIELD;              \
-                    RES_E = PLAYER->FIELD - ENEMY->FIELD;      \
-                }                                              \
-            }                                                  \
-        } else {                                               \
-            PLAYER->FIELD += (signed int)(VAL);                \
-            ENEMY->FIELD += (signed int)(VAL);                 \
-            if (PLAYER->FIELD < 0) {                           \
-                PLAYER->FIELD = 0;                             \
-            }                                                  \
-            if (ENEMY->FIELD < 0) {                            \
-                ENEMY->FIELD = 0;                              \
-            }                                                  \
-            RES_P = (signed int)(VAL);                         \
-            RES_E = (signed int)(VAL);                         \
-        }                                                      \
-    }
-
-    ArcomagePlayer *player = &am_Players[player_num];
-    int enemy_num = ((player_num + 1) % 2);
-    ArcomagePlayer *enemy = &am_Players[enemy_num];
-    ArcomageCard *pCard = &pCards[uCardID];
-
-    int buildings_e = 0;
-    int buildings_p = 0;
-    int dmg_e = 0;
-    int dmg_p = 0;
-    int tower_e = 0;
-    int tower_p = 0;
-    int wall_e = 0;
-    int wall_p = 0;
-
-    int beasts_e = 0;
-    int beasts_p = 0;
-    int gems_e = 0;
-    int gems_p = 0;
-    int bricks_e = 0;
-    int bricks_p = 0;
-    int zoo_e = 0;
-    int zoo_p = 0;
-    int magic_e = 0;
-    int magic_p = 0;
-    int quarry_e = 0;
-    int quarry_p = 0;
-
-    switch (pCard->compare_param) {
-        case CHECK_LESSER_QUARRY : // Mother Lode & Copping the Tech
-            if (player->quarry_level < enemy->quarry_level)
-                goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_MAGIC: // Parity
-            if (player->magic_level < enemy->magic_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_ZOO:
-            if (player->zoo_level < enemy->zoo_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_QUARRY:
-            if (player->quarry_level == enemy->quarry_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_MAGIC:
-            if (player->magic_level == enemy->magic_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_ZOO:
-            if (player->zoo_level == enemy->zoo_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_QUARRY:
-            if (player->quarry_level > enemy->quarry_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_MAGIC: // Unicorn
-            if (player->magic_level > enemy->magic_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_ZOO:
-            if (player->zoo_level > enemy->zoo_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_NO_WALL: // Foundations
-            if (!player->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_HAVE_WALL:
-            if (player->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_ENEMY_HAS_NO_WALL: // Spizzer
-            if (!enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_ENEMY_HAS_WALL: // Corrosion Cloud
-            if (enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_WALL:
-            if (player->wall_height < enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_TOWER:
-            if (player->tower_height < enemy->tower_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_WALL:
-            if (player->wall_height == enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_TOWER:
-            if (player->tower_height == enemy->tower_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_WALL: // Elven Archers
-            if (player->wall_height > enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_TOWER:
-            if (player->tower_height > enemy->tower_height) goto desired_effects;
-            goto secondary_effects;
-        default:
-        desired_effects:
-            num_actions_left =
-                pCard->draw_extra_card_count + (pCard->field_30 == 1);
-            num_cards_to_discard = pCard->draw_extra_card_count;
-            for (char i = 0; i < pCard->draw_extra_card_count; i++)
-                GetNextCardFromDeck(player_num);
-
-            need_to_discard_card =
-                GetPlayerHandCardCount(player_num) > minimum_cards_at_hand;
-
-            APPLY_TO_PLAYER(player, enemy, quarry_level,
-                            pCard->to_player_quarry_lvl, quarry_p);
-            APPLY_TO_PLAYER(player, enemy, magic_level,
-                            pCard->to_player_magic_lvl, magic_p);
-            APPLY_TO_PLAYER(player, enemy, zoo_level, pCard->to_player_zoo_lvl,
-                            zoo_p);
-            APPLY_TO_PLAYER(player, enemy, resource_bricks,
-                            pCard->to_player_bricks, bricks_p);
-            APPLY_TO_PLAYER(player, enemy, resource_gems, pCard->to_player_gems,
-                            gems_p);
-            APPLY_TO_PLAYER(player, enemy, resource_beasts,
-                            pCard->to_player_beasts, beasts_p);
-            if (pCard->to_player_buildings) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_player_buildings);
-                buildings_p = (signed int)pCard->to_player_buildings - dmg_p;
-            }
-            APPLY_TO_PLAYER(player, enemy, wall_height, pCard->to_player_wall,
-                            wall_p);
-            APPLY_TO_PLAYER(player, enemy, tower_height, pCard->to_player_tower,
-                            tower_p);
-
-            APPLY_TO_ENEMY(player, enemy, quarry_level,
-                           pCard->to_enemy_quarry_lvl, quarry_e);
-            APPLY_TO_ENEMY(player, enemy, magic_level,
-                           pCard->to_enemy_magic_lvl, magic_e);
-            APPLY_TO_ENEMY(player, enemy, zoo_level, pCard->to_enemy_zoo_lvl,
-                           zoo_e);
-            APPLY_TO_ENEMY(player, enemy, resource_bricks,
-                           pCard->to_enemy_bricks, bricks_e);
-            APPLY_TO_ENEMY(player, enemy, resource_gems, pCard->to_enemy_gems,
-                           gems_e);
-            APPLY_TO_ENEMY(player, enemy, resource_beasts,
-                           pCard->to_enemy_beasts, beasts_e);
-            if (pCard->to_enemy_buildings) {
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_enemy_buildings);
-                buildings_e = (signed int)pCard->to_enemy_buildings - dmg_e;
-            }
-            APPLY_TO_ENEMY(player, enemy, wall_height, pCard->to_enemy_wall,
-                           wall_e);
-            APPLY_TO_ENEMY(player, enemy, tower_height, pCard->to_enemy_tower,
-                           tower_e);
-
-            APPLY_TO_BOTH(player, enemy, quarry_level,
-                          pCard->to_pl_enm_quarry_lvl, quarry_p, quarry_e);
-            APPLY_TO_BOTH(player, enemy, magic_level,
-                          pCard->to_pl_enm_magic_lvl, magic_p, magic_e);
-            APPLY_TO_BOTH(player, enemy, zoo_level, pCard->to_pl_enm_zoo_lvl,
-                          zoo_p, zoo_e);
-            APPLY_TO_BOTH(player, enemy, resource_bricks,
-                          pCard->to_pl_enm_bricks, bricks_p, bricks_e);
-            APPLY_TO_BOTH(player, enemy, resource_gems, pCard->to_pl_enm_gems,
-                          gems_p, gems_e);
-            APPLY_TO_BOTH(player, enemy, resource_beasts,
-                          pCard->to_pl_enm_beasts, beasts_p, beasts_e);
-            if (pCard->to_pl_enm_buildings) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_pl_enm_buildings);
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_pl_enm_buildings);
-                buildings_p = (signed int)pCard->to_pl_enm_buildings - dmg_p;
-                buildings_e = (signed int)pCard->to_pl_enm_buildings - dmg_e;
-            }
-            APPLY_TO_BOTH(player, enemy, wall_height, pCard->to_pl_enm_wall,
-                          wall_p, wall_e);
-            APPLY_TO_BOTH(player, enemy, tower_height, pCard->to_pl_enm_tower,
-                          tower_p, tower_e);
-            break;
-        case CHECK_ALWAYS_SECONDARY:
-        secondary_effects:
-            num_actions_left = pCard->can_draw_extra_card2 + (pCard->field_4D == 1);
-            num_cards_to_discard = pCard->can_draw_extra_card2;
-            for (char i = 0; i < pCard->can_draw_extra_card2; i++)
-                GetNextCardFromDeck(player_num);
-
-            need_to_discard_card =
-                GetPlayerHandCardCount(player_num) > minimum_cards_at_hand;
-
-            APPLY_TO_PLAYER(player, enemy, quarry_level,
-                            pCard->to_player_quarry_lvl2, quarry_p);
-            APPLY_TO_PLAYER(player, enemy, magic_level,
-                            pCard->to_player_magic_lvl2, magic_p);
-            APPLY_TO_PLAYER(player, enemy, zoo_level, pCard->to_player_zoo_lvl2,
-                            zoo_p);
-            APPLY_TO_PLAYER(player, enemy, resource_bricks,
-                            pCard->to_player_bricks2, bricks_p);
-            APPLY_TO_PLAYER(player, enemy, resource_gems,
-                            pCard->to_player_gems2, gems_p);
-            APPLY_TO_PLAYER(player, enemy, resource_beasts,
-                            pCard->to_player_beasts2, beasts_p);
-            if (pCard->to_player_buildings2) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_player_buildings2);
-                buildings_p = (signed int)pCard->to_player_buildings2 - dmg_p;
-            }
-            APPLY_TO_PLAYER(player, enemy, wall_height, pCard->to_player_wall2,
-                            wall_p);
-            APPLY_TO_PLAYER(player, enemy, tower_height,
-                            pCard->to_player_tower2, tower_p);
-
-            APPLY_TO_ENEMY(player, enemy, quarry_level,
-                           pCard->to_enemy_quarry_lvl2, quarry_e);
-            APPLY_TO_ENEMY(player, enemy, magic_level,
-                           pCard->to_enemy_magic_lvl2, magic_e);
-            APPLY_TO_ENEMY(player, enemy, zoo_level, pCard->to_enemy_zoo_lvl2,
-                           zoo_e);
-            APPLY_TO_ENEMY(player, enemy, resource_bricks,
-                           pCard->to_enemy_bricks2, bricks_e);
-            APPLY_TO_ENEMY(player, enemy, resource_gems, pCard->to_enemy_gems2,
-                           gems_e);
-            APPLY_TO_ENEMY(player, enemy, resource_beasts,
-                           pCard->to_enemy_beasts2, beasts_e);
-            if (pCard->to_enemy_buildings2) {
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_enemy_buildings2);
-                buildings_e = (signed int)pCard->to_enemy_buildings2 - dmg_e;
-            }
-            APPLY_TO_ENEMY(player, enemy, wall_height, pCard->to_enemy_wall2,
-                           wall_e);
-            APPLY_TO_ENEMY(player, enemy, tower_height, pCard->to_enemy_tower2,
-                           tower_e);
-
-            APPLY_TO_BOTH(player, enemy, quarry_level,
-                          pCard->to_pl_enm_quarry_lvl2, quarry_p, quarry_e);
-            APPLY_TO_BOTH(player, enemy, magic_level,
-                          pCard->to_pl_enm_magic_lvl2, magic_p, magic_e);
-            APPLY_TO_BOTH(player, enemy, zoo_level, pCard->to_pl_enm_zoo_lvl2,
-                          zoo_p, zoo_e);
-            APPLY_TO_BOTH(player, enemy, resource_bricks,
-                          pCard->to_pl_enm_bricks2, bricks_p, bricks_e);
-            APPLY_TO_BOTH(player, enemy, resource_gems, pCard->to_pl_enm_gems2,
-                          gems_p, gems_e);
-            APPLY_TO_BOTH(player, enemy, resource_beasts,
-                          pCard->to_pl_enm_beasts2, beasts_p, beasts_e);
-
-            if (pCard->to_pl_enm_buildings2) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_pl_enm_buildings2);
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_pl_enm_buildings2);
-                buildings_p = (signed int)pCard->to_pl_enm_buildings2 - dmg_p;
-                buildings_e = (signed int)pCard->to_pl_enm_buildings2 - dmg_e;
-            }
-            APPLY_TO_BOTH(player, enemy, wall_height, pCard->to_pl_enm_wall2,
-                          wall_p, wall_e);
-            APPLY_TO_BOTH(player, enemy, tower_height, pCard->to_pl_enm_tower2,
-                          tower_p, tower_e);
-            break;
-    }
-    //  }
-
+    ArcomageCardEffects effects = applyArcomageCard(&am_Players[player_num], &am_Players[(player_num + 1) % 2],
+                                                    pCards[uCardID]);
+
+    num_actions_left = effects.actionsLeft;
+    num_cards_to_discard = effects.extraCards;
+    for (int i = 0; i < effects.extraCards; i++)
+        GetNextCardFromDeck(player_num);
+
+    need_to_discard_card = GetPlayerHandCardCount(player_num) > minimum_cards_at_hand;
+
+    int buildings_e = effects.buildingsE;
+    int buildings_p = effects.buildingsP;
+    int dmg_e = effects.damageE;
+    int dmg_p = effects.damageP;
+    int tower_e = effects.towerE;
+    int tower_p = effects.towerP;
+    int wall_e = effects.wallE;
+    int wall_p = effects.wallP;
+
+    int beasts_e = effects.beastsE;
+    int beasts_p = effects.beastsP;
+    int gems_e = effects.gemsE;
+    int gems_p = effects.gemsP;
+    int bricks_e = effects.bricksE;
+    int bricks_p = effects.bricksP;
+    int zoo_e = effects.zooE;
+    int zoo_p = effects.zooP;
+    int magic_e = effects.magicE;
+    int magic_p = effects.magicP;
+    int quarry_e = effects.quarryE;
+    int quarry_p = effects.quarryP;
 
     // call sound if required
     if (quarry_p > 0 || quarry_e > 0) pArcomageGame->playSound(30);
@@ -2674,169 +1999,16 @@ void ApplyCardToPlayer(int player_num, int uCardID) {
             new_explosion_effect(&explos_coords, buildings_e);
         }
     }
-
-#undef APPLY_TO_BOTH
-#undef APPLY_TO_ENEMY
-#undef APPLY_TO_PLAYER
 }
 
 
 
-int ApplyDamageToBuildings(int player_num, int damage) {
-    int wall = am_Players[player_num].wall_height;
-    int result = 0;
-
-    if (wall >= -damage) {  // wall absorbs all damage
-        result = damage;
-        am_Players[player_num].wall_height += damage;
-    } else {
-        damage += wall;  // reduce damage by size of wall
-        am_Players[player_num].wall_height = 0;
-        result = -wall;
-        am_Players[player_num].tower_height += damage;  // apply remaining to tower
-    }
-
-    if (am_Players[player_num].tower_height < 0)
-        am_Players[player_num].tower_height = 0;
-
-    return result;
-}
-
 void GameResultsApply() {
-    int winner;               // esi@1
-    int victory_type;         // edi@1
-    int pl_resource;          // edx@25
-    int en_resource;          // eax@28
     int tavern_num;  // eax@54
 
-    winner = -1;
-    victory_type = -1;
-    // nullsub_1();
-    /*strcpy(pText, "The Winner is: ");//"Победил: " Ritor1: архаизм
-    xy.y = 160;
-    xy.x = 320; //- 12 * v2 / 2;
-    am_DrawText(-1, pText, &xy);*/
-
-    //проверка построена ли башня
-    if (am_Players[0].tower_height < max_tower_height &&
-        am_Players[1].tower_height >=
-            max_tower_height) {  //наша башня не построена, а у врага построена
-        winner = 2;  //победил игрок 2(враг)
-        victory_type = 0;
-    } else if (am_Players[0].tower_height >= max_tower_height &&
-               am_Players[1].tower_height <
-                   max_tower_height) {  //наша башня построена, а у врага нет
-        winner = 1;  //победил игрок 1(мы)
-        victory_type = 0;
-    } else if (am_Players[0].tower_height >= max_tower_height &&
-               am_Players[1].tower_height >=
-                   max_tower_height) {  //и у нас, и у врага построена
-        if (am_Players[0].tower_height ==
-            am_Players[1].tower_height) {  //наши башни равны
-            winner = 0;        //никто не победил
-            victory_type = 4;  //ничья
-        } else {               //наши башни не равны
-            winner =
-                (am_Players[0].tower_height <= am_Players[1].tower_height) +
-                1;  //победил тот, у кого выше
-            victory_type = 0;
-        }
-    }
-
-    //проверка разрушена ли башня
-    if (am_Players[0].tower_height <= 0 &&
-        am_Players[1].tower_height > 0) {  //наша башня разрушена, а у врага нет
-        winner = 2;        // победил игрок 2(враг)
-        victory_type = 2;  //победил разрушив башню врага
-    } else if (am_Players[0].tower_height > 0 &&
-               am_Players[1].tower_height <=
-                   0) {  //у врага башня разрушена, а у нас нет
-        winner = 1;        //победил игрок 1(мы)
-        victory_type = 2;  //победил разрушив башню врага
-    } else if (am_Players[0].tower_height <= 0 &&
-               am_Players[1].tower_height <=
-                   0) {  //наша башня разрушена, и у врага разрушена
-        if (am_Players[0].tower_height ==
-            am_Players[1].tower_height) {  //если башни равны
-            if (am_Players[0].wall_height ==
-                am_Players[1].wall_height) {  //если стены равны
-                winner = 0;
-                victory_type = 4;
-            } else {  //если стены не равны
-                winner =
-                    (am_Players[0].wall_height <= am_Players[1].wall_height) +
-                    1;  //победил тот, у кого стена выше
-                victory_type = 1;  //победа когда больше стена при ничье
-            }
-        } else {  //башни не равны
-            winner =
-                (am_Players[0].tower_height <= am_Players[1].tower_height) +
-                1;  // побеждает тот у кого башня больше
-            victory_type = 2;  //победил разрушив башню врага
-        }
-    }
-
-    //проверка набраны ли ресурсы
-    //проверка какого ресурса больше всего у игрока 1(нас)
-    pl_resource =
-        am_Players[0].resource_bricks;  //кирпичей больше чем др. ресурсов
-    if (am_Players[0].resource_gems > am_Players[0].resource_bricks &&
-        am_Players[0].resource_gems >
-            am_Players[0].resource_beasts)  //драг.камней больше всего
-        pl_resource = am_Players[0].resource_gems;
-    else if (am_Players[0].resource_beasts > am_Players[0].resource_gems &&
-             am_Players[0].resource_beasts >
-                 am_Players[0].resource_bricks)  //зверей больше всего
-        pl_resource = am_Players[0].resource_beasts;
-
-    //проверка какого ресурса больше у игрока 2(врага)
-    en_resource =
-        am_Players[1].resource_bricks;  //кирпичей больше чем др. ресурсов
-    if (am_Players[1].resource_gems > am_Players[1].resource_bricks &&
-        am_Players[1].resource_gems >
-            am_Players[1].resource_beasts)  //драг.камней больше всего
-        en_resource = am_Players[1].resource_gems;
-    else if (am_Players[1].resource_beasts > am_Players[1].resource_gems &&
-             am_Players[1].resource_beasts >
-                 am_Players[1].resource_bricks)  //зверей больше всего
-        en_resource = am_Players[1].resource_beasts;
-
-    //сравнение ресурсов игроков
-    if (winner == -1 && victory_type == -1) {  //нет победителя по башням
-        if (pl_resource < max_resources_amount &&
-            en_resource >=
-                max_resources_amount) {  //враг набрал нужное количество
-            winner = 2;  // враг победил
-            victory_type = 3;  //победа собрав нужное количество ресурсов
-        } else if (pl_resource >= max_resources_amount &&
-                   en_resource <
-                       max_resources_amount) {  //мы набрали нужное количество
-            winner = 1;  // мы победили
-            victory_type = 3;  //победа собрав нужное количество ресурсов
-        } else if (pl_resource >= max_resources_amount &&
-                   en_resource >=
-                       max_resources_amount) {  //и у нас и у врага нужное
-                                                //количество ресурсов
-            if (pl_resource == en_resource) {  // ресурсы равны
-                winner = 0;        //ресурсы равны
-                victory_type = 4;  //ничья
-            } else {
-                winner = (pl_resource <= en_resource) +
-                         1;  //ресурсы не равны, побеждает тот у кого больше
-                victory_type = 3;  //победа собрав нужное количество ресурсов
-            }
-        }
-    } else if (winner == 0 && victory_type == 4) {  // при ничье по башням и стене
-        if (pl_resource != en_resource) {  //ресурсы не равны
-            winner =
-                (pl_resource <= en_resource) + 1;  //победил тот у кого больше
-            victory_type =
-                5;  //победа когда при ничье большее количество ресурсов
-        } else {    //ресурсы равны
-            winner = 0;        //нет победителя
-            victory_type = 4;  //ничья
-        }
-    }
+    ArcomageGameResult result = arcomageGameResult(am_Players, max_tower_height, max_resources_amount);
+    int winner = result.winner;
+    int victory_type = result.victoryType;
 
     pArcomageGame->Victory_type = victory_type;
     pArcomageGame->uGameWinner = winner;
@@ -0,0 +1,632 @@
+#include "ArcomageRules.h"
+
+#include <cassert>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "Library/Random/RandomEngine.h"
+
+#include "Utility/IndexedArray.h"
+
+void fillArcomageMasterDeck(ArcomageDeck *deck) {
+    deck->name = "Master Deck";
+
+    int cardId = 0;
+    for (int i = 0, dispenser = -2; i < DECK_SIZE; ++i, ++dispenser) {
+        deck->cardsInUse[i] = 0;
+        deck->cards_IDs[i] = cardId;
+        switch (dispenser) {
+            case 0:
+            case 2:
+            case 6:
+            case 9:
+            case 13:
+            case 18:
+            case 23:
+            case 33:
+            case 36:
+            case 38:
+            case 44:
+            case 46:
+            case 52:
+            case 57:
+            case 69:
+            case 71:
+            case 75:
+            case 79:
+            case 81:
+            case 84:
+            case 89:
+                break; // These cards go into the deck twice.
+            default:
+                ++cardId;
+        }
+    }
+}
+
+void shuffleArcomageDeck(ArcomageDeck *master, ArcomageDeck *play, const ArcomagePlayer *players, RandomEngine *rng) {
+    char takenFlags[DECK_SIZE];
+
+    memset(master->cardsInUse, 0, DECK_SIZE);
+    memset(takenFlags, 0, DECK_SIZE);
+
+    // Mark which cards are already in players' hands.
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            if (players[i].cards_at_hand[j] <= -1)
+                continue;
+
+            for (int m = 0; m < DECK_SIZE; ++m) {
+                if (master->cards_IDs[m] == players[i].cards_at_hand[j] && master->cardsInUse[m] == 0) {
+                    master->cardsInUse[m] = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < DECK_SIZE; ++i) {
+        int pos;
+        do {
+            pos = rng->random(DECK_SIZE);
+        } while (takenFlags[pos] == 1);
+
+        takenFlags[pos] = 1;
+        play->cards_IDs[i] = master->cards_IDs[pos];
+        play->cardsInUse[i] = master->cardsInUse[pos];
+    }
+}
+
+int takeArcomageDeckCard(const ArcomageDeck &play, int *walkIndex) {
+    while (*walkIndex < DECK_SIZE) {
+        int index = (*walkIndex)++;
+        if (!play.cardsInUse[index])
+            return play.cards_IDs[index];
+    }
+    return -1;
+}
+
+int arcomageHandCardCount(const ArcomagePlayer &player) {
+    return std::ranges::count_if(player.cards_at_hand, [](int id) { return id != -1; });
+}
+
+bool canArcomageCardBePlayed(const ArcomagePlayer &player, const ArcomageCard &card) {
+    return card.needed_quarry_level <= player.quarry_level &&
+           card.needed_magic_level <= player.magic_level &&
+           card.needed_zoo_level <= player.zoo_level &&
+           card.needed_bricks <= player.resource_bricks &&
+           card.needed_gems <= player.resource_gems &&
+           card.needed_beasts <= player.resource_beasts;
+}
+
+int applyArcomageBuildingDamage(ArcomagePlayer *player, int damage) {
+    int wall = player->wall_height;
+    int result = 0;
+
+    if (wall >= -damage) { // Wall absorbs all damage.
+        result = damage;
+        player->wall_height += damage;
+    } else {
+        damage += wall; // Reduce damage by size of wall & apply the rest to the tower.
+        player->wall_height = 0;
+        result = -wall;
+        player->tower_height += damage;
+    }
+
+    if (player->tower_height < 0)
+        player->tower_height = 0;
+
+    return result;
+}
+
+using ArcomageStat = int ArcomagePlayer::*;
+
+/**
+ * Applies a card value to a single player. Value of `99` means "catch up with the other player". Note that in this
+ * case the reported delta is always zero, this is how it worked in the original game.
+ */
+static void applyToOne(ArcomagePlayer *target, const ArcomagePlayer *other, ArcomageStat stat, int value, int *delta) {
+    if (value == 0)
+        return;
+
+    if (value == 99) {
+        if (target->*stat < other->*stat) {
+            target->*stat = other->*stat;
+            *delta = other->*stat - target->*stat;
+        }
+    } else {
+        target->*stat = std::max(0, target->*stat + value);
+        *delta = value;
+    }
+}
+
+/**
+ * Applies a card value to both players. Value of `99` means "the player who's behind catches up".
+ */
+static void applyToBoth(ArcomagePlayer *player, ArcomagePlayer *enemy, ArcomageStat stat, int value,
+                        int *deltaP, int *deltaE) {
+    if (value == 0)
+        return;
+
+    if (value == 99) {
+        if (player->*stat < enemy->*stat) {
+            player->*stat = enemy->*stat;
+            *deltaP = enemy->*stat - player->*stat;
+        } else if (player->*stat > enemy->*stat) {
+            enemy->*stat = player->*stat;
+            *deltaE = player->*stat - enemy->*stat;
+        }
+    } else {
+        player->*stat = std::max(0, player->*stat + value);
+        enemy->*stat = std::max(0, enemy->*stat + value);
+        *deltaP = value;
+        *deltaE = value;
+    }
+}
+
+static bool isArcomageCardPrimary(const ArcomagePlayer &player, const ArcomagePlayer &enemy, ArcomageCheck check) {
+    switch (check) {
+        case CHECK_ALWAYS_SECONDARY:    return false;
+        case CHECK_LESSER_QUARRY:       return player.quarry_level < enemy.quarry_level; // Mother Lode.
+        case CHECK_LESSER_MAGIC:        return player.magic_level < enemy.magic_level; // Parity.
+        case CHECK_LESSER_ZOO:          return player.zoo_level < enemy.zoo_level;
+        case CHECK_EQUAL_QUARRY:        return player.quarry_level == enemy.quarry_level;
+        case CHECK_EQUAL_MAGIC:         return player.magic_level == enemy.magic_level;
+        case CHECK_EQUAL_ZOO:           return player.zoo_level == enemy.zoo_level;
+        case CHECK_GREATER_QUARRY:      return player.quarry_level > enemy.quarry_level;
+        case CHECK_GREATER_MAGIC:       return player.magic_level > enemy.magic_level; // Unicorn.
+        case CHECK_GREATER_ZOO:         return player.zoo_level > enemy.zoo_level;
+        case CHECK_NO_WALL:             return !player.wall_height; // Foundations.
+        case CHECK_HAVE_WALL:           return player.wall_height;
+        case CHECK_ENEMY_HAS_NO_WALL:   return !enemy.wall_height; // Spizzer.
+        case CHECK_ENEMY_HAS_WALL:      return enemy.wall_height; // Corrosion Cloud.
+        case CHECK_LESSER_WALL:         return player.wall_height < enemy.wall_height;
+        case CHECK_LESSER_TOWER:        return player.tower_height < enemy.tower_height;
+        case CHECK_EQUAL_WALL:          return player.wall_height == enemy.wall_height;
+        case CHECK_EQUAL_TOWER:         return player.tower_height == enemy.tower_height;
+        case CHECK_GREATER_WALL:        return player.wall_height > enemy.wall_height; // Elven Archers.
+        case CHECK_GREATER_TOWER:       return player.tower_height > enemy.tower_height;
+        default:                        return true;
+    }
+}
+
+ArcomageCardEffects applyArcomageCard(ArcomagePlayer *player, ArcomagePlayer *enemy, const ArcomageCard &card) {
+    using P = ArcomagePlayer;
+
+    ArcomageCardEffects r;
+    r.primary = isArcomageCardPrimary(*player, *enemy, card.compare_param);
+
+    auto pick = [primary = r.primary] (int primaryValue, int secondaryValue) {
+        return primary ? primaryValue : secondaryValue;
+    };
+
+    r.extraCards = pick(card.draw_extra_card_count, card.can_draw_extra_card2);
+    r.actionsLeft = r.extraCards + (pick(card.field_30, card.field_4D) == 1);
+
+    applyToOne(player, enemy, &P::quarry_level, pick(card.to_player_quarry_lvl, card.to_player_quarry_lvl2),
+               &r.quarryP);
+    applyToOne(player, enemy, &P::magic_level, pick(card.to_player_magic_lvl, card.to_player_magic_lvl2), &r.magicP);
+    applyToOne(player, enemy, &P::zoo_level, pick(card.to_player_zoo_lvl, card.to_player_zoo_lvl2), &r.zooP);
+    applyToOne(player, enemy, &P::resource_bricks, pick(card.to_player_bricks, card.to_player_bricks2), &r.bricksP);
+    applyToOne(player, enemy, &P::resource_gems, pick(card.to_player_gems, card.to_player_gems2), &r.gemsP);
+    applyToOne(player, enemy, &P::resource_beasts, pick(card.to_player_beasts, card.to_player_beasts2), &r.beastsP);
+    if (int damage = pick(card.to_player_buildings, card.to_player_buildings2)) {
+        r.damageP = applyArcomageBuildingDamage(player, damage);
+        r.buildingsP = damage - r.damageP;
+    }
+    applyToOne(player, enemy, &P::wall_height, pick(card.to_player_wall, card.to_player_wall2), &r.wallP);
+    applyToOne(player, enemy, &P::tower_height, pick(card.to_player_tower, card.to_player_tower2), &r.towerP);
+
+    applyToOne(enemy, player, &P::quarry_level, pick(card.to_enemy_quarry_lvl, card.to_enemy_quarry_lvl2), &r.quarryE);
+    applyToOne(enemy, player, &P::magic_level, pick(card.to_enemy_magic_lvl, card.to_enemy_magic_lvl2), &r.magicE);
+    applyToOne(enemy, player, &P::zoo_level, pick(card.to_enemy_zoo_lvl, card.to_enemy_zoo_lvl2), &r.zooE);
+    applyToOne(enemy, player, &P::resource_bricks, pick(card.to_enemy_bricks, card.to_enemy_bricks2), &r.bricksE);
+    applyToOne(enemy, player, &P::resource_gems, pick(card.to_enemy_gems, card.to_enemy_gems2), &r.gemsE);
+    applyToOne(enemy, player, &P::resource_beasts, pick(card.to_enemy_beasts, card.to_enemy_beasts2), &r.beastsE);
+    if (int damage = pick(card.to_enemy_buildings, card.to_enemy_buildings2)) {
+        r.damageE = applyArcomageBuildingDamage(enemy, damage);
+        r.buildingsE = damage - r.damageE;
+    }
+    applyToOne(enemy, player, &P::wall_height, pick(card.to_enemy_wall, card.to_enemy_wall2), &r.wallE);
+    applyToOne(enemy, player, &P::tower_height, pick(card.to_enemy_tower, card.to_enemy_tower2), &r.towerE);
+
+    applyToBoth(player, enemy, &P::quarry_level, pick(card.to_pl_enm_quarry_lvl, card.to_pl_enm_quarry_lvl2),
+                &r.quarryP, &r.quarryE);
+    applyToBoth(player, enemy, &P::magic_level, pick(card.to_pl_enm_magic_lvl, card.to_pl_enm_magic_lvl2),
+                &r.magicP, &r.magicE);
+    applyToBoth(player, enemy, &P::zoo_level, pick(card.to_pl_enm_zoo_lvl, card.to_pl_enm_zoo_lvl2),
+                &r.zooP, &r.zooE);
+    applyToBoth(player, enemy, &P::resource_bricks, pick(card.to_pl_enm_bricks, card.to_pl_enm_bricks2),
+                &r.bricksP, &r.bricksE);
+    applyToBoth(player, enemy, &P::resource_gems, pick(card.to_pl_enm_gems, card.to_pl_enm_gems2),
+                &r.gemsP, &r.gemsE);
+    applyToBoth(player, enemy, &P::resource_beasts, pick(card.to_pl_enm_beasts, card.to_pl_enm_beasts2),
+                &r.beastsP, &r.beastsE);
+    if (int damage = pick(card.to_pl_enm_buildings, card.to_pl_enm_buildings2)) {
+        r.damageP = applyArcomageBuildingDamage(player, damage);
+        r.damageE = applyArcomageBuildingDamage(enemy, damage);
+        r.buildingsP = damage - r.damageP;
+        r.buildingsE = damage - r.damageE;
+    }
+    applyToBoth(player, enemy, &P::wall_height, pick(card.to_pl_enm_wall, card.to_pl_enm_wall2),
+                &r.wallP, &r.wallE);
+    applyToBoth(player, enemy, &P::tower_height, pick(card.to_pl_enm_tower, card.to_pl_enm_tower2),
+                &r.towerP, &r.towerE);
+
+    return r;
+}
+
+int calculateArcomageCardPower(const ArcomagePlayer &player, const ArcomagePlayer &enemy, const ArcomageCard &card,
+                               int mastery, int maxTowerHeight) {
+    enum class V_IND {
+        P_TOWER_M10,
+        P_WALL_M10,
+        E_TOWER,
+        E_WALL,
+        E_BUILDINGS,
+        E_QUARRY,
+        E_MAGIC,
+        E_ZOO,
+        E_RES
+    };
+    using enum V_IND;
+
+    // mastery coeffs
+    // base mastery focus on growing walls + tower
+    // second level high priority on resource gen
+    static constexpr IndexedArray<std::array<int, 2>, P_TOWER_M10, E_RES> mastery_coeff = {
+        {P_TOWER_M10,   {{10, 5}}},
+        {P_WALL_M10,    {{2, 1}}},
+        {E_TOWER,       {{1, 10}}},
+        {E_WALL,        {{1, 3}}},
+        {E_BUILDINGS,   {{1, 7}}},
+        {E_QUARRY,      {{1, 5}}},
+        {E_MAGIC,       {{1, 40}}},
+        {E_ZOO,         {{1, 40}}},
+        {E_RES,         {{1, 2}}}
+    };
+
+    int card_power = 0;
+    int element_power = 0;
+
+    if (card.to_player_tower == 99 || card.to_pl_enm_tower == 99 ||
+        card.to_player_tower2 == 99 || card.to_pl_enm_tower2 == 99) {
+        element_power = enemy.tower_height - player.tower_height;
+    } else {
+        element_power = card.to_player_tower + card.to_pl_enm_tower +
+                        card.to_player_tower2 + card.to_pl_enm_tower2;
+    }
+
+    if (player.tower_height >= 10) {
+        card_power += mastery_coeff[P_TOWER_M10][mastery] * element_power;
+    } else {
+        card_power += 20 * element_power;
+    }
+
+    if (card.to_player_wall == 99 || card.to_pl_enm_wall == 99 ||
+        card.to_player_wall2 == 99 || card.to_pl_enm_wall2 == 99) {
+        element_power = enemy.wall_height - player.wall_height;
+    } else {
+        element_power = card.to_player_wall + card.to_pl_enm_wall +
+                        card.to_player_wall2 + card.to_pl_enm_wall2;
+    }
+
+    if (player.wall_height >= 10) {
+        card_power += mastery_coeff[P_WALL_M10][mastery] * element_power;  // 1
+    } else {
+        card_power += 5 * element_power;
+    }
+
+    card_power +=
+        7 * (card.to_player_buildings + card.to_pl_enm_buildings +
+             card.to_player_buildings2 + card.to_pl_enm_buildings2);
+
+    if (card.to_player_quarry_lvl == 99 ||
+        card.to_pl_enm_quarry_lvl == 99 ||
+        card.to_player_quarry_lvl2 == 99 ||
+        card.to_pl_enm_quarry_lvl2 == 99) {
+        element_power = enemy.quarry_level - player.quarry_level;
+    } else {
+        element_power =
+            card.to_player_quarry_lvl + card.to_pl_enm_quarry_lvl +
+            card.to_player_quarry_lvl2 + card.to_pl_enm_quarry_lvl;
+    }
+
+    card_power += 40 * element_power;
+
+    if (card.to_player_magic_lvl == 99 || card.to_pl_enm_magic_lvl == 99 ||
+        card.to_player_magic_lvl2 == 99 ||
+        card.to_pl_enm_magic_lvl2 == 99) {
+        element_power = enemy.magic_level - player.magic_level;
+    } else {
+        element_power =
+            card.to_player_magic_lvl + card.to_pl_enm_magic_lvl +
+            card.to_player_magic_lvl2 + card.to_pl_enm_magic_lvl2;
+    }
+    card_power += 40 * element_power;
+
+    if (card.to_player_zoo_lvl == 99 || card.to_pl_enm_zoo_lvl == 99 ||
+        card.to_player_zoo_lvl2 == 99 || card.to_pl_enm_zoo_lvl2 == 99) {
+        element_power = enemy.zoo_level - player.zoo_level;
+    } else {
+        element_power = card.to_player_zoo_lvl + card.to_pl_enm_zoo_lvl +
+                        card.to_player_zoo_lvl2 + card.to_pl_enm_zoo_lvl2;
+    }
+    card_power += 40 * element_power;
+
+    if (card.to_player_bricks == 99 || card.to_pl_enm_bricks == 99 ||
+        card.to_player_bricks2 == 99 || card.to_pl_enm_bricks2 == 99) {
+        element_power = enemy.resource_bricks - player.resource_bricks;
+    } else {
+        element_power = card.to_player_bricks + card.to_pl_enm_bricks +
+                        card.to_player_bricks2 + card.to_pl_enm_bricks2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_player_gems == 99 || card.to_pl_enm_gems == 99 ||
+        card.to_player_gems2 == 99 || card.to_pl_enm_gems2 == 99) {
+        element_power = enemy.resource_gems - player.resource_gems;
+    } else {
+        element_power = card.to_player_gems + card.to_pl_enm_gems +
+                        card.to_player_gems2 + card.to_pl_enm_gems2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_player_beasts == 99 || card.to_pl_enm_beasts == 99 ||
+        card.to_player_beasts2 == 99 || card.to_pl_enm_beasts2 == 99) {
+        element_power = enemy.resource_beasts - player.resource_beasts;
+    } else {
+        element_power = card.to_player_beasts + card.to_pl_enm_beasts +
+                        card.to_player_beasts2 + card.to_pl_enm_beasts2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_enemy_tower == 99 || card.to_enemy_tower2 == 99) {
+        element_power = player.tower_height - enemy.tower_height;
+    } else {
+        element_power = -(card.to_enemy_tower + card.to_enemy_tower2);
+    }
+    card_power += mastery_coeff[E_TOWER][mastery] * element_power;
+
+    if (card.to_enemy_wall == 99 || card.to_enemy_wall2 == 99) {
+        element_power = player.wall_height - enemy.wall_height;
+    } else {
+        element_power = -(card.to_enemy_wall + card.to_enemy_wall2);
+    }
+    card_power += mastery_coeff[E_WALL][mastery] * element_power;
+
+    card_power -= mastery_coeff[E_BUILDINGS][mastery] *
+                  (card.to_enemy_buildings + card.to_enemy_buildings2);
+
+    if (card.to_enemy_quarry_lvl == 99 || card.to_enemy_quarry_lvl2 == 99) {
+        element_power = player.quarry_level - enemy.quarry_level;  // 5
+    } else {
+        element_power =
+            -(card.to_enemy_quarry_lvl + card.to_enemy_quarry_lvl2);  // 5
+    }
+    card_power += mastery_coeff[E_QUARRY][mastery] * element_power;
+
+    if (card.to_enemy_magic_lvl == 99 || card.to_enemy_magic_lvl2 == 99) {
+        element_power = player.magic_level - enemy.magic_level;  // 40
+    } else {
+        element_power =
+            -(card.to_enemy_magic_lvl + card.to_enemy_magic_lvl2);
+    }
+    card_power += mastery_coeff[E_MAGIC][mastery] * element_power;
+
+    if (card.to_enemy_zoo_lvl == 99 || card.to_enemy_zoo_lvl2 == 99) {
+        element_power = player.zoo_level - enemy.zoo_level;  // 40
+    } else {
+        element_power = -(card.to_enemy_zoo_lvl + card.to_enemy_zoo_lvl2);
+    }
+    card_power += mastery_coeff[E_ZOO][mastery] * element_power;
+
+    if (card.to_enemy_bricks == 99 || card.to_enemy_bricks2 == 99) {
+        element_power = player.resource_bricks - enemy.resource_bricks;  // 2
+    } else {
+        element_power = -(card.to_enemy_bricks + card.to_enemy_bricks2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.to_enemy_gems == 99 || card.to_enemy_gems2 == 99) {
+        element_power = player.resource_gems - enemy.resource_gems;  // 2
+    } else {
+        element_power = -(card.to_enemy_gems + card.to_enemy_gems2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.to_enemy_beasts == 99 || card.to_enemy_beasts2 == 99) {
+        element_power = player.resource_beasts - enemy.resource_beasts;  // 2
+    } else {
+        element_power = -(card.to_enemy_beasts + card.to_enemy_beasts2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.field_30 || card.field_4D) {
+        card_power *= 10;
+    }
+
+    if (card.card_resource_type == 1) {
+        element_power = player.resource_bricks - card.needed_bricks;
+    } else if (card.card_resource_type == 2) {
+        element_power = player.resource_gems - card.needed_gems;
+    } else if (card.card_resource_type == 3) {
+        element_power = player.resource_beasts - card.needed_beasts;
+    }
+    if (element_power > 3) {
+        element_power = 3;
+    }
+    card_power += 5 * element_power;
+
+    if (enemy.tower_height <= card.to_enemy_tower2 + card.to_enemy_tower) {
+        card_power += 9999;
+    }
+
+    if (card.to_enemy_tower2 + card.to_enemy_tower + card.to_enemy_wall +
+            card.to_enemy_wall2 + card.to_enemy_buildings +
+            card.to_enemy_buildings2 >=
+        enemy.wall_height + enemy.tower_height) {
+        card_power += 9999;
+    }
+
+    if ((card.to_player_tower2 + card.to_pl_enm_tower2 +
+         card.to_player_tower + card.to_pl_enm_tower +
+         player.tower_height) >= maxTowerHeight) {
+        card_power += 9999;
+    }
+
+    return card_power;
+}
+
+ArcomageAiMove chooseArcomageAiMove(const ArcomagePlayer &player, const ArcomagePlayer &enemy, bool mustDiscard,
+                                    int mastery, int maxTowerHeight, RandomEngine *rng) {
+    assert(mastery >= 0 && mastery <= 2);
+
+    int cardCount = arcomageHandCardCount(player);
+    assert(cardCount > 0);
+
+    // AI only looks at the first `cardCount` slots, and these might have holes in them after a discard. The original
+    // code didn't check for this, here empty slots are treated as unplayable & not discardable.
+    auto canPlay = [&](int slot) {
+        int id = player.cards_at_hand[slot];
+        return id != -1 && canArcomageCardBePlayed(player, pCards[id]);
+    };
+    auto canDiscard = [&](int slot) {
+        int id = player.cards_at_hand[slot];
+        return id != -1 && pCards[id].can_be_discarded;
+    };
+
+    if (mastery == 0) {
+        // Select card at random to play.
+        if (!mustDiscard) {
+            for (int i = 0; i < 10; ++i) {
+                int slot = rng->randomInSegment(0, cardCount - 1);
+                if (canPlay(slot))
+                    return {slot, false};
+            }
+        }
+
+        // If that fails discard card at random.
+        return {rng->randomInSegment(0, cardCount - 1), true};
+    }
+
+    // Apply some cunning.
+    struct CardPower {
+        int slot;
+        int power;
+    };
+    std::array<CardPower, 10> powers;
+    for (int i = 0; i < cardCount; ++i) {
+        int id = player.cards_at_hand[i];
+        powers[i] = {i, id == -1 ? -9999 : calculateArcomageCardPower(player, enemy, pCards[id], mastery - 1,
+                                                                      maxTowerHeight)};
+    }
+
+    // Order by power, most powerful first. Using a stable sort here so that the order is exactly the same as with the
+    // bubble sort that was used originally.
+    std::stable_sort(powers.begin(), powers.begin() + cardCount, [](const CardPower &l, const CardPower &r) {
+        return l.power > r.power;
+    });
+
+    // If we have to discard pick the least powerful to chuck. Note that the most powerful card is never
+    // considered, and that the loop actually ends up picking the most powerful discardable card out of the rest.
+    // This is how it worked in the original game.
+    int discardSlot = 0;
+    for (int i = cardCount - 1; i > 0; --i)
+        if (canDiscard(powers[i].slot))
+            discardSlot = powers[i].slot;
+
+    if (!mustDiscard) {
+        // Try and play most powerful card. Least powerful card is never played.
+        for (int i = 0; i < cardCount - 1; ++i)
+            if (canPlay(powers[i].slot) && powers[i].power)
+                return {powers[i].slot, false};
+    }
+
+    // Fall back - have to discard.
+    return {discardSlot, true};
+}
+
+bool isArcomageGameOver(const ArcomagePlayer *players, int maxTowerHeight, int maxResources) {
+    for (int i = 0; i < 2; ++i) {
+        const ArcomagePlayer &player = players[i];
+        if (player.tower_height <= 0 || player.tower_height >= maxTowerHeight)
+            return true;
+        if (player.resource_bricks >= maxResources || player.resource_gems >= maxResources ||
+            player.resource_beasts >= maxResources)
+            return true;
+    }
+    return false;
+}
+
+static int arcomageMaxResource(const ArcomagePlayer &player) {
+    // Note that this is not exactly max in case of ties, this is how it worked in the original game.
+    if (player.resource_gems > player.resource_bricks && player.resource_gems > player.resource_beasts)
+        return player.resource_gems;
+    if (player.resource_beasts > player.resource_gems && player.resource_beasts > player.resource_bricks)
+        return player.resource_beasts;
+    return player.resource_bricks;
+}
+
+ArcomageGameResult arcomageGameResult(const ArcomagePlayer *players, int maxTowerHeight, int maxResources) {
+    int tower0 = players[0].tower_height;
+    int tower1 = players[1].tower_height;
+    int wall0 = players[0].wall_height;
+    int wall1 = players[1].wall_height;
+
+    ArcomageGameResult r;
+
+    // Check if the towers were built.
+    if (tower0 < maxTowerHeight && tower1 >= maxTowerHeight) {
+        r = {2, 0};
+    } else if (tower0 >= maxTowerHeight && tower1 < maxTowerHeight) {
+        r = {1, 0};
+    } else if (tower0 >= maxTowerHeight && tower1 >= maxTowerHeight) {
+        if (tower0 == tower1) {
+            r = {0, 4};
+        } else {
+            r = {(tower0 <= tower1) + 1, 0}; // Higher tower wins.
+        }
+    }
+
+    // Check if the towers were destroyed.
+    if (tower0 <= 0 && tower1 > 0) {
+        r = {2, 2};
+    } else if (tower0 > 0 && tower1 <= 0) {
+        r = {1, 2};
+    } else if (tower0 <= 0 && tower1 <= 0) {
+        if (tower0 == tower1) {
+            if (wall0 == wall1) {
+                r = {0, 4};
+            } else {
+                r = {(wall0 <= wall1) + 1, 1}; // Higher wall wins.
+            }
+        } else {
+            r = {(tower0 <= tower1) + 1, 2};
+        }
+    }
+
+    // Check if the resources were gathered.
+    int res0 = arcomageMaxResource(players[0]);
+    int res1 = arcomageMaxResource(players[1]);
+    if (r.winner == -1 && r.victoryType == -1) {
+        if (res0 < maxResources && res1 >= maxResources) {
+            r = {2, 3};
+        } else if (res0 >= maxResources && res1 < maxResources) {
+            r = {1, 3};
+        } else if (res0 >= maxResources && res1 >= maxResources) {
+            if (res0 == res1) {
+                r = {0, 4};
+            } else {
+                r = {(res0 <= res1) + 1, 3};
+            }
+        }
+    } else if (r.winner == 0 && r.victoryType == 4) {
+        // Draw on towers & walls, more resources win.
+        if (res0 != res1)
+            r = {(res0 <= res1) + 1, 5};
+    }
+
+    return r;
+}
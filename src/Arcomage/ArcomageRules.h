@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Arcomage.h"
+
+class RandomEngine;
+
+/**
+ * Changes to the players' stats made by a single card, as computed by `applyArcomageCard`. Suffix `P` is for the
+ * player who played the card, suffix `E` is for the enemy.
+ */
+struct ArcomageCardEffects {
+    bool primary = true; // Whether primary or secondary card effects were applied.
+    int extraCards = 0; // Number of extra cards that the player should draw.
+    int actionsLeft = 0; // Number of extra actions that the player gets, including the draws.
+    int quarryP = 0;
+    int quarryE = 0;
+    int magicP = 0;
+    int magicE = 0;
+    int zooP = 0;
+    int zooE = 0;
+    int bricksP = 0;
+    int bricksE = 0;
+    int gemsP = 0;
+    int gemsE = 0;
+    int beastsP = 0;
+    int beastsE = 0;
+    int wallP = 0;
+    int wallE = 0;
+    int towerP = 0;
+    int towerE = 0;
+    int buildingsP = 0; // Building damage that went to the tower.
+    int buildingsE = 0;
+    int damageP = 0; // Building damage that went to the wall.
+    int damageE = 0;
+};
+
+/**
+ * AI decision, as returned by `chooseArcomageAiMove`.
+ */
+struct ArcomageAiMove {
+    int slot = 0; // Hand slot of the card to play or discard.
+    bool discard = false;
+};
+
+/**
+ * Result of an Arcomage game.
+ */
+struct ArcomageGameResult {
+    int winner = -1; // 1 for the first player, 2 for the second one, 0 for a draw.
+    int victoryType = -1; // 0 - tower built, 1 - more wall when both towers destroyed, 2 - tower destroyed,
+                          // 3 - resources gathered, 4 - draw, 5 - more resources on a draw.
+};
+
+/**
+ * Fills in the master deck. Some cards are present in the deck twice.
+ *
+ * @param[out] deck                     Deck to fill.
+ */
+void fillArcomageMasterDeck(ArcomageDeck *deck);
+
+/**
+ * Shuffles the master deck into the play deck. Cards that are currently in the players' hands are marked as used in
+ * both decks.
+ *
+ * @param[in,out] master                Master deck.
+ * @param[out] play                     Play deck.
+ * @param players                       Both players.
+ * @param rng                           Random engine to use.
+ */
+void shuffleArcomageDeck(ArcomageDeck *master, ArcomageDeck *play, const ArcomagePlayer *players, RandomEngine *rng);
+
+/**
+ * Takes the next unused card from the play deck.
+ *
+ * @param play                          Play deck.
+ * @param[in,out] walkIndex             Current position in the deck, advanced past the returned card.
+ * @return                              Card id, or `-1` if the deck is exhausted and needs to be reshuffled.
+ */
+[[nodiscard]] int takeArcomageDeckCard(const ArcomageDeck &play, int *walkIndex);
+
+[[nodiscard]] int arcomageHandCardCount(const ArcomagePlayer &player);
+
+[[nodiscard]] bool canArcomageCardBePlayed(const ArcomagePlayer &player, const ArcomageCard &card);
+
+/**
+ * Applies damage to the player's wall first, and then to the tower.
+ *
+ * @param player                        Player to damage.
+ * @param damage                        Damage, negative value.
+ * @return                              Part of the damage that went to the wall.
+ */
+int applyArcomageBuildingDamage(ArcomagePlayer *player, int damage);
+
+/**
+ * Applies the stat changes from a played card. Drawing the extra cards is left to the caller.
+ *
+ * @param player                        Player who played the card.
+ * @param enemy                         The other player.
+ * @param card                          Card that was played.
+ * @return                              Effects of the card.
+ */
+ArcomageCardEffects applyArcomageCard(ArcomagePlayer *player, ArcomagePlayer *enemy, const ArcomageCard &card);
+
+/**
+ * AI heuristic for how good it is to play the provided card right now.
+ *
+ * @param player                        AI player.
+ * @param enemy                         AI's opponent.
+ * @param card                          Card to evaluate.
+ * @param mastery                       AI mastery, 0 or 1.
+ * @param maxTowerHeight                Tower height needed to win.
+ * @return                              Card power, higher is better.
+ */
+[[nodiscard]] int calculateArcomageCardPower(const ArcomagePlayer &player, const ArcomagePlayer &enemy,
+                                             const ArcomageCard &card, int mastery, int maxTowerHeight);
+
+/**
+ * Picks the card to play or discard for an AI player.
+ *
+ * @param player                        AI player.
+ * @param enemy                         AI's opponent.
+ * @param mustDiscard                   Whether the AI has to discard a card.
+ * @param mastery                       AI mastery level. 0 plays random cards, 1 and 2 use
+ *                                      `calculateArcomageCardPower`.
+ * @param maxTowerHeight                Tower height needed to win.
+ * @param rng                           Random engine, used for mastery 0.
+ * @return                              AI move. Note that the chosen card might not be discardable, in which case
+ *                                      the move fails and the AI is expected to try again.
+ */
+[[nodiscard]] ArcomageAiMove chooseArcomageAiMove(const ArcomagePlayer &player, const ArcomagePlayer &enemy,
+                                                  bool mustDiscard, int mastery, int maxTowerHeight,
+                                                  RandomEngine *rng);
+
+[[nodiscard]] bool isArcomageGameOver(const ArcomagePlayer *players, int maxTowerHeight, int maxResources);
+
+/**
+ * @param players                       Both players.
+ * @param maxTowerHeight                Tower height needed to win.
+ * @param maxResources                  Resource amount needed to win.
+ * @return                              Game result for a finished game.
+ */
+[[nodiscard]] ArcomageGameResult arcomageGameResult(const ArcomagePlayer *players, int maxTowerHeight,
+                                                    int maxResources);
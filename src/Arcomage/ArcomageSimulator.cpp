@@ -0,0 +1,181 @@
+#include "ArcomageSimulator.h"
+
+#include <cassert>
+#include <algorithm>
+
+/** If an AI gets stuck trying to discard a card that cannot be discarded, the game is stopped after this many moves
+ * in a single turn. The interactive game would just hang in this case. */
+static constexpr int MAX_MOVES_PER_TURN = 100;
+
+void ArcomageSimulationStats::add(const ArcomageSimulationGame &game) {
+    games++;
+    turns += game.turns;
+    if (game.result.winner == -1) {
+        unfinished++;
+    } else if (game.result.winner == 0) {
+        draws++;
+    } else {
+        wins[game.result.winner - 1]++;
+    }
+}
+
+ArcomageSimulationStats &ArcomageSimulationStats::operator+=(const ArcomageSimulationStats &other) {
+    games += other.games;
+    wins[0] += other.wins[0];
+    wins[1] += other.wins[1];
+    draws += other.draws;
+    unfinished += other.unfinished;
+    turns += other.turns;
+    return *this;
+}
+
+ArcomageSimulator::ArcomageSimulator(const ArcomageSimulationConditions &conditions, RandomEngine *rng) :
+    _conditions(conditions), _rng(rng) {
+    assert(rng);
+    fillArcomageMasterDeck(&_masterDeck);
+}
+
+ArcomageSimulationGame ArcomageSimulator::playGame() {
+    startGame();
+
+    ArcomageSimulationGame result;
+    int current = 0;
+    while (result.turns < _conditions.maxTurns) {
+        result.turns++;
+
+        ArcomagePlayer &player = _players[current];
+        player.resource_bricks += _conditions.resourceBonus + player.quarry_level;
+        player.resource_gems += _conditions.resourceBonus + player.magic_level;
+        player.resource_beasts += _conditions.resourceBonus + player.zoo_level;
+
+        // Same structure as in ArcomageGame::Loop.
+        int moves = 0;
+        bool turnNotFinished = true;
+        while (turnNotFinished) {
+            drawCard(current);
+            while (true) {
+                if (++moves > MAX_MOVES_PER_TURN)
+                    return result;
+
+                turnNotFinished = playTurn(current);
+                if (arcomageHandCardCount(player) <= _conditions.minimumCardsAtHand) {
+                    _needToDiscard = false;
+                    break;
+                }
+                _needToDiscard = true;
+            }
+        }
+
+        if (isArcomageGameOver(_players, _conditions.maxTower, _conditions.maxResources)) {
+            result.result = arcomageGameResult(_players, _conditions.maxTower, _conditions.maxResources);
+            return result;
+        }
+
+        current ^= 1;
+    }
+
+    return result;
+}
+
+ArcomageSimulationStats ArcomageSimulator::playGames(int64_t count) {
+    ArcomageSimulationStats result;
+    for (int64_t i = 0; i < count; i++)
+        result.add(playGame());
+    return result;
+}
+
+void ArcomageSimulator::startGame() {
+    for (ArcomagePlayer &player : _players) {
+        player.tower_height = _conditions.towerHeight;
+        player.wall_height = _conditions.wallHeight;
+        player.quarry_level = _conditions.quarryLevel;
+        player.magic_level = _conditions.magicLevel;
+        player.zoo_level = _conditions.zooLevel;
+        player.resource_bricks = _conditions.bricks;
+        player.resource_gems = _conditions.gems;
+        player.resource_beasts = _conditions.beasts;
+        std::ranges::fill(player.cards_at_hand, -1);
+    }
+
+    shuffleArcomageDeck(&_masterDeck, &_playDeck, _players, _rng);
+    _deckWalkIndex = 0;
+    _needToDiscard = false;
+    _actionsLeft = 0;
+
+    // Same as in InitalHandsFill, only the second player gets the initial hand. The first player's hand gets filled
+    // at the start of the first turn.
+    for (int i = 0; i < _conditions.minimumCardsAtHand; i++)
+        drawCard(1);
+}
+
+void ArcomageSimulator::drawCard(int playerIndex) {
+    int cardId;
+    while ((cardId = takeArcomageDeckCard(_playDeck, &_deckWalkIndex)) == -1) {
+        shuffleArcomageDeck(&_masterDeck, &_playDeck, _players, _rng);
+        _deckWalkIndex = 0;
+    }
+
+    // If the hand is full then the card is lost, same as in GetNextCardFromDeck.
+    for (int &slot : _players[playerIndex].cards_at_hand) {
+        if (slot == -1) {
+            slot = cardId;
+            break;
+        }
+    }
+}
+
+bool ArcomageSimulator::playTurn(int playerIndex) {
+    _actionsLeft = 0;
+
+    // In PlayerTurn the hand is refilled once the card drawing animation finishes.
+    while (arcomageHandCardCount(_players[playerIndex]) <= _conditions.minimumCardsAtHand)
+        drawCard(playerIndex);
+
+    while (true) {
+        performMove(playerIndex);
+        if (_actionsLeft <= 1)
+            break;
+        _actionsLeft--;
+    }
+
+    return _actionsLeft > 0;
+}
+
+bool ArcomageSimulator::performMove(int playerIndex) {
+    ArcomagePlayer &player = _players[playerIndex];
+    ArcomagePlayer &enemy = _players[playerIndex ^ 1];
+
+    if (arcomageHandCardCount(player) == 0)
+        return false;
+
+    ArcomageAiMove move = chooseArcomageAiMove(player, enemy, _needToDiscard, _conditions.mastery[playerIndex],
+                                               _conditions.maxTower, _rng);
+    int cardId = player.cards_at_hand[move.slot];
+    if (cardId == -1)
+        return false;
+    const ArcomageCard &card = pCards[cardId];
+
+    if (move.discard) {
+        if (!card.can_be_discarded)
+            return false;
+
+        player.cards_at_hand[move.slot] = -1;
+        _needToDiscard = false;
+        return true;
+    }
+
+    if (!canArcomageCardBePlayed(player, card))
+        return false;
+
+    player.resource_bricks -= card.needed_bricks;
+    player.resource_gems -= card.needed_gems;
+    player.resource_beasts -= card.needed_beasts;
+    player.cards_at_hand[move.slot] = -1;
+
+    ArcomageCardEffects effects = applyArcomageCard(&player, &enemy, card);
+    _actionsLeft = effects.actionsLeft;
+    for (int i = 0; i < effects.extraCards; i++)
+        drawCard(playerIndex);
+    _needToDiscard = arcomageHandCardCount(player) > _conditions.minimumCardsAtHand;
+    return true;
+}
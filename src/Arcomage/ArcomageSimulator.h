@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "ArcomageRules.h"
+
+class RandomEngine;
+
+/**
+ * Start & win conditions for a simulated game, default values are the ones from the Erathia tavern.
+ */
+struct ArcomageSimulationConditions {
+    int maxTower = 50;
+    int maxResources = 150;
+    int towerHeight = 20;
+    int wallHeight = 5;
+    int quarryLevel = 1;
+    int magicLevel = 1;
+    int zooLevel = 1;
+    int bricks = 5;
+    int gems = 5;
+    int beasts = 5;
+    std::array<int, 2> mastery = {{1, 1}}; // AI mastery for each of the players, see `chooseArcomageAiMove`.
+    int minimumCardsAtHand = 5;
+    int resourceBonus = 1; // Added to the resource production levels at the start of each turn.
+    int maxTurns = 1000; // Games that take longer than this are stopped & counted as unfinished.
+};
+
+struct ArcomageSimulationGame {
+    ArcomageGameResult result; // Winner is -1 for an unfinished game.
+    int turns = 0;
+};
+
+struct ArcomageSimulationStats {
+    int64_t games = 0;
+    std::array<int64_t, 2> wins = {{0, 0}};
+    int64_t draws = 0;
+    int64_t unfinished = 0;
+    int64_t turns = 0;
+
+    void add(const ArcomageSimulationGame &game);
+    ArcomageSimulationStats &operator+=(const ArcomageSimulationStats &other);
+};
+
+/**
+ * Headless AI-vs-AI Arcomage.
+ *
+ * Uses the same rules as the in-game Arcomage (see `ArcomageRules.h`), and follows the same turn structure as
+ * `ArcomageGame::Loop`, just without any of the input handling, animations and sounds. This makes it possible to play
+ * out large batches of games to evaluate AI and balance changes.
+ *
+ * Note that the simulator is not bound to the `grng` call sequence of the real game. Card shifts, for example, are
+ * not generated, so a simulation with the same seed won't replay a recorded game.
+ */
+class ArcomageSimulator {
+ public:
+    /**
+     * @param conditions                Start & win conditions.
+     * @param rng                       Random engine to use, must outlive this object.
+     */
+    ArcomageSimulator(const ArcomageSimulationConditions &conditions, RandomEngine *rng);
+
+    /**
+     * Plays a single game. Player 0 moves first.
+     *
+     * @return                          Game result.
+     */
+    ArcomageSimulationGame playGame();
+
+    /**
+     * @param count                     Number of games to play.
+     * @return                          Aggregated stats.
+     */
+    ArcomageSimulationStats playGames(int64_t count);
+
+    [[nodiscard]] const ArcomagePlayer &player(int index) const {
+        return _players[index];
+    }
+
+ private:
+    void startGame();
+    void drawCard(int playerIndex);
+    bool playTurn(int playerIndex);
+    bool performMove(int playerIndex);
+
+ private:
+    ArcomageSimulationConditions _conditions;
+    RandomEngine *_rng = nullptr;
+    ArcomagePlayer _players[2];
+    ArcomageDeck _masterDeck;
+    ArcomageDeck _playDeck;
+    int _deckWalkIndex = 0;
+    bool _needToDiscard = false;
+    int _actionsLeft = 0;
+};
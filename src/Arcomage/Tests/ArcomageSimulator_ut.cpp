@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <array>
+
+#include <fmt/core.h>
+
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Arcomage/ArcomageRules.h"
+#include "Arcomage/ArcomageSimulator.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+UNIT_TEST(ArcomageRules, MasterDeck) {
+    ArcomageDeck deck;
+    fillArcomageMasterDeck(&deck);
+
+    // All 87 cards must be in the deck, 21 of them twice.
+    std::array<int, 87> counts = {};
+    for (int id : deck.cards_IDs) {
+        ASSERT_GE(id, 0);
+        ASSERT_LT(id, 87);
+        counts[id]++;
+    }
+    EXPECT_EQ(std::ranges::count(counts, 1), 66);
+    EXPECT_EQ(std::ranges::count(counts, 2), 21);
+}
+
+UNIT_TEST(ArcomageRules, BuildingDamage) {
+    ArcomagePlayer player;
+    player.tower_height = 20;
+    player.wall_height = 5;
+
+    EXPECT_EQ(applyArcomageBuildingDamage(&player, -3), -3);
+    EXPECT_EQ(player.wall_height, 2);
+    EXPECT_EQ(player.tower_height, 20);
+
+    EXPECT_EQ(applyArcomageBuildingDamage(&player, -10), -2);
+    EXPECT_EQ(player.wall_height, 0);
+    EXPECT_EQ(player.tower_height, 12);
+
+    EXPECT_EQ(applyArcomageBuildingDamage(&player, -100), 0);
+    EXPECT_EQ(player.tower_height, 0);
+}
+
+UNIT_TEST(ArcomageRules, GameResult) {
+    ArcomagePlayer players[2];
+    players[0].tower_height = 50;
+    players[1].tower_height = 20;
+    EXPECT_FALSE(isArcomageGameOver(players, 51, 150));
+    EXPECT_TRUE(isArcomageGameOver(players, 50, 150));
+    EXPECT_EQ(arcomageGameResult(players, 50, 150).winner, 1);
+    EXPECT_EQ(arcomageGameResult(players, 50, 150).victoryType, 0);
+
+    players[0].tower_height = 0;
+    players[0].wall_height = 10;
+    players[1].tower_height = 0;
+    players[1].wall_height = 20;
+    EXPECT_EQ(arcomageGameResult(players, 50, 150).winner, 2);
+    EXPECT_EQ(arcomageGameResult(players, 50, 150).victoryType, 1);
+
+    players[0].tower_height = 10;
+    players[1].tower_height = 10;
+    players[1].resource_gems = 150;
+    EXPECT_TRUE(isArcomageGameOver(players, 50, 150));
+    EXPECT_EQ(arcomageGameResult(players, 50, 150).winner, 2);
+    EXPECT_EQ(arcomageGameResult(players, 50, 150).victoryType, 3);
+}
+
+UNIT_TEST(ArcomageRules, CardEffects) {
+    ArcomagePlayer player, enemy;
+    player.quarry_level = 1;
+    enemy.quarry_level = 3;
+    player.resource_bricks = 10;
+
+    // Mother Lode, primary effect when player's quarry is lower.
+    ArcomageCardEffects effects = applyArcomageCard(&player, &enemy, pCards[4]);
+    EXPECT_TRUE(effects.primary);
+    EXPECT_EQ(effects.quarryP, 2);
+    EXPECT_EQ(player.quarry_level, 3);
+
+    effects = applyArcomageCard(&player, &enemy, pCards[4]);
+    EXPECT_FALSE(effects.primary);
+    EXPECT_EQ(effects.quarryP, 1);
+    EXPECT_EQ(player.quarry_level, 4);
+
+    // Lucky Cache, play again.
+    effects = applyArcomageCard(&player, &enemy, pCards[1]);
+    EXPECT_EQ(effects.actionsLeft, 1);
+    EXPECT_EQ(player.resource_bricks, 12);
+}
+
+UNIT_TEST(ArcomageSimulator, Deterministic) {
+    ArcomageSimulationConditions conditions;
+    conditions.mastery = {{0, 2}};
+
+    MersenneTwisterRandomEngine rng0;
+    MersenneTwisterRandomEngine rng1;
+    rng0.seed(123);
+    rng1.seed(123);
+    ArcomageSimulationStats stats0 = ArcomageSimulator(conditions, &rng0).playGames(200);
+    ArcomageSimulationStats stats1 = ArcomageSimulator(conditions, &rng1).playGames(200);
+
+    EXPECT_EQ(stats0.games, 200);
+    EXPECT_EQ(stats0.wins[0] + stats0.wins[1] + stats0.draws + stats0.unfinished, 200);
+    EXPECT_EQ(stats0.wins, stats1.wins);
+    EXPECT_EQ(stats0.draws, stats1.draws);
+    EXPECT_EQ(stats0.turns, stats1.turns);
+}
+
+// Balance & throughput batch.
+UNIT_BENCHMARK(ArcomageSimulator, Batch) {
+    constexpr int64_t gameCount = 5000;
+
+    MersenneTwisterRandomEngine rng;
+    for (int mastery0 = 0; mastery0 <= 2; mastery0++) {
+        ArcomageSimulationConditions conditions;
+        conditions.mastery = {{mastery0, 2}};
+
+        ArcomageSimulationStats stats;
+        double ns = benchmarkNsPerItem(gameCount, 1, [&] {
+            stats = ArcomageSimulator(conditions, &rng).playGames(gameCount);
+        });
+
+        EXPECT_EQ(stats.games, gameCount);
+        EXPECT_LT(stats.unfinished, gameCount / 100);
+
+        fmt::print("Arcomage mastery {} vs 2: {:.1f}% / {:.1f}% wins, {:.1f}% draws, {:.1f}% unfinished, "
+                   "{:.1f} turns/game\n",
+                   mastery0, 100.0 * stats.wins[0] / stats.games, 100.0 * stats.wins[1] / stats.games,
+                   100.0 * stats.draws / stats.games, 100.0 * stats.unfinished / stats.games,
+                   static_cast<double>(stats.turns) / stats.games);
+        reportBenchmark("ArcomageSimulator::playGames", ns, "game");
+    }
+}
@@ -1,17 +1,96 @@
 #include "LodToolOptions.h"
 
 #include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "Library/Compression/Compression.h"
 #include "Library/Lod/LodReader.h"
+#include "Library/Lod/LodWriter.h"
 #include "Library/LodFormats/LodFormats.h"
 #include "Library/Serialization/Serialization.h"
 
+#include "Utility/Streams/FileOutputStream.h"
+#include "Utility/Exception.h"
 #include "Utility/String/Format.h"
 #include "Utility/String/Ascii.h"
 #include "Utility/String/Transformations.h"
 #include "Utility/UnicodeCrt.h"
 
+struct LodToolEntry {
+    std::string name;
+    Blob data;
+};
+
+static std::vector<LodToolEntry> readEntries(const LodReader &reader) {
+    // Reading is cheap as it doesn't copy anything, so it's done upfront on the main thread.
+    std::vector<LodToolEntry> result;
+    for (std::string &name : reader.ls()) {
+        Blob data = reader.read(name);
+        result.push_back({std::move(name), std::move(data)});
+    }
+    return result;
+}
+
+static bool isCompressed(LodFileFormat format) {
+    return format == LOD_FILE_COMPRESSED || format == LOD_FILE_PSEUDO_IMAGE;
+}
+
+static int resolveJobs(int jobs) {
+    return jobs > 0 ? jobs : std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * Calls `fn(i)` for each `i` in `[0, count)`, spreading the calls across `jobs` threads. If any of the calls throws,
+ * the remaining calls are skipped and the first exception is rethrown once all threads are done.
+ */
+template<class Fn>
+static void parallelFor(size_t count, int jobs, Fn &&fn) {
+    std::atomic<size_t> next = 0;
+    std::mutex mutex;
+    std::exception_ptr exception;
+
+    auto worker = [&] {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                fn(i);
+            } catch (...) {
+                std::lock_guard lock(mutex);
+                if (!exception)
+                    exception = std::current_exception();
+                next = count;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min<size_t>(jobs, count); i++)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread &thread : threads)
+        thread.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+static void printThroughput(std::string_view action, size_t entries, size_t bytes,
+                            std::chrono::steady_clock::duration duration, int jobs) {
+    double seconds = std::chrono::duration<double>(duration).count();
+    double megabytes = bytes / (1024.0 * 1024.0);
+    fmt::print(stderr, "{} {} entries, {:.1f} MiB in {:.2f}s ({:.1f} MiB/s, {} threads)\n",
+               action, entries, megabytes, seconds, seconds > 0 ? megabytes / seconds : 0.0, jobs);
+}
+
 int runLs(const LodToolOptions &options) {
     LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
     fmt::println("{}", fmt::join(reader.ls(), "\n"));
@@ -28,16 +107,15 @@ int runDump(const LodToolOptions &options) {
 
     for (const std::string &name : reader.ls()) {
         Blob data = reader.read(name);
-        LodFileFormat format = lod::magic(data, name);
-        bool isCompressed = format == LOD_FILE_COMPRESSED || format == LOD_FILE_PSEUDO_IMAGE;
-        if (isCompressed)
-            data = lod::decodeCompressed(data);
+        bool compressed = isCompressed(lod::magic(data, name));
+        if (compressed)
+            data = lod::decodeCompressedOrFail(data);
 
         fmt::println("");
         fmt::println("Entry: {}", name);
         fmt::println("Format: {}", toString(lod::magic(data, name)));
-        fmt::println("Size{}: {}", isCompressed ? " (uncompressed)" : "", data.size());
-        fmt::println("Data{}:", isCompressed ? " (uncompressed)" : "");
+        fmt::println("Size{}: {}", compressed ? " (uncompressed)" : "", data.size());
+        fmt::println("Data{}:", compressed ? " (uncompressed)" : "");
 
         std::string line;
         for (size_t offset = 0; offset < data.size(); offset += 16) {
@@ -54,13 +132,141 @@ int runCat(const LodToolOptions &options) {
     LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
     Blob data = reader.read(options.cat.entry);
     if (!options.cat.raw) {
-        LodFileFormat format = lod::magic(data, options.cat.entry);
-        if (format == LOD_FILE_COMPRESSED || format == LOD_FILE_PSEUDO_IMAGE)
-            data = lod::decodeCompressed(data);
+        if (isCompressed(lod::magic(data, options.cat.entry)))
+            data = lod::decodeCompressedOrFail(data);
     }
     return fwrite(data.data(), data.size(), 1, stdout) != 1;
 }
 
+int runVerify(const LodToolOptions &options) {
+    struct VerifyResult {
+        LodFileFormat format = LOD_FILE_RAW;
+        size_t size = 0;
+        uint32_t checksum = 0;
+        std::string error;
+    };
+
+    LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
+    std::vector<LodToolEntry> entries = readEntries(reader);
+    std::vector<VerifyResult> results(entries.size());
+    int jobs = resolveJobs(options.jobs);
+
+    auto start = std::chrono::steady_clock::now();
+    parallelFor(entries.size(), jobs, [&] (size_t i) {
+        const LodToolEntry &entry = entries[i];
+        VerifyResult &result = results[i];
+        try {
+            // Checksums are calculated for the uncompressed data, so that they don't depend on compression settings.
+            result.format = lod::magic(entry.data, entry.name);
+            Blob data = isCompressed(result.format) ? lod::decodeCompressedOrFail(entry.data) : Blob::share(entry.data);
+            if (result.format == LOD_FILE_IMAGE || result.format == LOD_FILE_PALETTE)
+                lod::decodeImage(data);
+            if (result.format == LOD_FILE_SPRITE)
+                lod::decodeSprite(data);
+            result.size = data.size();
+            result.checksum = zlib::crc32(data);
+        } catch (const std::exception &e) {
+            result.error = e.what();
+        }
+    });
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    size_t bytes = 0;
+    size_t failures = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const VerifyResult &result = results[i];
+        if (!result.error.empty()) {
+            fmt::print(stderr, "Entry '{}' is broken: {}\n", entries[i].name, result.error);
+            failures++;
+        } else {
+            fmt::println("{:08X}  {: >10}  {: <21}  {}", result.checksum, result.size, toString(result.format), entries[i].name);
+            bytes += result.size;
+        }
+    }
+
+    printThroughput("Verified", entries.size(), bytes, duration, jobs);
+    if (failures)
+        fmt::print(stderr, "{} entries are broken\n", failures);
+    return failures != 0;
+}
+
+int runExtract(const LodToolOptions &options) {
+    LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
+    std::vector<LodToolEntry> entries = readEntries(reader);
+    int jobs = resolveJobs(options.jobs);
+
+    std::filesystem::create_directories(options.extract.outputDir);
+
+    std::atomic<size_t> bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    parallelFor(entries.size(), jobs, [&] (size_t i) {
+        const LodToolEntry &entry = entries[i];
+        if (entry.name.empty() || entry.name == "." || entry.name == ".." ||
+            entry.name.find_first_of("/\\") != std::string::npos)
+            throw Exception("Cannot extract entry '{}': invalid file name", entry.name);
+
+        Blob data = Blob::share(entry.data);
+        if (!options.extract.raw && isCompressed(lod::magic(data, entry.name)))
+            data = lod::decodeCompressedOrFail(data);
+
+        FileOutputStream output(fmt::format("{}/{}", options.extract.outputDir, entry.name));
+        output.write(data);
+        output.close();
+        bytes += data.size();
+    });
+
+    printThroughput("Extracted", entries.size(), bytes, std::chrono::steady_clock::now() - start, jobs);
+    return 0;
+}
+
+int runRepack(const LodToolOptions &options) {
+    // Output is written in place, so overwriting the input would pull the rug from under the memory-mapped reader.
+    std::error_code ec;
+    if (std::filesystem::equivalent(options.lodPath, options.repack.outputPath, ec))
+        throw Exception("Cannot repack '{}' in place, output must be a different file", options.lodPath);
+
+    LodReader reader(options.lodPath, LOD_ALLOW_DUPLICATES);
+    std::vector<LodToolEntry> entries = readEntries(reader);
+    int jobs = resolveJobs(options.jobs);
+
+    if (options.repack.level >= 0) {
+        // Only LOD_FILE_COMPRESSED entries are recompressed. Images & sprites have their own headers that we can't
+        // write out, so these are copied as is.
+        std::atomic<size_t> count = 0;
+        std::atomic<size_t> bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        parallelFor(entries.size(), jobs, [&] (size_t i) {
+            LodToolEntry &entry = entries[i];
+            if (lod::magic(entry.data, entry.name) != LOD_FILE_COMPRESSED)
+                return;
+
+            Blob data;
+            try {
+                data = lod::decodeCompressedOrFail(entry.data);
+            } catch (const std::exception &e) {
+                throw Exception("Cannot recompress entry '{}': {}", entry.name, e.what());
+            }
+            entry.data = lod::encodeCompressed(data, options.repack.level);
+            count++;
+            bytes += data.size();
+        });
+        printThroughput("Recompressed", count, bytes, std::chrono::steady_clock::now() - start, jobs);
+    }
+
+    LodWriteFlags writeFlags = 0;
+    if (options.repack.deduplicate)
+        writeFlags |= LOD_DEDUPLICATE;
+
+    LodWriter writer(options.repack.outputPath, reader.info(), writeFlags);
+    for (LodToolEntry &entry : entries)
+        writer.write(entry.name, std::move(entry.data));
+    writer.close();
+
+    fmt::print(stderr, "Repacked {} entries, {} -> {} bytes\n", entries.size(),
+               std::filesystem::file_size(options.lodPath), std::filesystem::file_size(options.repack.outputPath));
+    return 0;
+}
+
 int main(int argc, char **argv) {
     try {
         UnicodeCrt _(argc, argv);
@@ -73,6 +279,9 @@ int main(int argc, char **argv) {
         case LodToolOptions::SUBCOMMAND_LS: return runLs(options);
         case LodToolOptions::SUBCOMMAND_DUMP: return runDump(options);
         case LodToolOptions::SUBCOMMAND_CAT: return runCat(options);
+        case LodToolOptions::SUBCOMMAND_VERIFY: return runVerify(options);
+        case LodToolOptions::SUBCOMMAND_EXTRACT: return runExtract(options);
+        case LodToolOptions::SUBCOMMAND_REPACK: return runRepack(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
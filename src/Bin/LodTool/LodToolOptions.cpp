@@ -22,6 +22,23 @@ LodToolOptions LodToolOptions::parse(int argc, char **argv) {
     cat->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
     cat->add_option("ENTRY", result.cat.entry, "Name of the entry to print.")->required()->option_text(" ");
 
+    CLI::App *verify = app->add_subcommand("verify", "Decompress all lod entries and print their checksums.", result.subcommand, SUBCOMMAND_VERIFY)->fallthrough();
+    verify->add_option("-j,--jobs", result.jobs, "Number of worker threads, all cores are used by default.")->check(CLI::NonNegativeNumber)->option_text("JOBS");
+    verify->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+
+    CLI::App *extract = app->add_subcommand("extract", "Extract all lod entries into a folder.", result.subcommand, SUBCOMMAND_EXTRACT)->fallthrough();
+    extract->add_flag("--raw", result.extract.raw, "Don't try decompressing the entries before writing them out.");
+    extract->add_option("-j,--jobs", result.jobs, "Number of worker threads, all cores are used by default.")->check(CLI::NonNegativeNumber)->option_text("JOBS");
+    extract->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+    extract->add_option("DIR", result.extract.outputDir, "Path to output folder, will be created if it doesn't exist.")->required()->option_text(" ");
+
+    CLI::App *repack = app->add_subcommand("repack", "Rebuild a lod file, optionally recompressing & deduplicating its entries.", result.subcommand, SUBCOMMAND_REPACK)->fallthrough();
+    repack->add_option("-l,--level", result.repack.level, "Recompress compressed entries with the given zlib compression level, 0-9. By default compressed entries are copied as is.")->check(CLI::Range(0, 9))->option_text("LEVEL");
+    repack->add_flag("--dedup", result.repack.deduplicate, "Store identical entries only once.");
+    repack->add_option("-j,--jobs", result.jobs, "Number of worker threads, all cores are used by default.")->check(CLI::NonNegativeNumber)->option_text("JOBS");
+    repack->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+    repack->add_option("OUTPUT", result.repack.outputPath, "Path to output lod file.")->required()->option_text(" ");
+
     app->parse(argc, argv, result.helpPrinted);
     return result;
 }
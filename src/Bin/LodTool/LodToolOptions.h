@@ -7,6 +7,9 @@ struct LodToolOptions {
         SUBCOMMAND_LS,
         SUBCOMMAND_DUMP,
         SUBCOMMAND_CAT,
+        SUBCOMMAND_VERIFY,
+        SUBCOMMAND_EXTRACT,
+        SUBCOMMAND_REPACK,
     };
     using enum Subcommand;
 
@@ -15,10 +18,24 @@ struct LodToolOptions {
         bool raw = false;
     };
 
+    struct ExtractOptions {
+        std::string outputDir;
+        bool raw = false;
+    };
+
+    struct RepackOptions {
+        std::string outputPath;
+        int level = -1; // -1 means keep the compressed entries as is.
+        bool deduplicate = false;
+    };
+
     Subcommand subcommand = SUBCOMMAND_DUMP;
     std::string lodPath;
+    int jobs = 0; // Number of worker threads, 0 means use all cores.
     bool helpPrinted = false; // True means that help message was already printed.
     CatOptions cat;
+    ExtractOptions extract;
+    RepackOptions repack;
 
     static LodToolOptions parse(int argc, char **argv);
 };
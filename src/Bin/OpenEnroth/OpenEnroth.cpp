@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cstdio>
 #include <cassert>
 #include <utility>
@@ -6,10 +7,17 @@
 #include <string>
 #include <algorithm>
 #include <chrono>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #include "Application/Startup/GameStarter.h"
 
 #include "Engine/Components/Control/EngineController.h"
+#include "Engine/Components/Profiling/EngineBenchmark.h"
+#include "Engine/Components/Profiling/EngineProfilingComponent.h"
 #include "Engine/Components/Trace/EngineTraceSimplePlayer.h"
 #include "Engine/Components/Trace/EngineTraceRecorder.h"
 #include "Engine/Components/Trace/EngineTraceStateAccessor.h"
@@ -18,8 +26,10 @@
 
 #include "Library/StackTrace/StackTraceOnCrash.h"
 #include "Library/Platform/Application/PlatformApplication.h"
+#include "Library/Serialization/Serialization.h"
 #include "Library/Trace/EventTrace.h"
 
+#include "Utility/Process.h"
 #include "Utility/Streams/FileOutputStream.h"
 #include "Utility/String/Format.h"
 #include "Utility/UnicodeCrt.h"
@@ -60,7 +70,71 @@ static void printTraceDiff(std::string_view current, std::string_view canonical)
     printLines(currentLines, line, 2);
 }
 
+static int runParallelRetrace(const OpenEnrothOptions &options) {
+    // Traces take very different time to retrace, so instead of splitting them evenly between the workers upfront,
+    // we split them into small batches, and each worker spawns a process for the next batch once it's done with the
+    // previous one. This keeps all the workers busy until the very end.
+    constexpr int batchSize = 5;
+    int traceCount = options.retrace.traces.size();
+    int batchCount = (traceCount + batchSize - 1) / batchSize;
+    int jobs = std::min(options.retrace.jobs, batchCount);
+    fmt::println(stderr, "Retracing {} traces in {} batches, {} processes at a time...", traceCount, batchCount, jobs);
+
+    // Each batch process re-parses the original command line, and then picks its own part of the traces.
+    std::vector<std::string> outputs(batchCount);
+    std::vector<char> successes(batchCount); // Not std::vector<bool> b/c we're writing to it from several threads.
+    std::vector<char> finished(batchCount);
+    std::atomic<int> nextBatch = 0;
+    std::mutex mutex;
+    std::condition_variable finishedChanged;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < jobs; i++) {
+        threads.emplace_back([&] {
+            for (int batch = nextBatch++; batch < batchCount; batch = nextBatch++) {
+                std::vector<std::string> commandLine = options.retrace.commandLine;
+                commandLine.insert(commandLine.end(), {"-j", "1", "--shard-index", std::to_string(batch),
+                                                       "--shard-count", std::to_string(batchCount)});
+                try {
+                    successes[batch] = runProcess(commandLine, &outputs[batch]);
+                } catch (const std::exception &e) {
+                    outputs[batch] += fmt::format("{}\n", e.what());
+                    successes[batch] = false;
+                }
+
+                std::lock_guard lock(mutex);
+                finished[batch] = true;
+                finishedChanged.notify_all();
+            }
+        });
+    }
+
+    // Output of each batch is printed in one block once that batch is done. Going in batch order keeps it in the same
+    // order as in a serial run, and it's not interleaved.
+    int status = 0;
+    for (int i = 0; i < batchCount; i++) {
+        {
+            std::unique_lock lock(mutex);
+            finishedChanged.wait(lock, [&] { return finished[i]; });
+        }
+        fmt::print(stderr, "{}", outputs[i]);
+        if (!successes[i])
+            status = 1;
+    }
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    if (options.retrace.checkCanonical && status == 0)
+        fmt::println(stderr, "All traces are in canonical representation.");
+
+    return status;
+}
+
 int runRetrace(const OpenEnrothOptions &options) {
+    if (options.retrace.jobs > 1)
+        return runParallelRetrace(options);
+
     GameStarter starter(options);
 
     int status = 0;
@@ -103,7 +177,7 @@ int runRetrace(const OpenEnrothOptions &options) {
         }
     });
 
-    if (options.retrace.checkCanonical && status == 0)
+    if (options.retrace.checkCanonical && status == 0 && options.retrace.shardCount == 1)
         fmt::println(stderr, "All traces are in canonical representation.");
 
     return status;
@@ -134,6 +208,65 @@ int runPlay(const OpenEnrothOptions &options) {
     return 0;
 }
 
+static void printBenchmarkResult(const EngineBenchmarkTraceResult &result) {
+    fmt::println(stderr, "{} ticks in {:.2f}s, {:.1f} ticks/s.", result.ticks, result.seconds, result.ticksPerSecond);
+    fmt::println(stderr, "    {:<12} {:>8} {:>8} {:>8}", "phase, ms", "p50", "p95", "p99");
+    fmt::println(stderr, "    {:<12} {:>8.3f} {:>8.3f} {:>8.3f}", "frame", result.frameTimes.p50, result.frameTimes.p95, result.frameTimes.p99);
+    for (EnginePhase phase : result.phaseTimes.indices()) {
+        const EngineBenchmarkTimes &times = result.phaseTimes[phase];
+        fmt::println(stderr, "    {:<12} {:>8.3f} {:>8.3f} {:>8.3f}", toString(phase), times.p50, times.p95, times.p99);
+    }
+}
+
+int runBench(const OpenEnrothOptions &options) {
+    GameStarter starter(options);
+
+    EngineBenchmark benchmark;
+
+    starter.runInstrumented([&benchmark, options, application = starter.application()] (EngineController *game) {
+        EngineTracePlayer *player = application->component<EngineTracePlayer>();
+        EngineProfilingComponent *profiler = application->component<EngineProfilingComponent>();
+
+        for (const std::string &tracePath : options.bench.traces) {
+            fmt::println(stderr, "Benchmarking '{}'...", tracePath);
+
+            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+
+            EngineTraceRecording recording;
+            recording.save = Blob::fromFile(savePath);
+            recording.trace = Blob::fromFile(tracePath);
+
+            player->playTrace(game, recording, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS, [&] {
+                engine->config->graphics.FPSLimit.setValue(0);
+                profiler->startProfiling();
+            });
+            std::vector<EngineFrameSample> samples = profiler->finishProfiling();
+
+            std::string traceName = std::filesystem::path(tracePath).filename().generic_string();
+            const EngineBenchmarkTraceResult &result = benchmark.traces.emplace_back(EngineBenchmark::computeTraceResult(traceName, samples));
+            printBenchmarkResult(result);
+        }
+    });
+
+    if (!options.bench.output.empty())
+        FileOutputStream(options.bench.output).write(EngineBenchmark::toJsonBlob(benchmark));
+
+    if (options.bench.baseline.empty())
+        return 0;
+
+    EngineBenchmark baseline = EngineBenchmark::fromJsonBlob(Blob::fromFile(options.bench.baseline));
+    std::vector<EngineBenchmarkRegression> regressions = EngineBenchmark::compare(baseline, benchmark, options.bench.tolerance);
+    for (const EngineBenchmarkRegression &regression : regressions)
+        fmt::println(stderr, "Regression in '{}': {} is {:.3f}, baseline is {:.3f}.",
+                     regression.trace, regression.metric, regression.current, regression.baseline);
+
+    if (!regressions.empty())
+        return 1;
+
+    fmt::println(stderr, "No regressions against baseline '{}'.", options.bench.baseline);
+    return 0;
+}
+
 int runOpenEnroth(const OpenEnrothOptions &options) {
     GameStarter(options).run();
     return 0;
@@ -152,6 +285,7 @@ int openEnrothMain(int argc, char **argv) {
         case OpenEnrothOptions::SUBCOMMAND_GAME: return runOpenEnroth(options);
         case OpenEnrothOptions::SUBCOMMAND_PLAY: return runPlay(options);
         case OpenEnrothOptions::SUBCOMMAND_RETRACE: return runRetrace(options);
+        case OpenEnrothOptions::SUBCOMMAND_BENCH: return runBench(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
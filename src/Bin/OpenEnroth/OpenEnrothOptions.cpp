@@ -3,6 +3,7 @@
 #include <memory>
 #include <utility>
 #include <ranges>
+#include <span>
 #include <vector>
 #include <string>
 
@@ -11,8 +12,19 @@
 #include "Library/Cli/CliApp.h"
 
 #include "Utility/Exception.h"
+#include "Utility/Shard.h"
 #include "Utility/String/Format.h"
 
+static void listTraces(const std::string &traceDir, std::vector<std::string> *traces) {
+    if (traceDir.empty())
+        return;
+
+    for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(traceDir))
+        if (entry.path().extension() == ".json")
+            traces->push_back(entry.path().generic_string());
+    std::ranges::sort(*traces); // NOLINT: This is ranges::sort. We want a fixed order.
+}
+
 OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     OpenEnrothOptions result;
     std::unique_ptr<CliApp> app = std::make_unique<CliApp>();
@@ -61,6 +73,16 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     retrace->add_flag(
         "--check-canonical", result.retrace.checkCanonical,
         "Check whether all passed traces are stored in canonical representation and return an error if not. Don't overwrite the actual trace files.");
+    retrace->add_option(
+        "-j,--jobs", result.retrace.jobs,
+        "Number of worker processes to retrace in, default is '1'. Traces are retraced in batches of 5, output of each "
+        "batch is printed out in one block once it's done.")->check(CLI::PositiveNumber)->multi_option_policy(CLI::MultiOptionPolicy::TakeLast)->option_text("JOBS");
+    retrace->add_option(
+        "--shard-index", result.retrace.shardIndex,
+        "Index of the current batch.")->group(""); // Hidden, for internal use only.
+    retrace->add_option(
+        "--shard-count", result.retrace.shardCount,
+        "Total number of batches.")->group("");
     retrace->add_option(
         "--ls", traceDir,
         "Directory to look for traces to retrace."); // This is here so that we don't have to jump through hoops in cmake.
@@ -69,6 +91,25 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
         "Path to trace file(s) to retrace.")->option_text("...");
     retrace->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
 
+    std::string benchTraceDir;
+    CLI::App *bench = app->add_subcommand("bench", "Play provided traces headless as fast as possible, report timings and exit.", result.subcommand, SUBCOMMAND_BENCH)->fallthrough();
+    bench->add_option(
+        "--output", result.bench.output,
+        "Path to write benchmark results to, in json format.")->option_text("PATH");
+    bench->add_option(
+        "--baseline", result.bench.baseline,
+        "Path to baseline benchmark results to compare against. Returns an error if any of the timings regressed.")->check(CLI::ExistingFile)->option_text("PATH");
+    bench->add_option(
+        "--tolerance", result.bench.tolerance,
+        "Relative tolerance to use when comparing against the baseline, default is '0.1'.")->check(CLI::NonNegativeNumber)->option_text("TOLERANCE");
+    bench->add_option(
+        "--ls", benchTraceDir,
+        "Directory to look for traces to benchmark.");
+    bench->add_option(
+        "TRACE", result.bench.traces,
+        "Path to trace file(s) to benchmark.")->option_text("...");
+    bench->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
+
     app->parse(argc, argv, result.helpPrinted);
 
     if (!portable && std::filesystem::exists(".portable"))
@@ -83,15 +124,32 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     if (result.subcommand == SUBCOMMAND_RETRACE) {
         result.ramFsUserData = true; // No config & no user data if retracing.
 
-        if (!traceDir.empty()) {
-            for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(traceDir))
-                if (entry.path().extension() == ".json")
-                    result.retrace.traces.push_back(entry.path().generic_string());
-            std::ranges::sort(result.retrace.traces); // NOLINT: This is ranges::sort. We want a fixed order.
-        }
-
+        listTraces(traceDir, &result.retrace.traces);
         if (result.retrace.traces.empty())
             throw Exception("No trace files to retrace.");
+
+        if (result.retrace.shardCount > 1) {
+            // We're retracing a single batch, only keep our part of the traces. Contiguous parts are used so that the
+            // combined output of all the batches comes in the same order as if it was a single process.
+            if (result.retrace.shardIndex < 0 || result.retrace.shardIndex >= result.retrace.shardCount)
+                throw Exception("Invalid shard index {} for shard count {}.", result.retrace.shardIndex, result.retrace.shardCount);
+
+            std::span<const std::string> traces = shard(std::span<const std::string>(result.retrace.traces),
+                                                         result.retrace.shardIndex, result.retrace.shardCount);
+            result.retrace.traces = std::vector<std::string>(traces.begin(), traces.end());
+        }
+
+        if (result.retrace.jobs > 1)
+            result.retrace.commandLine.assign(argv, argv + argc);
+    }
+
+    if (result.subcommand == SUBCOMMAND_BENCH) {
+        result.ramFsUserData = true; // No config & no user data if benchmarking.
+        result.headless = true; // We're measuring the engine, not the GPU driver.
+
+        listTraces(benchTraceDir, &result.bench.traces);
+        if (result.bench.traces.empty())
+            throw Exception("No trace files to benchmark.");
     }
 
     if (result.subcommand == SUBCOMMAND_PLAY)
@@ -12,13 +12,18 @@ struct OpenEnrothOptions : public GameStarterOptions {
     enum class Subcommand {
         SUBCOMMAND_GAME,
         SUBCOMMAND_PLAY,
-        SUBCOMMAND_RETRACE
+        SUBCOMMAND_RETRACE,
+        SUBCOMMAND_BENCH
     };
     using enum Subcommand;
 
     struct RetraceOptions {
         std::vector<std::string> traces;
         bool checkCanonical = false;
+        int jobs = 1; // Number of worker processes to run at the same time.
+        int shardIndex = 0; // Index of the current batch, traces not in this batch are skipped.
+        int shardCount = 1; // Total number of batches.
+        std::vector<std::string> commandLine; // Original command line, used to spawn worker processes.
     };
 
     struct PlayOptions {
@@ -26,10 +31,18 @@ struct OpenEnrothOptions : public GameStarterOptions {
         float speed = 1.0f;
     };
 
+    struct BenchOptions {
+        std::vector<std::string> traces;
+        std::string output; // Path to write benchmark results to, empty means don't write.
+        std::string baseline; // Path to baseline benchmark results to compare against, empty means don't compare.
+        float tolerance = 0.1f;
+    };
+
     Subcommand subcommand = SUBCOMMAND_GAME;
     bool helpPrinted = false; // True means that help message was already printed.
     RetraceOptions retrace;
     PlayOptions play;
+    BenchOptions bench;
 
     /**
      * Parses OpenEnroth command line options.
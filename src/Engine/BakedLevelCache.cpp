@@ -0,0 +1,96 @@
+#include "BakedLevelCache.h"
+
+#include <cassert>
+#include <cstring>
+#include <array>
+#include <exception>
+#include <string>
+
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/LodFormats/LodFormats.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/String/Format.h"
+
+static constexpr std::array<char, 4> BAKED_LEVEL_MAGIC = {'O', 'E', 'L', 'C'};
+static constexpr uint32_t BAKED_LEVEL_VERSION = 1;
+
+struct BakedLevelHeader {
+    std::array<char, 4> magic = {};
+    uint32_t version = 0;
+    uint64_t sourceSize = 0;
+    uint64_t sourceHash = 0;
+    uint64_t dataSize = 0;
+};
+static_assert(sizeof(BakedLevelHeader) == 32);
+
+static uint64_t hashSource(const Blob &blob) {
+    // 64-bit FNV-1a. We're hashing compressed data, so it's a lot cheaper than decompressing it.
+    uint64_t result = 14695981039346656037ull;
+    const unsigned char *data = static_cast<const unsigned char *>(blob.data());
+    for (size_t i = 0; i < blob.size(); i++) {
+        result ^= data[i];
+        result *= 1099511628211ull;
+    }
+    return result;
+}
+
+BakedLevelCache::BakedLevelCache(FileSystem *fs) : _fs(fs) {
+    assert(fs);
+}
+
+Blob BakedLevelCache::decode(std::string_view name, const Blob &source) {
+    if (Blob cached = lookup(name, source))
+        return cached;
+
+    Blob result = lod::decodeCompressed(source);
+    store(name, source, result);
+    return result;
+}
+
+Blob BakedLevelCache::lookup(std::string_view name, const Blob &source) {
+    if (lod::magic(source, {}) == LOD_FILE_RAW)
+        return Blob::share(source); // Not compressed, nothing to cache.
+
+    std::string path = fmt::format("cache/levels/{}", name);
+    if (!_fs->exists(path))
+        return Blob();
+
+    try {
+        Blob cached = _fs->read(path);
+
+        BakedLevelHeader header;
+        if (cached.size() >= sizeof(header))
+            std::memcpy(&header, cached.data(), sizeof(header));
+
+        if (header.magic == BAKED_LEVEL_MAGIC && header.version == BAKED_LEVEL_VERSION &&
+            header.sourceSize == source.size() && header.sourceHash == hashSource(source) &&
+            header.dataSize == cached.size() - sizeof(header))
+            return cached.subBlob(sizeof(header));
+    } catch (const std::exception &e) {
+        // Cache is just an optimization, so we don't fail on errors here.
+        logger->warning("Could not read baked level '{}': {}", _fs->displayPath(path), e.what());
+    }
+
+    return Blob();
+}
+
+void BakedLevelCache::store(std::string_view name, const Blob &source, const Blob &data) {
+    if (lod::magic(source, {}) == LOD_FILE_RAW)
+        return;
+
+    std::string path = fmt::format("cache/levels/{}", name);
+
+    BakedLevelHeader header;
+    header.magic = BAKED_LEVEL_MAGIC;
+    header.version = BAKED_LEVEL_VERSION;
+    header.sourceSize = source.size();
+    header.sourceHash = hashSource(source);
+    header.dataSize = data.size();
+
+    try {
+        _fs->write(path, Blob::concat(Blob::view(&header, sizeof(header)), data));
+    } catch (const std::exception &e) {
+        logger->warning("Could not write baked level '{}': {}", _fs->displayPath(path), e.what());
+    }
+}
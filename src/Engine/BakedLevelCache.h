@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string_view>
+
+#include "Utility/Memory/Blob.h"
+
+class FileSystem;
+
+/**
+ * Cache of decompressed level files (`.blv`, `.odm`, and their `.dlv` / `.ddm` deltas) in the user file system.
+ *
+ * The MM7 level formats are already flat & relocatable - all the cross-references are indices, and pointers are
+ * fixed up in `reconstruct`. What takes time on map entry is decompression, and this cache is there to skip it. Cached
+ * files are read with `FileSystem::read`, which for the directory file system means `Blob::fromFile`, i.e. the data
+ * is memory-mapped and is not copied.
+ *
+ * Cached files are validated against a hash of the compressed source entry, so mods that replace level files
+ * don't need to clear the cache.
+ */
+class BakedLevelCache {
+ public:
+    /**
+     * @param fs                        File system to store cached files in.
+     */
+    explicit BakedLevelCache(FileSystem *fs);
+
+    /**
+     * Same as `lod::decodeCompressed`, but goes through the cache.
+     *
+     * @param name                      Name of the level file, e.g. `d01.blv`.
+     * @param source                    Level file as it's stored in the LOD.
+     * @return                          Decompressed level file.
+     * @throw Exception                 If the provided `Blob` is of unsupported type.
+     */
+    [[nodiscard]] Blob decode(std::string_view name, const Blob &source);
+
+    /**
+     * Looks up a level file in the cache, without decompressing it on a cache miss.
+     *
+     * @param name                      Name of the level file.
+     * @param source                    Level file as it's stored in the LOD.
+     * @return                          Decompressed level file, or an empty `Blob` if it's not in the cache.
+     */
+    [[nodiscard]] Blob lookup(std::string_view name, const Blob &source);
+
+    /**
+     * Stores a decompressed level file in the cache. Write errors are logged, but are not fatal.
+     *
+     * @param name                      Name of the level file.
+     * @param source                    Level file as it's stored in the LOD.
+     * @param data                      Decompressed level file, as returned by `lod::decodeCompressed`.
+     */
+    void store(std::string_view name, const Blob &source, const Blob &data);
+
+ private:
+    FileSystem *_fs = nullptr;
+};
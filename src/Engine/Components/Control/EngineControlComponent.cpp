@@ -62,10 +62,9 @@ bool EngineControlComponent::hasControlRoutine() const {
 }
 
 void EngineControlComponent::processSyntheticEvents(PlatformEventHandler *eventHandler, int count) {
-    while (!_state->postedEvents.empty() && count != 0) {
-        std::unique_ptr<PlatformEvent> event = std::move(_state->postedEvents.front());
-        _state->postedEvents.pop();
-        eventHandler->event(event.get());
+    EnginePostedEvent event;
+    while (count != 0 && _state->postedEvents.tryPop(&event)) {
+        eventHandler->event(enginePostedEventPtr(event));
         count--; // Negative count will never get to zero, as intended.
     }
 }
@@ -6,10 +6,14 @@
 #include <functional>
 #include <memory>
 #include <exception>
+#include <type_traits>
+#include <variant>
+
+#include "Library/Platform/Interface/PlatformEvents.h"
 
 #include "Utility/IndexedArray.h"
+#include "Utility/MpscQueue.h"
 
-class PlatformEvent;
 class EngineController;
 
 enum class EngineControlSide {
@@ -18,8 +22,32 @@ enum class EngineControlSide {
 };
 using enum EngineControlSide;
 
+/**
+ * Event posted from a control routine. Events that `EngineController` synthesizes itself are stored by value, so that
+ * posting them doesn't allocate. Everything else, e.g. events loaded from a trace, is passed around as a pointer.
+ */
+using EnginePostedEvent =
+    std::variant<std::unique_ptr<PlatformEvent>, PlatformKeyEvent, PlatformMouseEvent, PlatformResizeEvent>;
+
+/**
+ * @param event                         Posted event.
+ * @return                              Pointer to the underlying platform event, never `nullptr` for events that were
+ *                                      actually posted.
+ */
+inline const PlatformEvent *enginePostedEventPtr(const EnginePostedEvent &event) {
+    return std::visit([]<class T>(const T &value) -> const PlatformEvent * {
+        if constexpr (std::is_same_v<T, std::unique_ptr<PlatformEvent>>) {
+            return value.get();
+        } else {
+            return &value;
+        }
+    }, event);
+}
+
 class EngineControlState {
  public:
+    static constexpr size_t MAX_POSTED_EVENTS = 4096;
+
     using ControlRoutine = std::function<void(EngineController *)>;
     using GameRoutine = std::function<void()>;
 
@@ -39,8 +67,9 @@ class EngineControlState {
 
     // Control thread -> main thread communication.
 
-    /** Posted events, these are added from the control thread and are then consumed in the main thread. */
-    std::queue<std::unique_ptr<PlatformEvent>> postedEvents;
+    /** Posted events, these are added from the control thread and are then consumed in the main thread. Slots are
+     * preallocated, so a control routine can post at most `MAX_POSTED_EVENTS` events between two ticks. */
+    MpscQueue<EnginePostedEvent> postedEvents{MAX_POSTED_EVENTS};
 
     /** A way to run some code in the main thread w/o really leaving the control routine.
      * If this function is valid, yielding execution from the control thread will run it w/o proceeding to the next
@@ -39,70 +39,75 @@ void EngineController::tick(int count) {
     }
 }
 
-void EngineController::postEvent(std::unique_ptr<PlatformEvent> event) {
-    _state->postedEvents.push(std::move(event));
+void EngineController::postEvent(EnginePostedEvent event) {
+    assert(enginePostedEventPtr(event));
+
+    // The game thread is suspended while we're running, so there's no point in waiting for it to free up a slot.
+    if (!_state->postedEvents.tryPush(std::move(event)))
+        throw Exception("Too many events posted in a single frame, at most {} are supported",
+                        EngineControlState::MAX_POSTED_EVENTS);
 }
 
 void EngineController::pressKey(PlatformKey key) {
-    std::unique_ptr<PlatformKeyEvent> event = std::make_unique<PlatformKeyEvent>();
-    event->type = EVENT_KEY_PRESS;
-    event->window = ::application->window();
-    event->key = key;
-    event->mods = 0;
-    event->isAutoRepeat = false;
-    postEvent(std::move(event));
+    PlatformKeyEvent event;
+    event.type = EVENT_KEY_PRESS;
+    event.window = ::application->window();
+    event.key = key;
+    event.mods = 0;
+    event.isAutoRepeat = false;
+    postEvent(event);
 }
 
 void EngineController::pressAutoRepeatedKey(PlatformKey key) {
-    std::unique_ptr<PlatformKeyEvent> event = std::make_unique<PlatformKeyEvent>();
-    event->type = EVENT_KEY_PRESS;
-    event->window = ::application->window();
-    event->key = key;
-    event->mods = 0;
-    event->isAutoRepeat = true;
-    postEvent(std::move(event));
+    PlatformKeyEvent event;
+    event.type = EVENT_KEY_PRESS;
+    event.window = ::application->window();
+    event.key = key;
+    event.mods = 0;
+    event.isAutoRepeat = true;
+    postEvent(event);
 }
 
 void EngineController::releaseKey(PlatformKey key) {
-    std::unique_ptr<PlatformKeyEvent> event = std::make_unique<PlatformKeyEvent>();
-    event->type = EVENT_KEY_RELEASE;
-    event->window = ::application->window();
-    event->key = key;
-    event->mods = 0;
-    event->isAutoRepeat = false;
-    postEvent(std::move(event));
+    PlatformKeyEvent event;
+    event.type = EVENT_KEY_RELEASE;
+    event.window = ::application->window();
+    event.key = key;
+    event.mods = 0;
+    event.isAutoRepeat = false;
+    postEvent(event);
 }
 
 void EngineController::pressButton(PlatformMouseButton button, int x, int y) {
-    std::unique_ptr<PlatformMouseEvent> event = std::make_unique<PlatformMouseEvent>();
-    event->type = EVENT_MOUSE_BUTTON_PRESS;
-    event->window = ::application->window();
-    event->button = BUTTON_LEFT;
-    event->pos = Pointi(x, y);
-    event->isDoubleClick = false;
-    postEvent(std::move(event));
+    PlatformMouseEvent event;
+    event.type = EVENT_MOUSE_BUTTON_PRESS;
+    event.window = ::application->window();
+    event.button = BUTTON_LEFT;
+    event.pos = Pointi(x, y);
+    event.isDoubleClick = false;
+    postEvent(event);
 }
 
 void EngineController::releaseButton(PlatformMouseButton button, int x, int y) {
-    std::unique_ptr<PlatformMouseEvent> event = std::make_unique<PlatformMouseEvent>();
-    event->type = EVENT_MOUSE_BUTTON_RELEASE;
-    event->window = ::application->window();
-    event->button = BUTTON_LEFT;
-    event->buttons = BUTTON_LEFT;
-    event->pos = Pointi(x, y);
-    event->isDoubleClick = false;
-    postEvent(std::move(event));
+    PlatformMouseEvent event;
+    event.type = EVENT_MOUSE_BUTTON_RELEASE;
+    event.window = ::application->window();
+    event.button = BUTTON_LEFT;
+    event.buttons = BUTTON_LEFT;
+    event.pos = Pointi(x, y);
+    event.isDoubleClick = false;
+    postEvent(event);
 }
 
 void EngineController::moveMouse(int x, int y) {
-    std::unique_ptr<PlatformMouseEvent> event = std::make_unique<PlatformMouseEvent>();
-    event->type = EVENT_MOUSE_MOVE;
-    event->window = ::application->window();
-    event->button = BUTTON_NONE;
-    event->buttons = BUTTON_NONE;
-    event->pos = Pointi(x, y);
-    event->isDoubleClick = false;
-    postEvent(std::move(event));
+    PlatformMouseEvent event;
+    event.type = EVENT_MOUSE_MOVE;
+    event.window = ::application->window();
+    event.button = BUTTON_NONE;
+    event.buttons = BUTTON_NONE;
+    event.pos = Pointi(x, y);
+    event.isDoubleClick = false;
+    postEvent(event);
 }
 
 void EngineController::pressAndReleaseKey(PlatformKey key) {
@@ -239,11 +244,11 @@ void EngineController::resizeWindow(int w, int h) {
     runGameRoutine([=] { ::application->window()->resize({w, h});});
 
     // Spontaneous events are ignored, gotta post one.
-    std::unique_ptr<PlatformResizeEvent> event = std::make_unique<PlatformResizeEvent>();
-    event->type = EVENT_WINDOW_RESIZE;
-    event->window = ::application->window();
-    event->size = {w, h};
-    postEvent(std::move(event));
+    PlatformResizeEvent event;
+    event.type = EVENT_WINDOW_RESIZE;
+    event.window = ::application->window();
+    event.size = {w, h};
+    postEvent(event);
 }
 
 GUIButton *EngineController::existingButton(std::string_view buttonId) {
@@ -34,7 +34,14 @@ class EngineController {
      */
     void tick(int count = 1);
 
-    void postEvent(std::unique_ptr<PlatformEvent> event);
+    /**
+     * Posts an event to be processed by the game thread on the next tick.
+     *
+     * @param event                     Event to post.
+     * @throws Exception                If too many events were posted since the last tick, see
+     *                                  `EngineControlState::MAX_POSTED_EVENTS`.
+     */
+    void postEvent(EnginePostedEvent event);
     void pressKey(PlatformKey key);
     void pressAutoRepeatedKey(PlatformKey key);
     void releaseKey(PlatformKey key);
@@ -0,0 +1,144 @@
+#include "EngineBenchmark.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Library/Json/Json.h"
+
+// Timing differences below this threshold are considered noise, no matter what the relative tolerance is. Phase
+// timings are often in the microseconds range, and we don't want to report these as regressions.
+static constexpr double MIN_REGRESSION_MS = 0.05;
+
+static double toMilliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+static EngineBenchmarkTimes computeTimes(std::vector<double> times) {
+    EngineBenchmarkTimes result;
+    if (times.empty())
+        return result;
+
+    // Nearest-rank percentiles, so that all reported values are actual frame times.
+    std::ranges::sort(times);
+    auto percentile = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * times.size()));
+        return times[std::clamp<size_t>(rank, 1, times.size()) - 1];
+    };
+
+    result.p50 = percentile(0.50);
+    result.p95 = percentile(0.95);
+    result.p99 = percentile(0.99);
+    return result;
+}
+
+MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(EngineBenchmarkTimes, (
+    (p50, "p50"),
+    (p95, "p95"),
+    (p99, "p99")
+))
+
+static void to_json(Json &json, const IndexedArray<EngineBenchmarkTimes, ENGINE_PHASE_FIRST, ENGINE_PHASE_LAST> &value) {
+    json = Json::object();
+    for (EnginePhase phase : value.indices())
+        to_json(json[toString(phase)], value[phase]);
+}
+
+static void from_json(const Json &json, IndexedArray<EngineBenchmarkTimes, ENGINE_PHASE_FIRST, ENGINE_PHASE_LAST> &value) {
+    if (!json.is_object())
+        throwJsonDeserializationError(json, "EnginePhaseTimes");
+
+    for (EnginePhase phase : value.indices())
+        if (json.contains(toString(phase)))
+            from_json(json[toString(phase)], value[phase]);
+}
+
+MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(EngineBenchmarkTraceResult, (
+    (trace, "trace"),
+    (ticks, "ticks"),
+    (seconds, "seconds"),
+    (ticksPerSecond, "ticksPerSecond"),
+    (frameTimes, "frameTimes"),
+    (phaseTimes, "phaseTimes")
+))
+
+MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(EngineBenchmark, (
+    (traces, "traces")
+))
+
+Blob EngineBenchmark::toJsonBlob(const EngineBenchmark &benchmark) {
+    Json json;
+    to_json(json, benchmark);
+    return Blob::fromString(json.dump(/*indent=*/4));
+}
+
+EngineBenchmark EngineBenchmark::fromJsonBlob(const Blob &blob) {
+    Json json = Json::parse(blob.string_view());
+
+    EngineBenchmark result;
+    from_json(json, result);
+    return result;
+}
+
+EngineBenchmarkTraceResult EngineBenchmark::computeTraceResult(std::string_view trace, std::span<const EngineFrameSample> samples) {
+    EngineBenchmarkTraceResult result;
+    result.trace = trace;
+    result.ticks = static_cast<int>(samples.size());
+
+    std::vector<double> times;
+    times.reserve(samples.size());
+
+    for (const EngineFrameSample &sample : samples)
+        times.push_back(toMilliseconds(sample.frameTime));
+    for (double time : times)
+        result.seconds += time / 1000.0;
+    result.frameTimes = computeTimes(std::move(times));
+
+    for (EnginePhase phase : result.phaseTimes.indices()) {
+        times.clear();
+        for (const EngineFrameSample &sample : samples)
+            times.push_back(toMilliseconds(sample.phaseTimes[phase]));
+        result.phaseTimes[phase] = computeTimes(std::move(times));
+    }
+
+    if (result.seconds > 0)
+        result.ticksPerSecond = result.ticks / result.seconds;
+    return result;
+}
+
+std::vector<EngineBenchmarkRegression> EngineBenchmark::compare(const EngineBenchmark &baseline, const EngineBenchmark &current,
+                                                                double tolerance) {
+    assert(tolerance >= 0);
+
+    std::vector<EngineBenchmarkRegression> result;
+
+    auto checkTime = [&](const std::string &trace, const std::string &metric, double baselineTime, double currentTime) {
+        if (currentTime > baselineTime * (1 + tolerance) && currentTime - baselineTime > MIN_REGRESSION_MS)
+            result.push_back({trace, metric, baselineTime, currentTime});
+    };
+
+    auto checkTimes = [&](const std::string &trace, const std::string &prefix, const EngineBenchmarkTimes &baselineTimes,
+                          const EngineBenchmarkTimes &currentTimes) {
+        checkTime(trace, prefix + ".p50", baselineTimes.p50, currentTimes.p50);
+        checkTime(trace, prefix + ".p95", baselineTimes.p95, currentTimes.p95);
+        checkTime(trace, prefix + ".p99", baselineTimes.p99, currentTimes.p99);
+    };
+
+    for (const EngineBenchmarkTraceResult &currentTrace : current.traces) {
+        auto pos = std::ranges::find(baseline.traces, currentTrace.trace, &EngineBenchmarkTraceResult::trace);
+        if (pos == baseline.traces.end())
+            continue;
+        const EngineBenchmarkTraceResult &baselineTrace = *pos;
+
+        if (currentTrace.ticksPerSecond < baselineTrace.ticksPerSecond * (1 - tolerance))
+            result.push_back({currentTrace.trace, "ticksPerSecond", baselineTrace.ticksPerSecond, currentTrace.ticksPerSecond});
+
+        checkTimes(currentTrace.trace, "frameTimes", baselineTrace.frameTimes, currentTrace.frameTimes);
+        for (EnginePhase phase : currentTrace.phaseTimes.indices())
+            checkTimes(currentTrace.trace, toString(phase), baselineTrace.phaseTimes[phase], currentTrace.phaseTimes[phase]);
+    }
+
+    return result;
+}
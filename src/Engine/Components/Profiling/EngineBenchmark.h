@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Engine/EngineProfiler.h"
+
+#include "Utility/IndexedArray.h"
+#include "Utility/Memory/Blob.h"
+
+/**
+ * Timings of a single game loop iteration, as recorded by `EngineProfilingComponent`.
+ */
+struct EngineFrameSample {
+    std::chrono::nanoseconds frameTime = {};
+    EnginePhaseTimes phaseTimes = {{}};
+};
+
+/**
+ * Frame time distribution, all values are in milliseconds.
+ */
+struct EngineBenchmarkTimes {
+    double p50 = 0;
+    double p95 = 0;
+    double p99 = 0;
+};
+
+struct EngineBenchmarkTraceResult {
+    /** Name of the benchmarked trace file. */
+    std::string trace;
+
+    /** Number of game ticks, one tick is one iteration of the game loop. */
+    int ticks = 0;
+
+    /** Wall time spent running the trace, in seconds. */
+    double seconds = 0;
+
+    double ticksPerSecond = 0;
+
+    /** Total frame times, this includes time spent outside of profiled phases. */
+    EngineBenchmarkTimes frameTimes;
+
+    IndexedArray<EngineBenchmarkTimes, ENGINE_PHASE_FIRST, ENGINE_PHASE_LAST> phaseTimes = {{}};
+};
+
+struct EngineBenchmarkRegression {
+    std::string trace;
+    std::string metric; // E.g. "ticksPerSecond" or "ai.p95".
+    double baseline = 0;
+    double current = 0;
+};
+
+/**
+ * Results of a benchmark run, as written out by `OpenEnroth bench`.
+ */
+struct EngineBenchmark {
+    static Blob toJsonBlob(const EngineBenchmark &benchmark);
+    static EngineBenchmark fromJsonBlob(const Blob &blob);
+
+    /**
+     * @param trace                     Name of the trace that was benchmarked.
+     * @param samples                   Frame samples recorded while playing back the trace.
+     * @return                          Benchmark results for a single trace.
+     */
+    static EngineBenchmarkTraceResult computeTraceResult(std::string_view trace, std::span<const EngineFrameSample> samples);
+
+    /**
+     * Compares two benchmark runs. Traces that are missing from either of the runs are ignored.
+     *
+     * @param baseline                  Baseline benchmark results.
+     * @param current                   Current benchmark results.
+     * @param tolerance                 Relative tolerance, e.g. `0.1` means that timings that are up to 10% worse than
+     *                                  the baseline are not considered regressions.
+     * @return                          List of regressions, empty if none were found.
+     */
+    static std::vector<EngineBenchmarkRegression> compare(const EngineBenchmark &baseline, const EngineBenchmark &current,
+                                                          double tolerance);
+
+    std::vector<EngineBenchmarkTraceResult> traces;
+};
@@ -0,0 +1,50 @@
+#include "EngineProfilingComponent.h"
+
+#include <utility>
+
+#include "Engine/Engine.h"
+
+EngineProfilingComponent::EngineProfilingComponent() = default;
+EngineProfilingComponent::~EngineProfilingComponent() = default;
+
+void EngineProfilingComponent::startProfiling() {
+    _profiling = true;
+    _started = false;
+    _samples.clear();
+    _lastTotals = _profiler.totals();
+    engine->profiler = &_profiler;
+}
+
+std::vector<EngineFrameSample> EngineProfilingComponent::finishProfiling() {
+    if (!_profiling)
+        return {};
+
+    if (engine && engine->profiler == &_profiler)
+        engine->profiler = nullptr;
+    _profiling = false;
+    return std::move(_samples);
+}
+
+void EngineProfilingComponent::swapBuffers() {
+    if (_profiling) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        const EnginePhaseTimes &totals = _profiler.totals();
+
+        if (_started) {
+            EngineFrameSample &sample = _samples.emplace_back();
+            sample.frameTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - _lastFrameTime);
+            for (EnginePhase phase : totals.indices())
+                sample.phaseTimes[phase] = totals[phase] - _lastTotals[phase];
+        }
+
+        _started = true;
+        _lastTotals = totals;
+        _lastFrameTime = now;
+    }
+
+    ProxyOpenGLContext::swapBuffers();
+}
+
+void EngineProfilingComponent::removeNotify() {
+    finishProfiling(); // Does nothing if already finished.
+}
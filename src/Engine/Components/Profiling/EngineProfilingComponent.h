@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "Engine/EngineProfiler.h"
+
+#include "Library/Platform/Proxy/ProxyOpenGLContext.h"
+#include "Library/Platform/Application/PlatformApplicationAware.h"
+
+#include "EngineBenchmark.h"
+
+/**
+ * Component that records per-frame timings of the game loop, split by engine phase.
+ *
+ * While profiling, it installs its own `EngineProfiler` into `engine->profiler`, and takes a sample at each call to
+ * `swapBuffers`. Frame time is wall time between two consecutive `swapBuffers` calls.
+ */
+class EngineProfilingComponent : private ProxyOpenGLContext, private PlatformApplicationAware {
+ public:
+    EngineProfilingComponent();
+    virtual ~EngineProfilingComponent();
+
+    /**
+     * Starts profiling. First sample will be taken on the second call to `swapBuffers`, as the first one only marks
+     * the start of the first frame.
+     */
+    void startProfiling();
+
+    /**
+     * Stops profiling. Does nothing if profiling wasn't started.
+     *
+     * @return                          Frame samples recorded since the last call to `startProfiling`.
+     */
+    std::vector<EngineFrameSample> finishProfiling();
+
+    [[nodiscard]] bool isProfiling() const {
+        return _profiling;
+    }
+
+ private:
+    friend class PlatformIntrospection; // Give access to private bases.
+
+    virtual void swapBuffers() override;
+    virtual void removeNotify() override;
+
+ private:
+    bool _profiling = false;
+    bool _started = false;
+    EngineProfiler _profiler;
+    EnginePhaseTimes _lastTotals = {{}};
+    std::chrono::steady_clock::time_point _lastFrameTime;
+    std::vector<EngineFrameSample> _samples;
+};
@@ -0,0 +1,98 @@
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Components/Profiling/EngineBenchmark.h"
+
+static std::vector<EngineFrameSample> makeSamples(int count) {
+    // Frame #i takes i+1 ms, AI takes half of that.
+    std::vector<EngineFrameSample> result;
+    for (int i = 0; i < count; i++) {
+        EngineFrameSample &sample = result.emplace_back();
+        sample.frameTime = std::chrono::milliseconds(i + 1);
+        sample.phaseTimes[ENGINE_PHASE_AI] = std::chrono::microseconds((i + 1) * 500);
+    }
+    return result;
+}
+
+UNIT_TEST(EngineBenchmark, Empty) {
+    EngineBenchmarkTraceResult result = EngineBenchmark::computeTraceResult("empty.json", {});
+    EXPECT_EQ(result.trace, "empty.json");
+    EXPECT_EQ(result.ticks, 0);
+    EXPECT_EQ(result.ticksPerSecond, 0);
+    EXPECT_EQ(result.frameTimes.p99, 0);
+}
+
+UNIT_TEST(EngineBenchmark, Percentiles) {
+    std::vector<EngineFrameSample> samples = makeSamples(200);
+    std::swap(samples[0], samples[150]); // Order shouldn't matter.
+
+    EngineBenchmarkTraceResult result = EngineBenchmark::computeTraceResult("trace.json", samples);
+    EXPECT_EQ(result.ticks, 200);
+    EXPECT_DOUBLE_EQ(result.seconds, 200 * 201 / 2 / 1000.0);
+    EXPECT_DOUBLE_EQ(result.ticksPerSecond, 200 / result.seconds);
+    EXPECT_DOUBLE_EQ(result.frameTimes.p50, 100);
+    EXPECT_DOUBLE_EQ(result.frameTimes.p95, 190);
+    EXPECT_DOUBLE_EQ(result.frameTimes.p99, 198);
+    EXPECT_DOUBLE_EQ(result.phaseTimes[ENGINE_PHASE_AI].p50, 50);
+    EXPECT_DOUBLE_EQ(result.phaseTimes[ENGINE_PHASE_AI].p99, 99);
+    EXPECT_DOUBLE_EQ(result.phaseTimes[ENGINE_PHASE_GUI].p99, 0);
+}
+
+UNIT_TEST(EngineBenchmark, SingleSample) {
+    EngineBenchmarkTraceResult result = EngineBenchmark::computeTraceResult("trace.json", makeSamples(1));
+    EXPECT_DOUBLE_EQ(result.frameTimes.p50, 1);
+    EXPECT_DOUBLE_EQ(result.frameTimes.p99, 1);
+    EXPECT_DOUBLE_EQ(result.ticksPerSecond, 1000);
+}
+
+UNIT_TEST(EngineBenchmark, Compare) {
+    EngineBenchmark baseline;
+    baseline.traces.push_back(EngineBenchmark::computeTraceResult("a.json", makeSamples(100)));
+    baseline.traces.push_back(EngineBenchmark::computeTraceResult("b.json", makeSamples(100)));
+
+    EngineBenchmark current = baseline;
+    EXPECT_TRUE(EngineBenchmark::compare(baseline, current, 0.0).empty());
+
+    current.traces[0].ticksPerSecond *= 0.95;
+    current.traces[1].phaseTimes[ENGINE_PHASE_AI].p95 *= 1.5;
+    current.traces.push_back(EngineBenchmark::computeTraceResult("c.json", makeSamples(10))); // Not in baseline.
+    EXPECT_TRUE(EngineBenchmark::compare(baseline, current, 0.6).empty());
+
+    std::vector<EngineBenchmarkRegression> regressions = EngineBenchmark::compare(baseline, current, 0.1);
+    ASSERT_EQ(regressions.size(), 1);
+    EXPECT_EQ(regressions[0].trace, "b.json");
+    EXPECT_EQ(regressions[0].metric, "ai.p95");
+
+    regressions = EngineBenchmark::compare(baseline, current, 0.01);
+    ASSERT_EQ(regressions.size(), 2);
+    EXPECT_EQ(regressions[0].trace, "a.json");
+    EXPECT_EQ(regressions[0].metric, "ticksPerSecond");
+
+    // Improvements are not regressions.
+    EXPECT_TRUE(EngineBenchmark::compare(current, baseline, 0.0).empty());
+}
+
+UNIT_TEST(EngineBenchmark, CompareNoise) {
+    EngineBenchmark baseline;
+    baseline.traces.push_back(EngineBenchmark::computeTraceResult("a.json", makeSamples(100)));
+    baseline.traces[0].phaseTimes[ENGINE_PHASE_GUI].p50 = 0.001;
+
+    EngineBenchmark current = baseline;
+    current.traces[0].phaseTimes[ENGINE_PHASE_GUI].p50 = 0.002; // 2x slower, but still well below a millisecond.
+    EXPECT_TRUE(EngineBenchmark::compare(baseline, current, 0.1).empty());
+}
+
+UNIT_TEST(EngineBenchmark, Json) {
+    EngineBenchmark benchmark;
+    benchmark.traces.push_back(EngineBenchmark::computeTraceResult("a.json", makeSamples(100)));
+
+    EngineBenchmark loaded = EngineBenchmark::fromJsonBlob(EngineBenchmark::toJsonBlob(benchmark));
+    ASSERT_EQ(loaded.traces.size(), 1);
+    EXPECT_EQ(loaded.traces[0].trace, "a.json");
+    EXPECT_EQ(loaded.traces[0].ticks, 100);
+    EXPECT_DOUBLE_EQ(loaded.traces[0].frameTimes.p95, benchmark.traces[0].frameTimes.p95);
+    EXPECT_DOUBLE_EQ(loaded.traces[0].phaseTimes[ENGINE_PHASE_AI].p99, benchmark.traces[0].phaseTimes[ENGINE_PHASE_AI].p99);
+    EXPECT_TRUE(EngineBenchmark::compare(benchmark, loaded, 0.0).empty());
+}
@@ -1,11 +1,14 @@
 #include <cstring>
 #include <string>
 #include <algorithm>
+#include <chrono>
 #include <memory>
+#include <utility>
 
 #include "Engine/Engine.h"
 
 #include "Engine/EngineGlobals.h"
+#include "Engine/EngineProfiler.h"
 #include "Engine/AssetsManager.h"
 
 #include "Engine/Events/Processor.h"
@@ -29,6 +32,8 @@
 #include "Engine/Graphics/Weather.h"
 #include "Engine/Graphics/PortalFunctions.h"
 #include "Engine/Graphics/TurnBasedOverlay.h"
+#include "Engine/LevelPreloader.h"
+#include "Engine/LOD.h"
 #include "Engine/LodTextureCache.h"
 #include "Engine/LodSpriteCache.h"
 #include "Engine/Localization.h"
@@ -81,6 +86,7 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/BuildInfo/BuildInfo.h"
+#include "Library/Lod/LodReader.h"
 
 #include "Utility/String/Transformations.h"
 
@@ -178,7 +184,34 @@ void Engine::drawWorld() {
             decal_builder->DrawBloodsplats();
         }
         render->DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene();
+
+        if (!PauseGameDrawing())
+            updateSaveThumbnail();
     }
+
+    // Billboard list & camera are final at this point, mouse picking tiles need to be rebuilt.
+    vis->invalidatePickingTiles();
+}
+
+void Engine::updateSaveThumbnail() {
+    // Thumbnail doesn't need to be up to date to the frame, and most of the time it's not used at all.
+    static constexpr int SAVE_THUMBNAIL_INTERVAL = 30;
+
+    if (_saveThumbnailPending || (_saveThumbnail && ++_saveThumbnailFrames < SAVE_THUMBNAIL_INTERVAL))
+        return;
+
+    ScreenCaptureRequest request;
+    request.area = Recti(pViewport->uViewportTL_X, pViewport->uViewportTL_Y, game_viewport_width, game_viewport_height);
+    request.size = Sizei(150, 112);
+    request.callback = [this, generation = _saveThumbnailGeneration] (ScreenCaptureResult result) {
+        _saveThumbnailPending = false;
+        if (generation == _saveThumbnailGeneration)
+            _saveThumbnail = std::move(result.image);
+    };
+
+    _saveThumbnailPending = true;
+    _saveThumbnailFrames = 0;
+    render->captureScreenAsync(std::move(request));
 }
 
 void Engine::drawOverlay() {
@@ -200,11 +233,21 @@ void Engine::drawHUD() {
 
 //----- (0044103C) --------------------------------------------------------
 void Engine::Draw() {
-    drawWorld();
-    drawHUD();
-    render->flushAndScale();
-    drawOverlay();
+    {
+        EngineProfilerScope profilerScope(profiler, ENGINE_PHASE_DRAW_PREP);
+        drawWorld();
+    }
+    {
+        EngineProfilerScope profilerScope(profiler, ENGINE_PHASE_GUI);
+        drawHUD();
+        render->flushAndScale();
+        drawOverlay();
+    }
     render->swapBuffers();
+
+    // Everything allocated from the frame arena is dead by now.
+    _frameArenaStats = frameArena().stats();
+    frameArena().reset();
 }
 
 
@@ -276,6 +319,11 @@ void Engine::DrawGUI() {
                                  fmt::format("Party yaw/pitch:     {} {}", pParty->_viewYaw, pParty->_viewPitch));
         debug_info_offset += 16;
 
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White,
+                                 fmt::format("Frame arena:           {} allocs, {} KiB, {} overflows", _frameArenaStats.allocations,
+                                             _frameArenaStats.bytesUsed / 1024, _frameArenaStats.overflows));
+        debug_info_offset += 16;
+
         if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
             int sector_id = pBLVRenderParams->uPartySectorID;
             pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
@@ -496,6 +544,24 @@ void Engine::toggleOverlays() {
     _overlaySystem.setEnabled(!isEnabled);
 }
 
+void Engine::preloadMap(MapId mapId) {
+    // This is called every frame when the party is close to the map edge, so lookups below are only done when the
+    // destination changes.
+    if (mapId == _preloadMapId)
+        return;
+    _preloadMapId = mapId;
+
+    if (mapId == MAP_INVALID || mapId == _currentLoadedMapId || !_levelPreloader)
+        return;
+
+    std::string fileName = pMapStats->pInfos[mapId].fileName;
+    if (_levelPreloader->isPreloading(fileName) || !pGames_LOD->exists(fileName))
+        return;
+
+    // LOD reads are not thread-safe, so the compressed data is read here & the rest is done on a worker thread.
+    _levelPreloader->preload(fileName, pGames_LOD->read(fileName));
+}
+
 /*
 Result::Code Game::PickKeyboard(bool bOutline, struct unnamed_F93E6C *a3, struct
 unnamed_F93E6C *a4)
@@ -524,10 +590,13 @@ void UpdateUserInput_and_MapSpecificStuff() {
 
     UpdateObjects();
 
-    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR)
-        BLV_UpdateUserInputAndOther();
-    else if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR)
-        ODM_UpdateUserInputAndOther();
+    {
+        EngineProfilerScope profilerScope(engine->profiler, ENGINE_PHASE_COLLISIONS);
+        if (uCurrentlyLoadedLevelType == LEVEL_INDOOR)
+            BLV_UpdateUserInputAndOther();
+        else if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR)
+            ODM_UpdateUserInputAndOther();
+    }
 
     checkDecorationEvents();
     evaluateAoeDamage();
@@ -563,11 +632,16 @@ void DoPrepareWorld(bool bLoading, int _1_fullscreen_loading_2_box) {
     pParty->floor_face_id = 0; // TODO(captainurist): drop?
 
     engine->_currentLoadedMapId = engine->_transitionMapId;
+    engine->_preloadMapId = MAP_INVALID;
 
+    auto loadStartTime = std::chrono::steady_clock::now();
     if (isMapIndoor(engine->_transitionMapId))
         loadAndPrepareBLV(engine->_transitionMapId, bLoading);
     else
         loadAndPrepareODM(engine->_transitionMapId, bLoading, 0);
+    auto loadEndTime = std::chrono::steady_clock::now();
+    logger->info("Map '{}' loaded in {}ms.", pMapStats->pInfos[engine->_currentLoadedMapId].fileName,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(loadEndTime - loadStartTime).count());
 
     pNPCStats->setNPCNamesOnLoad();
     engine->_461103_load_level_sub();
@@ -778,6 +852,7 @@ void Engine::Initialize() {
     _outdoor = std::make_unique<OutdoorLocation>();
     _stationaryLights = std::make_unique<LightsStack_StationaryLight_>();
     _mobileLights = std::make_unique<LightsStack_MobileLight_>();
+    _levelPreloader = std::make_unique<LevelPreloader>(ufs);
 
     ::pIndoor = _indoor.get();
     ::pOutdoor = _outdoor.get();
@@ -852,6 +927,11 @@ void Engine::ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows() {
 
     // Render billboards are used in hit tests, but we're releasing textures, so can't use them anymore.
     render->uNumBillboardsToDraw = 0;
+    vis->invalidatePickingTiles();
+
+    // Thumbnail of the previous level shouldn't end up in the saves made on the new one.
+    _saveThumbnail = RgbaImage();
+    _saveThumbnailGeneration++;
 
     pBitmaps_LOD->releaseUnreserved();
     pSprites_LOD->releaseUnreserved();
@@ -13,6 +13,9 @@
 #include "Engine/mm7_data.h"
 #include "Engine/Time/Time.h"
 
+#include "Library/Image/Image.h"
+
+#include "Utility/Memory/Arena.h"
 #include "Utility/Memory/Blob.h"
 
 namespace Io {
@@ -36,6 +39,8 @@ class GUIMessageQueue;
 class GameResourceManager;
 class StatusBar;
 class EngineCallObserver;
+class EngineProfiler;
+class LevelPreloader;
 struct IndoorLocation;
 struct OutdoorLocation;
 struct LightsStack_StationaryLight_;
@@ -107,6 +112,32 @@ class Engine {
 
     void toggleOverlays();
 
+    /**
+     * Starts preloading the provided map in the background. Should be called when it's likely that the party is
+     * about to travel to this map. Does nothing if `mapId` is the same as in the previous call.
+     *
+     * @param mapId                     Map to preload.
+     * @see LevelPreloader
+     */
+    void preloadMap(MapId mapId);
+
+    /**
+     * Save game thumbnails are captured asynchronously every few frames, so that saving doesn't need to re-render the
+     * world & stall on the pixel readback.
+     *
+     * @return                          Recent thumbnail of the game viewport for the current map, or an empty image
+     *                                  if there is none yet.
+     */
+    [[nodiscard]] RgbaImageView saveThumbnail() const {
+        return _saveThumbnail;
+    }
+
+    /**
+     * Requests a new save game thumbnail if the current one is outdated. Should be called after the world is drawn,
+     * but before the HUD.
+     */
+    void updateSaveThumbnail();
+
     bool is_underwater = false;
     bool is_saturate_faces = false;
     bool is_fog = false; // keeps track of whether fog enabled in d3d
@@ -119,6 +150,7 @@ class Engine {
     DecalBuilder *decal_builder = nullptr;
     SpellFxRenderer *spell_fx_renedrer = nullptr;
     EngineCallObserver *callObserver = nullptr;
+    EngineProfiler *profiler = nullptr;
     std::shared_ptr<Io::Mouse> mouse;
     std::shared_ptr<ParticleEngine> particle_engine;
     Vis *vis = nullptr;
@@ -140,6 +172,13 @@ class Engine {
     std::unique_ptr<OutdoorLocation> _outdoor;
     std::unique_ptr<LightsStack_StationaryLight_> _stationaryLights;
     std::unique_ptr<LightsStack_MobileLight_> _mobileLights;
+    std::unique_ptr<LevelPreloader> _levelPreloader;
+    MapId _preloadMapId = MAP_INVALID; // Map from the last `preloadMap` call, reset on map load.
+    ArenaStats _frameArenaStats; // Frame arena stats for the previous frame, shown in the debug overlay.
+    RgbaImage _saveThumbnail;
+    int _saveThumbnailGeneration = 0; // Incremented on level change, captures from older generations are dropped.
+    int _saveThumbnailFrames = 0; // Frames since the last save thumbnail capture was requested.
+    bool _saveThumbnailPending = false;
 };
 
 extern Engine *engine;
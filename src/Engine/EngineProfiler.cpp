@@ -0,0 +1,12 @@
+#include "EngineProfiler.h"
+
+#include "Library/Serialization/EnumSerialization.h"
+
+MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(EnginePhase, CASE_SENSITIVE, {
+    {ENGINE_PHASE_EVENTS, "events"},
+    {ENGINE_PHASE_AI, "ai"},
+    {ENGINE_PHASE_OBJECTS, "objects"},
+    {ENGINE_PHASE_COLLISIONS, "collisions"},
+    {ENGINE_PHASE_DRAW_PREP, "draw_prep"},
+    {ENGINE_PHASE_GUI, "gui"}
+})
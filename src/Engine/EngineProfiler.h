@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+
+#include "Library/Serialization/SerializationFwd.h"
+
+#include "Utility/IndexedArray.h"
+
+enum class EnginePhase {
+    ENGINE_PHASE_EVENTS,        // Queued messages & event timers.
+    ENGINE_PHASE_AI,            // Actor AI.
+    ENGINE_PHASE_OBJECTS,       // Sprite objects, e.g. projectiles.
+    ENGINE_PHASE_COLLISIONS,    // Party movement & collisions.
+    ENGINE_PHASE_DRAW_PREP,     // 3D world, this is where visibility, lighting & draw lists are computed.
+    ENGINE_PHASE_GUI,           // HUD, GUI windows & overlays.
+
+    ENGINE_PHASE_FIRST = ENGINE_PHASE_EVENTS,
+    ENGINE_PHASE_LAST = ENGINE_PHASE_GUI
+};
+using enum EnginePhase;
+MM_DECLARE_SERIALIZATION_FUNCTIONS(EnginePhase)
+
+using EnginePhaseTimes = IndexedArray<std::chrono::nanoseconds, ENGINE_PHASE_FIRST, ENGINE_PHASE_LAST>;
+
+/**
+ * Accumulates wall time spent in different phases of the game loop.
+ *
+ * The engine doesn't own a profiler, it only reports into `engine->profiler` if one is installed. This is done by
+ * `EngineProfilingComponent`.
+ *
+ * @see EngineProfilerScope
+ */
+class EngineProfiler {
+ public:
+    void add(EnginePhase phase, std::chrono::nanoseconds time) {
+        _totals[phase] += time;
+    }
+
+    /**
+     * @return                          Total time spent in each of the phases since this profiler was created.
+     */
+    [[nodiscard]] const EnginePhaseTimes &totals() const {
+        return _totals;
+    }
+
+ private:
+    EnginePhaseTimes _totals = {{}};
+};
+
+/**
+ * RAII helper that reports the time spent in the current scope to the provided profiler. Does nothing if the
+ * profiler is null, so it's OK to use it in the game loop unconditionally.
+ *
+ * Example usage:
+ * ```
+ * void UpdateObjects() {
+ *     EngineProfilerScope profilerScope(engine->profiler, ENGINE_PHASE_OBJECTS);
+ *     ...
+ * }
+ * ```
+ */
+class EngineProfilerScope {
+ public:
+    EngineProfilerScope(EngineProfiler *profiler, EnginePhase phase) : _profiler(profiler), _phase(phase) {
+        if (_profiler)
+            _start = std::chrono::steady_clock::now();
+    }
+
+    ~EngineProfilerScope() {
+        if (_profiler)
+            _profiler->add(_phase, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start));
+    }
+
+    EngineProfilerScope(const EngineProfilerScope &) = delete;
+    EngineProfilerScope &operator=(const EngineProfilerScope &) = delete;
+
+ private:
+    EngineProfiler *_profiler = nullptr;
+    EnginePhase _phase = ENGINE_PHASE_EVENTS;
+    std::chrono::steady_clock::time_point _start;
+};
@@ -0,0 +1,64 @@
+#include "DecorationTriggerGrid.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+void DecorationTriggerGrid::clear() {
+    _all.clear();
+    _byOthers.clear();
+    _byTouch.clear();
+}
+
+void DecorationTriggerGrid::add(int id, Vec3f position, float triggerRange, bool byTouch, bool byOthers) {
+    assert(_all.empty() || _all.back() < id);
+
+    _all.push_back(id);
+
+    if (byOthers)
+        _byOthers.push_back(id);
+
+    if (byTouch)
+        for (int x = cell(position.x - triggerRange); x <= cell(position.x + triggerRange); x++)
+            for (int y = cell(position.y - triggerRange); y <= cell(position.y + triggerRange); y++)
+                _byTouch[cellKey(x, y)].push_back(id);
+}
+
+void DecorationTriggerGrid::forEachCandidate(const std::function<Vec3f()> &partyPos,
+                                             const std::function<void(int, bool)> &check) const {
+    // Both lists are sorted, so merging them gives the same order as a full sweep over _all.
+    static const std::vector<int> emptyCell;
+    Vec3f startPos = partyPos();
+    auto cellPos = _byTouch.find(cellKey(cell(startPos.x), cell(startPos.y)));
+    const std::vector<int> &touchCandidates = cellPos == _byTouch.end() ? emptyCell : cellPos->second;
+
+    auto touchPos = touchCandidates.begin();
+    auto othersPos = _byOthers.begin();
+    while (touchPos != touchCandidates.end() || othersPos != _byOthers.end()) {
+        int touchId = touchPos == touchCandidates.end() ? INT32_MAX : *touchPos;
+        int othersId = othersPos == _byOthers.end() ? INT32_MAX : *othersPos;
+        int id = std::min(touchId, othersId);
+
+        check(id, id == touchId);
+
+        if (partyPos() != startPos) {
+            // Party was teleported, grid cell is stale. Fall back to a full sweep for the rest.
+            for (auto pos = std::upper_bound(_all.begin(), _all.end(), id); pos != _all.end(); pos++)
+                check(*pos, true);
+            return;
+        }
+
+        if (id == touchId)
+            touchPos++;
+        if (id == othersId)
+            othersPos++;
+    }
+}
+
+int DecorationTriggerGrid::cell(float coordinate) {
+    return static_cast<int>(std::floor(coordinate / CELL_SIZE));
+}
+
+int64_t DecorationTriggerGrid::cellKey(int x, int y) {
+    return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Spatial index for event decorations, so that the per-frame decoration check doesn't have to look at all of them.
+ *
+ * Touch-triggered decorations are put into a coarse 2D grid, each decoration being added to all the cells that its
+ * trigger range overlaps. Decorations triggered by monsters or objects have to be checked every frame anyway, so they
+ * are kept in a separate list.
+ */
+class DecorationTriggerGrid {
+ public:
+    static constexpr float CELL_SIZE = 1024.0f;
+
+    void clear();
+
+    /**
+     * Adds an event decoration. Decorations must be added in increasing id order.
+     *
+     * @param id                        Decoration id.
+     * @param position                  Decoration position.
+     * @param triggerRange              Distance at which the decoration is triggered.
+     * @param byTouch                   Whether the decoration is triggered by the party.
+     * @param byOthers                  Whether the decoration is triggered by monsters or objects.
+     */
+    void add(int id, Vec3f position, float triggerRange, bool byTouch, bool byOthers);
+
+    /**
+     * Calls `check` for all decorations that might trigger, in id order. Results are the same as for a linear sweep
+     * over all added decorations.
+     *
+     * If `check` moves the party, e.g. through a teleport event, the party's grid cell is stale, and so the rest of the
+     * decorations are checked with a linear sweep.
+     *
+     * @param partyPos                  Returns the current party position.
+     * @param check                     Checks the decoration with the provided id. Second argument is whether touch
+     *                                  triggers should be checked - it's `false` for decorations that are not in the
+     *                                  party's grid cell.
+     */
+    void forEachCandidate(const std::function<Vec3f()> &partyPos, const std::function<void(int, bool)> &check) const;
+
+ private:
+    [[nodiscard]] static int cell(float coordinate);
+    [[nodiscard]] static int64_t cellKey(int x, int y);
+
+ private:
+    std::vector<int> _all; // All decorations, sorted by id.
+    std::vector<int> _byOthers; // Decorations triggered by monsters or objects, sorted by id.
+    std::unordered_map<int64_t, std::vector<int>> _byTouch; // Touch-triggered decorations by grid cell, sorted by id.
+};
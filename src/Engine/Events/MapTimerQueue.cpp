@@ -0,0 +1,53 @@
+#include "MapTimerQueue.h"
+
+#include <algorithm>
+
+void MapTimerQueue::clear() {
+    _size = 0;
+    _deadlines = {};
+}
+
+int MapTimerQueue::add(Time alarmTime) {
+    int index = _size++;
+    _deadlines.push({alarmTime, index});
+    return index;
+}
+
+void MapTimerQueue::fireDue(const std::function<Time()> &now, const std::function<std::optional<Time>(int)> &fire) {
+    // Events can advance party time, so the due set is refilled after each event, but only with the timers that come
+    // later in index order - the earlier ones were already checked during this sweep.
+    std::vector<int> dueTimers; // Sorted in descending order, so that the next timer to fire is at the back.
+    std::vector<Deadline> checkedDeadlines;
+    int lastChecked = -1;
+    while (true) {
+        bool added = false;
+        while (!_deadlines.empty() && _deadlines.top().alarmTime <= now()) {
+            Deadline deadline = _deadlines.top();
+            _deadlines.pop();
+            if (deadline.index > lastChecked) {
+                dueTimers.push_back(deadline.index);
+                added = true;
+            } else {
+                checkedDeadlines.push_back(deadline);
+            }
+        }
+        if (added)
+            std::sort(dueTimers.begin(), dueTimers.end(), std::greater<>());
+
+        if (dueTimers.empty())
+            break;
+
+        int index = dueTimers.back();
+        dueTimers.pop_back();
+        lastChecked = index;
+
+        std::optional<Time> nextAlarmTime = fire(index);
+        if (!nextAlarmTime)
+            return;
+
+        checkedDeadlines.push_back({*nextAlarmTime, index});
+    }
+
+    for (const Deadline &deadline : checkedDeadlines)
+        _deadlines.push(deadline);
+}
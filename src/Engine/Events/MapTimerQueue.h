@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <queue>
+#include <vector>
+
+#include "Engine/Time/Time.h"
+
+/**
+ * Alarm times of map timers, ordered so that checking the timers only touches the ones that are due.
+ *
+ * Timers are identified by their index, which is the order in which they were added. This is also the order in which
+ * they are fired, and it must be preserved for determinism.
+ */
+class MapTimerQueue {
+ public:
+    void clear();
+
+    /**
+     * @param alarmTime                 Time at which the timer should fire.
+     * @return                          Index of the added timer.
+     */
+    int add(Time alarmTime);
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    /**
+     * Fires all timers that are due, in index order. Results are the same as for a linear sweep that checks each
+     * timer against the current time, in index order:
+     * - Firing a timer can advance the current time. Timers that become due this way are also fired, but only if they
+     *   come after the timer that was just fired in index order.
+     * - Timers are not fired twice in one sweep.
+     *
+     * @param now                       Returns the current time.
+     * @param fire                      Fires the timer with the provided index. Should return the next alarm time for
+     *                                  this timer, or `std::nullopt` to stop the sweep, e.g. because the timers were
+     *                                  cleared by a map transition. In the latter case the queue is left untouched.
+     */
+    void fireDue(const std::function<Time()> &now, const std::function<std::optional<Time>(int)> &fire);
+
+ private:
+    struct Deadline {
+        Time alarmTime;
+        int index = 0;
+
+        friend auto operator<=>(const Deadline &l, const Deadline &r) = default;
+    };
+
+ private:
+    int _size = 0;
+    std::priority_queue<Deadline, std::vector<Deadline>, std::greater<>> _deadlines; // Min-heap.
+};
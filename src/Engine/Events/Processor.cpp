@@ -1,9 +1,11 @@
 #include "Processor.h"
 
+#include <optional>
 #include <vector>
 #include <string>
 
 #include "Engine/Engine.h"
+#include "Engine/EngineProfiler.h"
 #include "Engine/Localization.h"
 #include "Engine/mm7_data.h"
 #include "Engine/Graphics/LocationFunctions.h"
@@ -14,6 +16,8 @@
 #include "Engine/Events/EventMap.h"
 #include "Engine/Events/EventIR.h"
 #include "Engine/Events/EventInterpreter.h"
+#include "Engine/Events/DecorationTriggerGrid.h"
+#include "Engine/Events/MapTimerQueue.h"
 #include "Engine/Party.h"
 
 #include "GUI/UI/UIStatusBar.h"
@@ -32,10 +36,14 @@ struct MapTimer {
 static std::vector<EventTrigger> onMapLoadTriggers;
 static std::vector<EventTrigger> onMapLeaveTriggers;
 
-static std::vector<MapTimer> onLongTimerTriggers;
-static std::vector<MapTimer> onTimerTriggers;
+// All timers in trigger order, onTimer triggers first, then onLongTimer ones. This is the order in which they are
+// checked, and it must be preserved for determinism.
+static std::vector<MapTimer> mapTimers;
 
-static std::vector<int> decorationsWithEvents;
+// Alarm times of the timers above, so that onTimer only touches the timers that are due.
+static MapTimerQueue mapTimerQueue;
+
+static DecorationTriggerGrid decorationTriggers;
 
 // Was in original code and ensures that timers are checked not more often than 30 game seconds.
 // Do not needed in practice but can be considered optimization to avoid checking timers too often.
@@ -48,42 +56,49 @@ LevelDecoration *savedDecoration;
 void initDecorationEvents() {
     DecorationId id = pDecorationList->GetDecorIdByName("Event Trigger");
 
-    decorationsWithEvents.clear();
+    decorationTriggers.clear();
     for (int i = 0; i < pLevelDecorations.size(); ++i) {
-        if (pLevelDecorations[i].uDecorationDescID == id) {
-            decorationsWithEvents.push_back(i);
+        const LevelDecoration &decoration = pLevelDecorations[i];
+        if (decoration.uDecorationDescID == id) {
+            decorationTriggers.add(i, decoration.vPosition, decoration.uTriggerRange,
+                                   decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH,
+                                   decoration.uFlags & (LEVEL_DECORATION_TRIGGERED_BY_MONSTER | LEVEL_DECORATION_TRIGGERED_BY_OBJECT));
         }
     }
 }
 
-void checkDecorationEvents() {
-    for (int decorationId : decorationsWithEvents) {
-        const LevelDecoration &decoration = pLevelDecorations[decorationId];
+static void checkDecorationEvents(int decorationId, bool checkTouch) {
+    const LevelDecoration &decoration = pLevelDecorations[decorationId];
 
-        if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH) {
-            if ((decoration.vPosition - pParty->pos).length() < decoration.uTriggerRange) {
-                eventProcessor(decoration.uEventID, Pid(OBJECT_Decoration, decorationId), 1);
-            }
+    if (checkTouch && (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH)) {
+        if ((decoration.vPosition - pParty->pos).length() < decoration.uTriggerRange) {
+            eventProcessor(decoration.uEventID, Pid(OBJECT_Decoration, decorationId), 1);
         }
+    }
 
-        if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER) {
-            for (int i = 0; i < pActors.size(); i++) {
-                if ((decoration.vPosition - pActors[i].pos).length() < decoration.uTriggerRange) {
-                    eventProcessor(decoration.uEventID, Pid(), 1);
-                }
+    if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER) {
+        for (int i = 0; i < pActors.size(); i++) {
+            if ((decoration.vPosition - pActors[i].pos).length() < decoration.uTriggerRange) {
+                eventProcessor(decoration.uEventID, Pid(), 1);
             }
         }
+    }
 
-        if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT) {
-            for (int i = 0; i < pSpriteObjects.size(); i++) {
-                if ((decoration.vPosition - pSpriteObjects[i].vPosition).length() < decoration.uTriggerRange) {
-                    eventProcessor(decoration.uEventID, Pid(), 1);
-                }
+    if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT) {
+        for (int i = 0; i < pSpriteObjects.size(); i++) {
+            if ((decoration.vPosition - pSpriteObjects[i].vPosition).length() < decoration.uTriggerRange) {
+                eventProcessor(decoration.uEventID, Pid(), 1);
             }
         }
     }
 }
 
+void checkDecorationEvents() {
+    decorationTriggers.forEachCandidate([] { return pParty->pos; }, [] (int decorationId, bool checkTouch) {
+        checkDecorationEvents(decorationId, checkTouch);
+    });
+}
+
 static void registerTimerTriggers(EventType triggerType, std::vector<MapTimer> *triggers) {
     std::vector<EventTrigger> timerTriggers = engine->_localEventMap.enumerateTriggers(triggerType);
 
@@ -91,7 +106,6 @@ static void registerTimerTriggers(EventType triggerType, std::vector<MapTimer> *
     //                   To support fair timers they need to be saved directly.
     Time levelLastVisit = currentLocationTime().last_visit;
 
-    triggers->clear();
     for (EventTrigger &trigger : timerTriggers) {
         MapTimer timer;
         EventIR ir = engine->_localEventMap.event(trigger.eventId, trigger.eventStep);
@@ -204,8 +218,13 @@ static void registerEventTriggers() {
     onMapLeaveTriggers.clear();
     onMapLeaveTriggers = engine->_localEventMap.enumerateTriggers(EVENT_OnMapLeave);
 
-    registerTimerTriggers(EVENT_OnLongTimer, &onLongTimerTriggers);
-    registerTimerTriggers(EVENT_OnTimer, &onTimerTriggers);
+    mapTimers.clear();
+    registerTimerTriggers(EVENT_OnTimer, &mapTimers);
+    registerTimerTriggers(EVENT_OnLongTimer, &mapTimers);
+
+    mapTimerQueue.clear();
+    for (const MapTimer &timer : mapTimers)
+        mapTimerQueue.add(timer.alarmTime);
 }
 
 void onMapLoad() {
@@ -225,8 +244,8 @@ void onMapLeave() {
     }
 
     // Cleanup timers to avoid firing while map transition is in process
-    onLongTimerTriggers.clear();
-    onTimerTriggers.clear();
+    mapTimers.clear();
+    mapTimerQueue.clear();
 }
 
 static void checkTimer(MapTimer &timer) {
@@ -247,6 +266,8 @@ static void checkTimer(MapTimer &timer) {
 }
 
 void onTimer() {
+    EngineProfilerScope profilerScope(engine->profiler, ENGINE_PHASE_EVENTS);
+
     if (pEventTimer->isPaused()) {
         return;
     }
@@ -257,11 +278,10 @@ void onTimer() {
 
     timerGuard = pParty->GetPlayingTime();
 
-    for (MapTimer &timer : onTimerTriggers) {
-        checkTimer(timer);
-    }
-
-    for (MapTimer &timer : onLongTimerTriggers) {
-        checkTimer(timer);
-    }
+    mapTimerQueue.fireDue([] { return pParty->GetPlayingTime(); }, [] (int index) -> std::optional<Time> {
+        checkTimer(mapTimers[index]);
+        if (mapTimers.empty())
+            return std::nullopt; // Event triggered a map transition, timers were cleared in onMapLeave.
+        return mapTimers[index].alarmTime;
+    });
 }
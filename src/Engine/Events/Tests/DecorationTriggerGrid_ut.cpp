@@ -0,0 +1,120 @@
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Events/DecorationTriggerGrid.h"
+
+namespace {
+using FiredList = std::vector<std::pair<int, bool>>; // Decoration id & whether it was triggered by touch.
+
+struct Decoration {
+    Vec3f position;
+    float triggerRange = 0;
+    bool byTouch = false;
+    bool byOthers = false;
+    Vec3f teleportTo; // Where to teleport the party when touched, if non-zero.
+};
+
+struct DecorationWorld {
+    std::vector<Decoration> decorations;
+    Vec3f partyPos;
+    FiredList fired;
+
+    // This is what checkDecorationEvents in Processor.cpp does, with actors & objects always in range.
+    void check(int id, bool checkTouch) {
+        const Decoration &decoration = decorations[id];
+        if (checkTouch && decoration.byTouch && (decoration.position - partyPos).length() < decoration.triggerRange) {
+            fired.emplace_back(id, true);
+            if (decoration.teleportTo != Vec3f())
+                partyPos = decoration.teleportTo;
+        }
+        if (decoration.byOthers)
+            fired.emplace_back(id, false);
+    }
+
+    void linearSweep() {
+        for (int i = 0; i < decorations.size(); i++)
+            check(i, true);
+    }
+
+    DecorationTriggerGrid makeGrid() const {
+        DecorationTriggerGrid result;
+        for (int i = 0; i < decorations.size(); i++)
+            result.add(i, decorations[i].position, decorations[i].triggerRange, decorations[i].byTouch, decorations[i].byOthers);
+        return result;
+    }
+
+    void gridSweep(const DecorationTriggerGrid &grid) {
+        grid.forEachCandidate([this] { return partyPos; }, [this] (int id, bool checkTouch) { check(id, checkTouch); });
+    }
+};
+} // namespace
+
+UNIT_TEST(DecorationTriggerGrid, TouchAndMonster) {
+    // Decoration 0 is both touch- and monster-triggered, decoration 1 is touch-triggered only.
+    DecorationWorld world;
+    world.decorations.push_back({.position = Vec3f(5000, 5000, 0), .triggerRange = 512, .byTouch = true, .byOthers = true});
+    world.decorations.push_back({.position = Vec3f(0, 0, 0), .triggerRange = 512, .byTouch = true});
+    DecorationTriggerGrid grid = world.makeGrid();
+
+    // Party is far away from decoration 0, but it should still be checked for monsters.
+    world.partyPos = Vec3f(100, 100, 0);
+    world.gridSweep(grid);
+    EXPECT_EQ(world.fired, FiredList({{0, false}, {1, true}}));
+
+    // Party is close to decoration 0, touch & monster triggers should both fire, once each.
+    world.fired.clear();
+    world.partyPos = Vec3f(5100, 5100, 0);
+    world.gridSweep(grid);
+    EXPECT_EQ(world.fired, FiredList({{0, true}, {0, false}}));
+}
+
+UNIT_TEST(DecorationTriggerGrid, TeleportMidSweep) {
+    // Touching decoration 0 teleports the party next to decorations 1 & 3, which are in another grid cell. A linear
+    // sweep would then fire decorations 1 & 3 in the same frame.
+    DecorationWorld world;
+    world.decorations.push_back({.position = Vec3f(0, 0, 0), .triggerRange = 256, .byTouch = true, .teleportTo = Vec3f(10000, 10000, 0)});
+    world.decorations.push_back({.position = Vec3f(10100, 10000, 0), .triggerRange = 256, .byTouch = true});
+    world.decorations.push_back({.position = Vec3f(100, 0, 0), .triggerRange = 256, .byTouch = true});
+    world.decorations.push_back({.position = Vec3f(10000, 10100, 0), .triggerRange = 256, .byTouch = true});
+    DecorationTriggerGrid grid = world.makeGrid();
+
+    world.partyPos = Vec3f(50, 0, 0);
+    world.gridSweep(grid);
+    EXPECT_EQ(world.fired, FiredList({{0, true}, {1, true}, {3, true}}));
+    EXPECT_EQ(world.partyPos, Vec3f(10000, 10000, 0));
+}
+
+UNIT_TEST(DecorationTriggerGrid, MatchesLinearSweep) {
+    std::mt19937 rng(1234);
+    auto coordinate = [&] { return std::uniform_real_distribution(-8000.0f, 8000.0f)(rng); };
+
+    for (int iteration = 0; iteration < 100; iteration++) {
+        DecorationWorld world;
+        int size = std::uniform_int_distribution(1, 50)(rng);
+        for (int i = 0; i < size; i++) {
+            Decoration &decoration = world.decorations.emplace_back();
+            decoration.position = Vec3f(coordinate(), coordinate(), 0);
+            decoration.triggerRange = std::uniform_real_distribution(0.0f, 3000.0f)(rng);
+            int flags = std::uniform_int_distribution(0, 3)(rng);
+            decoration.byTouch = flags & 1;
+            decoration.byOthers = flags & 2;
+            if (std::uniform_int_distribution(0, 9)(rng) == 0)
+                decoration.teleportTo = Vec3f(coordinate(), coordinate(), 0);
+        }
+
+        DecorationWorld reference = world;
+        DecorationTriggerGrid grid = world.makeGrid();
+        for (int frame = 0; frame < 20; frame++) {
+            Vec3f partyPos(coordinate(), coordinate(), 0);
+            world.partyPos = reference.partyPos = partyPos;
+
+            reference.linearSweep();
+            world.gridSweep(grid);
+            ASSERT_EQ(world.fired, reference.fired);
+            ASSERT_EQ(world.partyPos, reference.partyPos);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Events/MapTimerQueue.h"
+
+namespace {
+struct TimerWorld {
+    Time now;
+    std::vector<Time> alarmTimes;
+    std::vector<Duration> intervals;
+    std::vector<Duration> timeSkips; // How much time each timer's event skips when fired.
+    std::vector<int> fired;
+
+    Time fire(int index) {
+        fired.push_back(index);
+        now += timeSkips[index];
+        alarmTimes[index] = now + intervals[index];
+        return alarmTimes[index];
+    }
+
+    // This is what onTimer did before MapTimerQueue.
+    void linearSweep() {
+        for (int i = 0; i < alarmTimes.size(); i++)
+            if (now >= alarmTimes[i])
+                fire(i);
+    }
+};
+} // namespace
+
+static MapTimerQueue makeQueue(const TimerWorld &world) {
+    MapTimerQueue result;
+    for (Time alarmTime : world.alarmTimes)
+        result.add(alarmTime);
+    return result;
+}
+
+UNIT_TEST(MapTimerQueue, TimeAdvancingEvents) {
+    // Timers 0 & 2 are due. Timer 0 skips an hour, which makes timers 1 & 3 due. Timer 1 is checked after timer 0 in
+    // a linear sweep, so it should fire in this sweep too.
+    TimerWorld world;
+    world.now = Time::fromHours(10);
+    world.alarmTimes = {Time::fromHours(9), Time::fromHours(10) + Duration::fromMinutes(30), Time::fromHours(8), Time::fromHours(11)};
+    world.intervals = {Duration::fromDays(1), Duration::fromDays(1), Duration::fromDays(1), Duration::fromDays(1)};
+    world.timeSkips = {Duration::fromHours(1), {}, {}, {}};
+
+    MapTimerQueue queue = makeQueue(world);
+    queue.fireDue([&] { return world.now; }, [&] (int index) { return world.fire(index); });
+    EXPECT_EQ(world.fired, std::vector<int>({0, 1, 2, 3}));
+    EXPECT_EQ(world.now, Time::fromHours(11));
+
+    // Nothing is due now.
+    world.fired.clear();
+    queue.fireDue([&] { return world.now; }, [&] (int index) { return world.fire(index); });
+    EXPECT_TRUE(world.fired.empty());
+}
+
+UNIT_TEST(MapTimerQueue, EarlierTimersAreNotRefired) {
+    // Timer 1 skips a day, which makes timer 0 due again. Linear sweep has already passed timer 0, so it's not fired.
+    TimerWorld world;
+    world.now = Time::fromHours(10);
+    world.alarmTimes = {Time::fromHours(9), Time::fromHours(9)};
+    world.intervals = {Duration::fromHours(1), Duration::fromHours(1)};
+    world.timeSkips = {{}, Duration::fromDays(1)};
+
+    MapTimerQueue queue = makeQueue(world);
+    queue.fireDue([&] { return world.now; }, [&] (int index) { return world.fire(index); });
+    EXPECT_EQ(world.fired, std::vector<int>({0, 1}));
+
+    // But it's fired on the next sweep.
+    world.fired.clear();
+    queue.fireDue([&] { return world.now; }, [&] (int index) { return world.fire(index); });
+    EXPECT_EQ(world.fired, std::vector<int>({0}));
+}
+
+UNIT_TEST(MapTimerQueue, MapTransition) {
+    TimerWorld world;
+    world.now = Time::fromHours(10);
+    world.alarmTimes = {Time::fromHours(1), Time::fromHours(2), Time::fromHours(3)};
+    world.intervals = {Duration::fromHours(1), Duration::fromHours(1), Duration::fromHours(1)};
+    world.timeSkips = {{}, {}, {}};
+
+    // Timer 1 triggers a map transition, which clears the queue.
+    MapTimerQueue queue = makeQueue(world);
+    queue.fireDue([&] { return world.now; }, [&] (int index) -> std::optional<Time> {
+        world.fire(index);
+        if (index != 1)
+            return world.alarmTimes[index];
+        queue.clear();
+        return std::nullopt;
+    });
+    EXPECT_EQ(world.fired, std::vector<int>({0, 1}));
+    EXPECT_TRUE(queue.empty());
+
+    // Timers that were checked before the transition are not put back into the queue.
+    world.fired.clear();
+    world.now += Duration::fromDays(1);
+    queue.fireDue([&] { return world.now; }, [&] (int index) { return world.fire(index); });
+    EXPECT_TRUE(world.fired.empty());
+}
+
+UNIT_TEST(MapTimerQueue, MatchesLinearSweep) {
+    std::mt19937 rng(1234);
+    auto minutes = [&](int max) { return Duration::fromMinutes(std::uniform_int_distribution(0, max)(rng)); };
+
+    for (int iteration = 0; iteration < 100; iteration++) {
+        TimerWorld world;
+        world.now = Time::fromDays(10);
+        int size = std::uniform_int_distribution(1, 20)(rng);
+        for (int i = 0; i < size; i++) {
+            world.alarmTimes.push_back(Time::fromDays(9) + minutes(2 * 24 * 60));
+            world.intervals.push_back(minutes(24 * 60) + Duration::fromMinutes(1));
+            world.timeSkips.push_back(std::uniform_int_distribution(0, 3)(rng) == 0 ? minutes(12 * 60) : Duration());
+        }
+
+        TimerWorld reference = world;
+        MapTimerQueue queue = makeQueue(world);
+        for (int sweep = 0; sweep < 20; sweep++) {
+            reference.linearSweep();
+            queue.fireDue([&] { return world.now; }, [&] (int index) { return world.fire(index); });
+            ASSERT_EQ(world.fired, reference.fired);
+            ASSERT_EQ(world.now, reference.now);
+
+            Duration step = minutes(6 * 60);
+            world.now += step;
+            reference.now += step;
+        }
+    }
+}
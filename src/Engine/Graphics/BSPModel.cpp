@@ -1,5 +1,7 @@
 #include "Engine/Graphics/BSPModel.h"
 
+#include <span>
+
 #include "Engine/AssetsManager.h"
 #include "Engine/Events/Processor.h"
 #include "Engine/Graphics/TextureFrameTable.h"
@@ -41,6 +43,19 @@ bool ODMFace::Contains(const Vec3f &pos, int model_idx, int slack, FaceAttribute
     BLVFace face;
     face.uAttributes = this->uAttributes;
     face.uNumVertices = this->uNumVertices;
+    face.index = this->index;
     face.pVertexIDs = const_cast<int16_t *>(this->pVertexIDs.data());
     return face.Contains(pos, model_idx, slack, override_plane);
 }
+
+void BSPModel::buildFacePolygons() {
+    facePolygons.clear();
+    for (const ODMFace &face : pFaces)
+        facePolygons.addFace(pVertices, std::span(face.pVertexIDs).first(face.uNumVertices));
+}
+
+void BSPModel::buildFaceBounds() {
+    faceBounds.clear();
+    for (const ODMFace &face : pFaces)
+        faceBounds.add(face.pBoundingBox);
+}
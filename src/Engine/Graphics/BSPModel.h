@@ -6,8 +6,10 @@
 
 #include "Library/Geometry/Plane.h"
 #include "Library/Geometry/BBox.h"
+#include "Library/Geometry/BBoxArray.h"
 
 #include "FaceEnums.h"
+#include "FacePolygons.h"
 
 class GraphicsImage;
 
@@ -84,6 +86,16 @@ struct ODMFace {
 
 class BSPModel {
  public:
+    /**
+     * Fills `facePolygons` from the model's vertices & faces.
+     */
+    void buildFacePolygons();
+
+    /**
+     * Fills `faceBounds` from the bounding boxes of the model's faces.
+     */
+    void buildFaceBounds();
+
     int index = 0;
     std::string pModelName;
     std::string pModelName2;
@@ -105,4 +117,6 @@ class BSPModel {
     std::vector<ODMFace> pFaces;
     std::vector<uint16_t> pFacesOrdering;
     std::vector<BSPNode> pNodes;
+    FacePolygons facePolygons; // Pre-flattened faces for BLVFace::Contains, built on load.
+    BBoxArray faceBounds; // Face bounding boxes in the same order as pFaces, built on load.
 };
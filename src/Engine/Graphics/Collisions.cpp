@@ -1,5 +1,6 @@
 #include "Collisions.h"
 
+#include <cassert>
 #include <algorithm>
 #include <limits>
 #include <utility>
@@ -10,6 +11,7 @@
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ActorHotState.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/TurnEngine/TurnEngine.h"
@@ -20,6 +22,7 @@
 
 #include "Utility/Math/Float.h"
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Memory/AllocationTracking.h"
 
 CollisionState collision_state;
 
@@ -446,9 +449,9 @@ void CollideOutdoorWithModels(bool ignore_ethereal) {
         if (!collision_state.bbox.intersects(model.pBoundingBox))
             continue;
 
-        for (ODMFace &mface : model.pFaces) {
-            if (!collision_state.bbox.intersects(mface.pBoundingBox))
-                continue;
+        model.faceBounds.findIntersecting(collision_state.bbox, &pOutdoor->modelFaceCandidates);
+        for (int faceId : pOutdoor->modelFaceCandidates) {
+            ODMFace &mface = model.pFaces[faceId];
 
             // TODO: we should really either merge two face classes, or template the functions down the chain call here.
             BLVFace face;
@@ -459,6 +462,7 @@ void CollideOutdoorWithModels(bool ignore_ethereal) {
             face.uPolygonType = mface.uPolygonType;
             face.uNumVertices = mface.uNumVertices;
             face.resource = mface.resource;
+            face.index = mface.index;
             face.pVertexIDs = mface.pVertexIDs.data();
 
             if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
@@ -528,10 +532,21 @@ bool CollideIndoorWithPortals() {
     return true;
 }
 
+/**
+ * Same as calling `CollideWithActor(i, 0)` for all actors, in order, but only visits the actors whose collision boxes
+ * intersect the collision state bounding box. Expects `actorHotState` to be up to date.
+ */
+static void CollideWithActors() {
+    assert(actorHotState.size() == pActors.size());
+
+    actorHotState.collisionBoxes.findIntersecting(collision_state.bbox, &actorHotState.collisionCandidates);
+    for (int actorId : actorHotState.collisionCandidates)
+        CollideWithActor(actorId, 0);
+}
+
 bool CollideWithActor(int actor_idx, int override_radius) {
     Actor *actor = &pActors[actor_idx];
-    if (actor->aiState == Removed || actor->aiState == Dying || actor->aiState == Disabled ||
-        actor->aiState == Dead || actor->aiState == Summoned)
+    if (!isAiStateSolid(actor->aiState))
         return false;
 
     float radius = actor->radius;
@@ -585,6 +600,8 @@ void CollideWithParty(bool jagged_top) {
 }
 
 void ProcessActorCollisionsBLV(Actor &actor, bool isAboveGround, bool isFlying) {
+    MM_ALLOCATION_SCOPE("collisions");
+
     collision_state.total_move_distance = 0;
     collision_state.check_hi = true;
     collision_state.radius_hi = actor.radius;
@@ -727,6 +744,8 @@ void ProcessActorCollisionsBLV(Actor &actor, bool isAboveGround, bool isFlying)
 }
 
 void ProcessActorCollisionsODM(Actor &actor, bool isFlying) {
+    MM_ALLOCATION_SCOPE("collisions");
+
     int actorRadius = !isFlying ? 40 : actor.radius;
 
     collision_state.total_move_distance = 0;
@@ -845,6 +864,10 @@ void ProcessActorCollisionsODM(Actor &actor, bool isFlying) {
 }
 
 void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *faceId, int *faceEvent) {
+    MM_ALLOCATION_SCOPE("collisions");
+
+    actorHotState.update(pActors); // Actors don't move while the party does.
+
     constexpr float closestdist = 0.5f; // Closest allowed approach to collision surface - needs adjusting
 
     collision_state.total_move_distance = 0;
@@ -869,10 +892,8 @@ void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *
             CollideIndoorWithDecorations();
             // TODO(captainurist): why there is no call to _46ED8A_collide_against_sprite_objects?
             //                     See ProcessPartyCollisionsODM.
-            if (!engine->config->gameplay.NoPartyActorCollisions.value()) {
-                for (int k = 0; k < pActors.size(); ++k)
-                    CollideWithActor(k, 0);
-            }
+            if (!engine->config->gameplay.NoPartyActorCollisions.value())
+                CollideWithActors();
             if (CollideIndoorWithPortals())
                 break; // No portal collisions => can break.
         }
@@ -984,6 +1005,10 @@ void ProcessPartyCollisionsBLV(int sectorId, int min_party_move_delta_sqr, int *
 }
 
 void ProcessPartyCollisionsODM(Vec3f *partyNewPos, Vec3f *partyInputSpeed, bool *partyIsOnWater, int *floorFaceId, bool *partyNotOnModel, bool *partyHasHitModel, int *triggerID) {
+    MM_ALLOCATION_SCOPE("collisions");
+
+    actorHotState.update(pActors); // Actors don't move while the party does.
+
     constexpr float closestdist = 0.5f;  // Closest allowed approach to collision surface - needs adjusting
 
     // --(Collisions)-------------------------------------------------------------------
@@ -1009,10 +1034,8 @@ void ProcessPartyCollisionsODM(Vec3f *partyNewPos, Vec3f *partyInputSpeed, bool
         CollideOutdoorWithModels(true);
         CollideOutdoorWithDecorations(WorldPosToGridCellX(pParty->pos.x), WorldPosToGridCellY(pParty->pos.y));
         _46ED8A_collide_against_sprite_objects(Pid::character(0));
-        if (!engine->config->gameplay.NoPartyActorCollisions.value()) {
-            for (size_t actor_id = 0; actor_id < pActors.size(); ++actor_id)
-                CollideWithActor(actor_id, 0);
-        }
+        if (!engine->config->gameplay.NoPartyActorCollisions.value())
+            CollideWithActors();
 
         Vec3f newPosLow = {};
         if (collision_state.adjusted_move_distance >= collision_state.move_distance) {
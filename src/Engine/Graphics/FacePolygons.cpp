@@ -0,0 +1,244 @@
+#include "FacePolygons.h"
+
+#include <cassert>
+#include <algorithm>
+
+#include "Utility/Math/Float.h"
+#include "Utility/Simd.h"
+
+/** Epsilon that `fuzzyIsNull` uses by default. */
+static constexpr float CROSS_PRODUCT_EPS = 0.00001f;
+
+/** Number of edges processed at a time. */
+static constexpr int EDGE_BATCH = 4;
+
+bool flatPolygonContains(std::span<const float> u, std::span<const float> v, float pointU, float pointV, int slack) {
+    assert(u.size() == v.size());
+
+    // The polygons we're dealing with are convex, so instead of the usual ray casting algorithm we can simply
+    // check that the point in question lies on the same side relative to all of the polygon's edges.
+    int size = u.size();
+    int sign = 0;
+    for (int i = 0, j = size - 1; i < size; j = i++) {
+        float a_u = u[j] - u[i];
+        float a_v = v[j] - v[i];
+        float b_u = pointU - u[i];
+        float b_v = pointV - v[i];
+        float cross_product = a_u * b_v - a_v * b_u; // That's |a| * |b| * sin(a,b)
+        if (fuzzyIsNull(cross_product, CROSS_PRODUCT_EPS))
+            continue;
+
+        if (slack > 0) {
+            // distance(point, line) = (a x b) / |a|,
+            // so the condition below just checks that distance is less than slack.
+            float a_len_sqr = a_u * a_u + a_v * a_v;
+            if (cross_product * cross_product < a_len_sqr * slack * slack)
+                continue;
+        }
+
+        int cross_sign = static_cast<int>(cross_product > 0) * 2 - 1;
+
+        if (sign == 0) {
+            sign = cross_sign;
+        } else if (sign != cross_sign) {
+            return false;
+        }
+    }
+
+    // sign == 0 means we got an invalid polygon, so we return false in this case
+    // (invalid polygons don't contain points).
+    return sign != 0;
+}
+
+void FacePolygons::clear() {
+    for (EdgeArrays &edges : _planes) {
+        edges.u.clear();
+        edges.v.clear();
+        edges.du.clear();
+        edges.dv.clear();
+        edges.lengthSqr.clear();
+    }
+    _offsets.clear();
+    _sizes.clear();
+    _dynamic.clear();
+}
+
+void FacePolygons::addFace(std::span<const Vec3f> vertices, std::span<const int16_t> vertexIds) {
+    assert(vertexIds.size() <= 255);
+
+    size_t offset = _planes[0].u.size();
+    size_t size = vertexIds.size();
+    size_t paddedSize = (size + EDGE_BATCH - 1) / EDGE_BATCH * EDGE_BATCH;
+
+    for (int plane = 0; plane < 3; plane++) {
+        EdgeArrays &edges = _planes[plane];
+
+        // Same projections as in BLVFace::Flatten.
+        auto project = [plane](const Vec3f &vertex) {
+            if (plane == 0) {
+                return Vec2f(vertex.x, vertex.y);
+            } else if (plane == 1) {
+                return Vec2f(vertex.x, vertex.z);
+            } else {
+                return Vec2f(vertex.y, vertex.z);
+            }
+        };
+
+        for (size_t i = 0, j = size - 1; i < size; j = i++) {
+            Vec2f start = project(vertices[vertexIds[i]]);
+            Vec2f end = project(vertices[vertexIds[j]]);
+            float du = end.x - start.x;
+            float dv = end.y - start.y;
+            edges.u.push_back(start.x);
+            edges.v.push_back(start.y);
+            edges.du.push_back(du);
+            edges.dv.push_back(dv);
+            edges.lengthSqr.push_back(du * du + dv * dv);
+        }
+
+        // Padding is skipped in `containsInPlane`, so it's zero-filled just to have sane values there.
+        edges.u.resize(offset + paddedSize);
+        edges.v.resize(offset + paddedSize);
+        edges.du.resize(offset + paddedSize);
+        edges.dv.resize(offset + paddedSize);
+        edges.lengthSqr.resize(offset + paddedSize);
+    }
+
+    _offsets.push_back(offset);
+    _sizes.push_back(size);
+    _dynamic.push_back(false);
+}
+
+void FacePolygons::addDynamicFace() {
+    _offsets.push_back(_planes[0].u.size());
+    _sizes.push_back(0);
+    _dynamic.push_back(true);
+}
+
+bool FacePolygons::contains(int faceId, FaceAttributes plane, const Vec3f &pos, int slack) const {
+    assert(hasFace(faceId));
+
+    // Note that polygon projection and point projection use different precedence rules, this mirrors what
+    // BLVFace::Flatten & BLVFace::Contains are doing.
+    const EdgeArrays *edges;
+    if (plane & FACE_XY_PLANE) {
+        edges = &_planes[0];
+    } else if (plane & FACE_XZ_PLANE) {
+        edges = &_planes[1];
+    } else {
+        edges = &_planes[2];
+    }
+
+    if (plane & FACE_XY_PLANE) {
+        return containsInPlane(*edges, faceId, pos.x, pos.y, slack);
+    } else if (plane & FACE_YZ_PLANE) {
+        return containsInPlane(*edges, faceId, pos.y, pos.z, slack);
+    } else {
+        return containsInPlane(*edges, faceId, pos.x, pos.z, slack);
+    }
+}
+
+bool FacePolygons::containsInPlane(const EdgeArrays &edges, int faceId, float pointU, float pointV, int slack) const {
+    int size = _sizes[faceId];
+    if (size < 3)
+        return false;
+
+    size_t offset = _offsets[faceId];
+    const float *u = edges.u.data() + offset;
+    const float *v = edges.v.data() + offset;
+    const float *du = edges.du.data() + offset;
+    const float *dv = edges.dv.data() + offset;
+    const float *lengthSqr = edges.lengthSqr.data() + offset;
+
+    // Same logic as in flatPolygonContains, but without the early exit on the first mismatched edge. Edges for which
+    // the point is on the edge line are skipped, then the point is inside if all the remaining edges agree on the
+    // sign of the cross product, and there is at least one such edge.
+#if defined(MM_USE_SSE2)
+    __m128 pu = _mm_set1_ps(pointU);
+    __m128 pv = _mm_set1_ps(pointV);
+    __m128 eps = _mm_set1_ps(CROSS_PRODUCT_EPS);
+    __m128 slackf = _mm_set1_ps(static_cast<float>(slack));
+    __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 zero = _mm_setzero_ps();
+
+    int positive = 0;
+    int negative = 0;
+    for (int i = 0; i < size; i += EDGE_BATCH) {
+        __m128 bu = _mm_sub_ps(pu, _mm_loadu_ps(u + i));
+        __m128 bv = _mm_sub_ps(pv, _mm_loadu_ps(v + i));
+        __m128 cross = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(du + i), bv), _mm_mul_ps(_mm_loadu_ps(dv + i), bu));
+
+        __m128 skip = _mm_cmplt_ps(_mm_and_ps(cross, absMask), eps);
+        if (slack > 0) {
+            __m128 limit = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(lengthSqr + i), slackf), slackf);
+            skip = _mm_or_ps(skip, _mm_cmplt_ps(_mm_mul_ps(cross, cross), limit));
+        }
+
+        int keepMask = ~_mm_movemask_ps(skip) & ((1 << std::min(size - i, EDGE_BATCH)) - 1);
+        int positiveMask = _mm_movemask_ps(_mm_cmpgt_ps(cross, zero));
+        positive |= positiveMask & keepMask;
+        negative |= ~positiveMask & keepMask;
+        if (positive && negative)
+            return false;
+    }
+
+    return positive || negative;
+#elif defined(MM_USE_NEON)
+    static constexpr uint32_t TAIL_MASKS[EDGE_BATCH + 1][EDGE_BATCH] = {
+        {0, 0, 0, 0},
+        {~0u, 0, 0, 0},
+        {~0u, ~0u, 0, 0},
+        {~0u, ~0u, ~0u, 0},
+        {~0u, ~0u, ~0u, ~0u}
+    };
+
+    float32x4_t pu = vdupq_n_f32(pointU);
+    float32x4_t pv = vdupq_n_f32(pointV);
+    float32x4_t eps = vdupq_n_f32(CROSS_PRODUCT_EPS);
+    float32x4_t slackf = vdupq_n_f32(static_cast<float>(slack));
+    float32x4_t zero = vdupq_n_f32(0.0f);
+
+    uint32x4_t positive = vdupq_n_u32(0);
+    uint32x4_t negative = vdupq_n_u32(0);
+    for (int i = 0; i < size; i += EDGE_BATCH) {
+        float32x4_t bu = vsubq_f32(pu, vld1q_f32(u + i));
+        float32x4_t bv = vsubq_f32(pv, vld1q_f32(v + i));
+        float32x4_t cross = vsubq_f32(vmulq_f32(vld1q_f32(du + i), bv), vmulq_f32(vld1q_f32(dv + i), bu));
+
+        uint32x4_t skip = vcltq_f32(vabsq_f32(cross), eps);
+        if (slack > 0) {
+            float32x4_t limit = vmulq_f32(vmulq_f32(vld1q_f32(lengthSqr + i), slackf), slackf);
+            skip = vorrq_u32(skip, vcltq_f32(vmulq_f32(cross, cross), limit));
+        }
+
+        uint32x4_t keep = vbicq_u32(vld1q_u32(TAIL_MASKS[std::min(size - i, EDGE_BATCH)]), skip);
+        uint32x4_t isPositive = vcgtq_f32(cross, zero);
+        positive = vorrq_u32(positive, vandq_u32(isPositive, keep));
+        negative = vorrq_u32(negative, vbicq_u32(keep, isPositive));
+        if (vmaxvq_u32(positive) && vmaxvq_u32(negative))
+            return false;
+    }
+
+    return vmaxvq_u32(positive) || vmaxvq_u32(negative);
+#else
+    bool positive = false;
+    bool negative = false;
+    for (int i = 0; i < size; i++) {
+        float cross = du[i] * (pointV - v[i]) - dv[i] * (pointU - u[i]);
+        if (fuzzyIsNull(cross, CROSS_PRODUCT_EPS))
+            continue;
+        if (slack > 0 && cross * cross < lengthSqr[i] * slack * slack)
+            continue;
+
+        if (cross > 0) {
+            positive = true;
+        } else {
+            negative = true;
+        }
+        if (positive && negative)
+            return false;
+    }
+
+    return positive || negative;
+#endif
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Library/Geometry/Vec.h"
+
+#include "FaceEnums.h"
+
+/**
+ * Point-in-polygon check for a convex polygon that's already projected onto a plane. This is the algorithm that
+ * `BLVFace::Contains` uses for faces that are not in a `FacePolygons` store.
+ *
+ * @param u                         U coordinates of polygon vertices.
+ * @param v                         V coordinates of polygon vertices, same size as `u`.
+ * @param pointU                    U coordinate of the point to check.
+ * @param pointV                    V coordinate of the point to check.
+ * @param slack                     If a point is at most `slack` units away from the edge, it'll still be
+ *                                  considered to be lying on the edge.
+ * @return                          Whether the point lies inside the polygon.
+ * @see BLVFace::Contains
+ */
+bool flatPolygonContains(std::span<const float> u, std::span<const float> v, float pointU, float pointV, int slack);
+
+/**
+ * Pre-flattened level face polygons.
+ *
+ * `BLVFace::Contains` is called thousands of times per frame, and projecting face vertices onto a plane on each call
+ * is what takes most of the time there. This class projects face polygons onto all three axis planes once at level
+ * load, and stores edge data in a structure-of-arrays layout, so that `contains` can check four edges at a time with
+ * SSE2 / NEON.
+ *
+ * Results returned by `contains` are exactly the same as the ones returned by `flatPolygonContains`.
+ *
+ * Faces are identified by the order in which they were added. Faces whose vertices can move (e.g. door faces) should
+ * be added with `addDynamicFace`, `BLVFace::Contains` then falls back to flattening them on each call.
+ */
+class FacePolygons {
+ public:
+    /**
+     * Removes all faces, keeping the allocated storage.
+     */
+    void clear();
+
+    /**
+     * @param vertices                  Level or model vertices.
+     * @param vertexIds                 Indices of face vertices in `vertices`, in order.
+     */
+    void addFace(std::span<const Vec3f> vertices, std::span<const int16_t> vertexIds);
+
+    /**
+     * Adds a placeholder for a face that cannot be pre-flattened.
+     */
+    void addDynamicFace();
+
+    /**
+     * @return                          Number of faces in this store, including dynamic ones.
+     */
+    [[nodiscard]] size_t size() const {
+        return _offsets.size();
+    }
+
+    /**
+     * @param faceId                    Face index.
+     * @return                          Whether the provided face can be checked with `contains`.
+     */
+    [[nodiscard]] bool hasFace(int faceId) const {
+        return faceId >= 0 && static_cast<size_t>(faceId) < _offsets.size() && !_dynamic[faceId];
+    }
+
+    /**
+     * @param faceId                    Face index, `hasFace(faceId)` must be true.
+     * @param plane                     Plane to perform the check in, one or several of `FACE_XY_PLANE`,
+     *                                  `FACE_XZ_PLANE` and `FACE_YZ_PLANE`, with precedence rules identical to
+     *                                  the ones used in `BLVFace::Contains`.
+     * @param pos                       Point to check.
+     * @param slack                     Edge slack, see `flatPolygonContains`.
+     * @return                          Whether the point lies inside the face polygon.
+     */
+    [[nodiscard]] bool contains(int faceId, FaceAttributes plane, const Vec3f &pos, int slack) const;
+
+ private:
+    /** Edge data for all faces projected onto a single plane. Each face takes a multiple of 4 elements. */
+    struct EdgeArrays {
+        std::vector<float> u; // U of the edge start.
+        std::vector<float> v; // V of the edge start.
+        std::vector<float> du; // U of the edge vector, which points from the edge start to the previous vertex.
+        std::vector<float> dv; // V of the edge vector.
+        std::vector<float> lengthSqr; // Squared edge length.
+    };
+
+    bool containsInPlane(const EdgeArrays &edges, int faceId, float pointU, float pointV, int slack) const;
+
+ private:
+    std::array<EdgeArrays, 3> _planes; // XY, XZ, YZ.
+    std::vector<uint32_t> _offsets; // Offset of the face's first edge in `EdgeArrays`.
+    std::vector<uint8_t> _sizes; // Number of edges in each face.
+    std::vector<bool> _dynamic;
+};
@@ -1,28 +1,85 @@
 #include "FrameLimiter.h"
 
+#include <cassert>
+#include <algorithm>
 #include <chrono>
+#include <thread>
+
+/** Time before the deadline that's always spent spinning, regardless of the sleep overshoot estimate. */
+static constexpr int64_t SPIN_THRESHOLD_NS = 500'000;
+
+/** Initial sleep overshoot estimate, on the pessimistic side so that the first frames don't overshoot. */
+static constexpr int64_t INITIAL_SLEEP_OVERSHOOT_NS = 2'000'000;
+
+/** Overshoot estimate jumps up to new maximums right away, but decays slowly, by 1/16 of the difference per sleep. */
+static constexpr int SLEEP_OVERSHOOT_DECAY_SHIFT = 4;
+
+/** If the estimate gets so large that we don't sleep at all, it's decayed by 1/256 per frame, so that we eventually
+ * try sleeping again. */
+static constexpr int IDLE_SLEEP_OVERSHOOT_DECAY_SHIFT = 8;
 
 static int64_t nowNs() {
     // We're going through std::chrono here and not through Platform because we need actual clock time, not
     // "simulation time".
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
 FrameLimiter::FrameLimiter() {
+    _stats.sleepOvershootNs = INITIAL_SLEEP_OVERSHOOT_NS;
     reset();
 }
 
 void FrameLimiter::reset() {
     _lastFrameTimeNs = nowNs();
+    _stats = {.sleepOvershootNs = _stats.sleepOvershootNs};
 }
 
 void FrameLimiter::tick(int targetFps) {
-    int64_t targetDeltaNs = 1'000'000'000 / targetFps;
+    assert(targetFps > 0);
+
+    int64_t deadlineNs = _lastFrameTimeNs + 1'000'000'000 / targetFps;
+    int64_t currentTimeNs = nowNs();
+    bool waited = currentTimeNs < deadlineNs;
+
+    // Sleep phase.
+    bool slept = false;
+    while (deadlineNs - currentTimeNs > SPIN_THRESHOLD_NS + _stats.sleepOvershootNs) {
+        int64_t sleepNs = deadlineNs - currentTimeNs - SPIN_THRESHOLD_NS - _stats.sleepOvershootNs;
+        std::this_thread::sleep_for(std::chrono::nanoseconds(sleepNs));
 
-    int64_t currentTimeNs;
-    do {
+        int64_t wakeTimeNs = nowNs();
+        updateSleepOvershoot(wakeTimeNs - currentTimeNs - sleepNs);
+        _stats.sleptNs += wakeTimeNs - currentTimeNs;
+        currentTimeNs = wakeTimeNs;
+        slept = true;
+    }
+
+    if (waited && !slept)
+        _stats.sleepOvershootNs -= _stats.sleepOvershootNs >> IDLE_SLEEP_OVERSHOOT_DECAY_SHIFT;
+
+    // Spin phase.
+    int64_t spinStartNs = currentTimeNs;
+    while (currentTimeNs < deadlineNs)
         currentTimeNs = nowNs();
-    } while (currentTimeNs - _lastFrameTimeNs < targetDeltaNs);
+    _stats.spunNs += currentTimeNs - spinStartNs;
+
+    // Frames that were late to begin with say nothing about the pacing, so they're not counted.
+    if (waited) {
+        int64_t jitterNs = currentTimeNs - deadlineNs;
+        _stats.frames++;
+        _stats.totalJitterNs += jitterNs;
+        _stats.maxJitterNs = std::max(_stats.maxJitterNs, jitterNs);
+    }
 
     _lastFrameTimeNs = currentTimeNs;
 }
+
+void FrameLimiter::updateSleepOvershoot(int64_t overshootNs) {
+    overshootNs = std::max<int64_t>(overshootNs, 0);
+
+    if (overshootNs > _stats.sleepOvershootNs) {
+        _stats.sleepOvershootNs = overshootNs;
+    } else {
+        _stats.sleepOvershootNs -= (_stats.sleepOvershootNs - overshootNs) >> SLEEP_OVERSHOOT_DECAY_SHIFT;
+    }
+}
@@ -2,14 +2,54 @@
 
 #include <cstdint>
 
+/**
+ * Frame pacing statistics, accumulated since the last call to `FrameLimiter::reset`.
+ */
+struct FrameLimiterStats {
+    int64_t frames = 0; // Number of frames that actually had to wait for the deadline.
+    int64_t totalJitterNs = 0; // Sum of deadline overshoots for these frames.
+    int64_t maxJitterNs = 0; // Max deadline overshoot.
+    int64_t sleptNs = 0; // Total time spent sleeping.
+    int64_t spunNs = 0; // Total time spent busy-waiting.
+    int64_t sleepOvershootNs = 0; // Current estimate of how much the OS oversleeps.
+
+    [[nodiscard]] int64_t meanJitterNs() const {
+        return frames ? totalJitterNs / frames : 0;
+    }
+};
+
+/**
+ * Limits frame rate by waiting for the next frame deadline in `tick`.
+ *
+ * Waiting is done by sleeping through most of the interval, and then busy-waiting for the last fraction of a
+ * millisecond. OS sleeps tend to wake up late, so the limiter keeps an estimate of the sleep overshoot and stops
+ * sleeping early enough for the spin phase to absorb it. This keeps frame times as stable as with pure spinning, but
+ * doesn't burn a whole core doing that.
+ */
 class FrameLimiter {
  public:
     FrameLimiter();
 
+    /**
+     * Restarts frame timing from the current time, and resets the stats. The sleep overshoot estimate is retained.
+     */
     void reset();
 
+    /**
+     * Waits until `1 / targetFps` seconds have passed since the previous call to this function.
+     *
+     * @param targetFps                 Target frame rate, must be positive.
+     */
     void tick(int targetFps);
 
+    [[nodiscard]] const FrameLimiterStats &stats() const {
+        return _stats;
+    }
+
+ private:
+    void updateSleepOvershoot(int64_t overshootNs);
+
  private:
     int64_t _lastFrameTimeNs = 0;
+    FrameLimiterStats _stats;
 };
@@ -3,17 +3,24 @@
 #include <algorithm>
 #include <limits>
 #include <ranges>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
 #include "Engine/AssetsManager.h"
+#include "Engine/BakedLevelCache.h"
+#include "Engine/EngineFileSystem.h"
+#include "Engine/LevelPreloader.h"
 #include "Engine/Events/Processor.h"
 #include "Engine/Graphics/BspRenderer.h"
 #include "Engine/Graphics/Collisions.h"
 #include "Engine/Graphics/DecalBuilder.h"
+#include "Engine/Graphics/FacePolygons.h"
 #include "Engine/Objects/DecorationList.h"
 #include "Engine/Objects/Decoration.h"
+#include "Engine/Graphics/LevelMeshFunctions.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
 #include "Engine/Graphics/Outdoor.h"
@@ -50,6 +57,7 @@
 
 #include "Utility/String/Ascii.h"
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Streams/MemoryInputStream.h"
 #include "Utility/Exception.h"
 
 IndoorLocation *pIndoor = nullptr;
@@ -145,8 +153,8 @@ void PrepareDrawLists_BLV() {
     uNumSpritesDrawnThisFrame = 0;
     uNumBillboardsToDraw = 0;
 
-    pMobileLightsStack->uNumLightsActive = 0;
-    //pStationaryLightsStack->uNumLightsActive = 0;
+    pMobileLightsStack->clear();
+    //pStationaryLightsStack->clear();
     engine->StackPartyTorchLight();
 
     PrepareBspRenderList_BLV();
@@ -221,6 +229,7 @@ void BLVFace::FromODM(ODMFace *face) {
     this->uPolygonType = face->uPolygonType;
     this->uNumVertices = face->uNumVertices;
     this->resource = face->resource;
+    this->index = face->index;
     this->pVertexIDs = face->pVertexIDs.data();
 }
 
@@ -267,6 +276,9 @@ void IndoorLocation::Release() {
     this->pDoors.clear();
     this->pLights.clear();
     this->pMapOutlines.clear();
+    this->mesh = LevelMesh();
+    this->facePolygons.clear();
+    this->sectorDetection.clear();
 
     render->ReleaseBSP();
 
@@ -298,8 +310,11 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
 
     bLoaded = true;
 
+    BakedLevelCache levelCache(ufs);
+
     IndoorLocation_MM7 location;
-    deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
+    if (!engine->_levelPreloader->take(blv_filename, &location))
+        deserialize(levelCache.decode(blv_filename, pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
     reconstruct(location, this);
 
     std::string dlv_filename = fmt::format("{}.dlv", filename.substr(0, filename.size() - 4));
@@ -309,7 +324,11 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
     IndoorDelta_MM7 delta;
     if (Blob blob = lod::decodeCompressed(pSave_LOD->read(dlv_filename))) {
         try {
-            deserialize(blob, &delta, tags::context(location));
+            // Only read the header & the explored outlines for now. If we're respawning, the rest of the delta comes
+            // from games.lod, and there's no point in deserializing the actors, items & chests from the save.
+            MemoryInputStream stream(blob.data(), blob.size());
+            deserialize(stream, &delta.header);
+            deserialize(stream, &delta.visibleOutlines);
 
             // Level was changed externally and we have a save there? Don't crash, just respawn.
             if (delta.header.totalFacesCount > 0 && delta.header.decorationCount > 0 &&
@@ -325,21 +344,25 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
 
             if (!respawnInitial && num_days_played - delta.header.info.lastRespawnDay >= respawn_interval_days && pMapStats->GetMapInfo(filename) != MAP_CASTLE_HARMONDALE)
                 respawnTimed = true;
+
+            if (!respawnInitial && !respawnTimed)
+                deserialize(blob, &delta, tags::context(location));
         } catch (const Exception &e) {
             logger->error("Failed to load '{}', respawning location: {}", dlv_filename, e.what());
             respawnInitial = true;
+            respawnTimed = false;
         }
     }
 
     assert(respawnInitial + respawnTimed <= 1);
 
     if (respawnInitial) {
-        deserialize(lod::decodeCompressed(pGames_LOD->read(dlv_filename)), &delta, tags::context(location));
+        deserialize(levelCache.decode(dlv_filename, pGames_LOD->read(dlv_filename)), &delta, tags::context(location));
         *indoor_was_respawned = true;
     } else if (respawnTimed) {
         auto header = delta.header;
         auto visibleOutlines = delta.visibleOutlines;
-        deserialize(lod::decodeCompressed(pGames_LOD->read(dlv_filename)), &delta, tags::context(location));
+        deserialize(levelCache.decode(dlv_filename, pGames_LOD->read(dlv_filename)), &delta, tags::context(location));
         delta.header = header;
         delta.visibleOutlines = visibleOutlines;
         *indoor_was_respawned = true;
@@ -353,6 +376,62 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
         dlv.lastRespawnDay = num_days_played;
     if (respawnTimed)
         dlv.respawnCount++;
+
+    LevelMeshBuilder meshBuilder = createLevelMeshBuilder();
+    for (BLVFace &face : pFaces) {
+        if (face.isPortal() || !face.GetTexture())
+            continue;
+
+        std::vector<std::string> frames = levelFaceTextureFrames(face.GetTexture(), face.IsTextureFrameTable() ? (int64_t)face.resource : -1);
+        if (frames.empty())
+            continue;
+
+        LevelTextureSlot slot = meshBuilder.addFace(frames, face.uNumVertices);
+        face.texunit = slot.unit;
+        face.texlayer = slot.layer;
+    }
+    mesh = meshBuilder.finish();
+    if (mesh.numDroppedTextures)
+        logger->warning("{} textures didn't fit into texture arrays in '{}'", mesh.numDroppedTextures, filename);
+
+    buildFacePolygons();
+    buildSectorDetection();
+}
+
+void IndoorLocation::buildFacePolygons() {
+    // Door vertices move, so faces that use them are flattened on each BLVFace::Contains call.
+    std::vector<bool> doorVertices(pVertices.size());
+    for (const BLVDoor &door : pDoors)
+        for (int i = 0; i < door.uNumVertices; i++)
+            doorVertices[door.pVertexIDs[i]] = true;
+
+    facePolygons.clear();
+    for (const BLVFace &face : pFaces) {
+        std::span<const int16_t> vertexIds(face.pVertexIDs, face.uNumVertices);
+        if (std::ranges::any_of(vertexIds, [&](int16_t id) { return doorVertices[id]; })) {
+            facePolygons.addDynamicFace();
+        } else {
+            facePolygons.addFace(pVertices, vertexIds);
+        }
+    }
+}
+
+void IndoorLocation::buildSectorDetection() {
+    // Edges here must match what Detect_Between_Objects does.
+    SectorGraph graph;
+    graph.sectorBounds.resize(pSectors.size());
+    graph.portals.resize(pSectors.size());
+    for (int sectorId = 0; sectorId < pSectors.size(); sectorId++) {
+        const BLVSector &sector = pSectors[sectorId];
+        graph.sectorBounds[sectorId] = sector.pBounding;
+        for (int i = 0; i < sector.uNumPortals; i++) {
+            const BLVFace &face = pFaces[sector.pPortals[i]];
+            int otherSector = face.uSectorID == sectorId ? face.uBackSectorID : face.uSectorID;
+            graph.portals[sectorId].push_back({otherSector, face.pBounding});
+        }
+    }
+
+    sectorDetection.build(graph);
 }
 
 //----- (0049AC17) --------------------------------------------------------
@@ -583,6 +662,10 @@ bool BLVFace::Contains(const Vec3f &pos, int model_idx, int slack, FaceAttribute
     if (!plane)
         plane = this->uAttributes & (FACE_XY_PLANE | FACE_YZ_PLANE | FACE_XZ_PLANE);
 
+    const FacePolygons &polygons = model_idx == MODEL_INDOOR ? pIndoor->facePolygons : pOutdoor->pBModels[model_idx].facePolygons;
+    if (polygons.hasFace(this->index))
+        return polygons.contains(this->index, plane, pos, slack);
+
     FlatFace points;
     Flatten(&points, model_idx, plane);
 
@@ -613,38 +696,7 @@ bool BLVFace::Contains(const Vec3f &pos, int model_idx, int slack, FaceAttribute
     return inside;
 #endif
 
-    // The polygons we're dealing with are convex, so instead of the usual ray casting algorithm we can simply
-    // check that the point in question lies on the same side relative to all of the polygon's edges.
-    int sign = 0;
-    for (int i = 0, j = this->uNumVertices - 1; i < this->uNumVertices; j = i++) {
-        float a_u = points.u[j] - points.u[i];
-        float a_v = points.v[j] - points.v[i];
-        float b_u = u - points.u[i];
-        float b_v = v - points.v[i];
-        float cross_product = a_u * b_v - a_v * b_u; // That's |a| * |b| * sin(a,b)
-        if (fuzzyIsNull(cross_product))
-            continue;
-
-        if (slack > 0) {
-            // distance(point, line) = (a x b) / |a|,
-            // so the condition below just checks that distance is less than slack.
-            float a_len_sqr = a_u * a_u + a_v * a_v;
-            if (cross_product * cross_product < a_len_sqr * slack * slack)
-                continue;
-        }
-
-        int cross_sign = static_cast<int>(cross_product > 0) * 2 - 1;
-
-        if (sign == 0) {
-            sign = cross_sign;
-        } else if (sign != cross_sign) {
-            return false;
-        }
-    }
-
-    // sign == 0 means we got an invalid polygon, so we return false in this case
-    // (invalid polygons don't contain points).
-    return sign != 0;
+    return flatPolygonContains(std::span(points.u).first(this->uNumVertices), std::span(points.v).first(this->uNumVertices), u, v, slack);
 }
 
 //----- (0044C23B) --------------------------------------------------------
@@ -888,7 +940,7 @@ void loadAndPrepareBLV(MapId mapid, bool bLoading) {
         map_info = nullptr;
     }
 
-    pStationaryLightsStack->uNumLightsActive = 0;
+    pStationaryLightsStack->clear();
     pIndoor->Load(mapFilename, pParty->GetPlayingTime().toDays() + 1, respawn_interval, &indoor_was_respawned);
     if (!(dword_6BE364_game_settings_1 & GAME_SETTINGS_LOADING_SAVEGAME_SKIP_RESPAWN)) {
         Actor::InitializeActors();
@@ -1376,7 +1428,10 @@ bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from
 
     for (BSPModel &model : pOutdoor->pBModels) {
         if (CalcDistPointToLine(target.x, target.y, from.x, from.y, model.vPosition.x, model.vPosition.y) <= model.sBoundingRadius + 128) {
-            for (ODMFace &face : model.pFaces) {
+            // bounds check
+            model.faceBounds.findIntersecting(bbox, &pOutdoor->modelFaceCandidates);
+            for (int faceId : pOutdoor->modelFaceCandidates) {
+                const ODMFace &face = model.pFaces[faceId];
                 if (face.Ethereal()) continue;
 
                 float dirDotNormal = dot(dir, face.facePlane.normal);
@@ -1384,10 +1439,6 @@ bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from
                 if (FaceIsParallel)
                     continue;
 
-                // bounds check
-                if (!bbox.intersects(face.pBoundingBox))
-                    continue;
-
                 // point target plane distacne
                 float NegFacePlaceDist = -face.facePlane.signedDistanceTo(target);
 
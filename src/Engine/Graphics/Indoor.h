@@ -10,6 +10,9 @@
 #include "Engine/SpawnPoint.h"
 
 #include "BSPModel.h"
+#include "FacePolygons.h"
+#include "SectorDetection.h"
+#include "LevelMesh.h"
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
@@ -128,6 +131,7 @@ struct BLVFace {  // 60h
     Planef facePlane;
     PlaneZCalcf zCalc;
     FaceAttributes uAttributes;
+    int index = -1; // Index of this face in the level or model, used to look up pre-flattened face polygons.
     int16_t *pVertexIDs = nullptr;
     int16_t *pVertexUIDs = nullptr;
     int16_t *pVertexVIDs = nullptr;
@@ -212,6 +216,16 @@ struct IndoorLocation {
 
     void Release();
     void Load(std::string_view filename, int num_days_played, int respawn_interval_days, bool *indoor_was_respawned);
+
+    /**
+     * Fills `facePolygons` from the level's vertices, faces & doors. Called from `Load`.
+     */
+    void buildFacePolygons();
+
+    /**
+     * Fills `sectorDetection` from the level's sectors & portals. Called from `Load`.
+     */
+    void buildSectorDetection();
     void Draw();
 
     /**
@@ -239,6 +253,9 @@ struct IndoorLocation {
     std::vector<int16_t> ptr_0002B4_doors_ddata;
     std::vector<uint16_t> ptr_0002B8_sector_lrdata;
     std::vector<SpawnPoint> pSpawnPoints;
+    LevelMesh mesh; // Texture-batched faces for the renderer, built on load.
+    FacePolygons facePolygons; // Pre-flattened faces for BLVFace::Contains, built on load.
+    SectorDetection sectorDetection; // Sector detection sets for AI line of sight checks, built on load.
     LocationInfo dlv;
     LocationTime stru1;
     std::array<char, 875> _visible_outlines;
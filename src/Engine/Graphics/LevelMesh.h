@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Library/Geometry/Size.h"
+
+#include "Utility/String/TransparentFunctors.h"
+
+/** Max number of texture arrays in a level mesh. Textures are grouped into arrays by size. */
+static constexpr int LEVEL_MESH_TEXTURE_UNITS = 16;
+
+/** Max number of layers in a single texture array. */
+static constexpr int LEVEL_MESH_TEXTURE_LAYERS = 256;
+
+/**
+ * Vertex as it is submitted to the outdoor building & indoor BSP shaders.
+ */
+struct LevelMeshVertex {
+    float x;
+    float y;
+    float z;
+    float u;
+    float v;
+    float texunit;
+    float texturelayer;
+    float normx;
+    float normy;
+    float normz;
+    float attribs;
+    float sector;
+};
+static_assert(sizeof(LevelMeshVertex) == 48);
+
+/**
+ * Location of a texture inside a `LevelMesh`.
+ */
+struct LevelTextureSlot {
+    int unit = 0;
+    int layer = 0;
+};
+
+/**
+ * Texture array, all textures in an array have the same size.
+ */
+struct LevelTextureArray {
+    Sizei size;
+    std::vector<std::string> layers; // Texture names, indexed by layer.
+};
+
+/**
+ * Texture-batched geometry storage for the level's BSP faces.
+ *
+ * Level mesh is built once at level load by `LevelMeshBuilder`. It's renderer-independent, renderers are then
+ * supposed to upload `textures` to the GPU, and refill `vertices` every frame with the currently visible faces.
+ * Vertex arrays are pre-reserved at build time so that refilling them doesn't allocate.
+ */
+struct LevelMesh {
+    /**
+     * @param name                      Texture name.
+     * @return                          Slot for the provided texture, or `nullptr` if it's not a part of this mesh.
+     */
+    [[nodiscard]] const LevelTextureSlot *textureSlot(std::string_view name) const {
+        auto pos = slotByName.find(name);
+        return pos == slotByName.end() ? nullptr : &pos->second;
+    }
+
+    /**
+     * Clears all vertex arrays, keeping the allocated storage.
+     */
+    void clearVertices() {
+        for (std::vector<LevelMeshVertex> &unitVertices : vertices)
+            unitVertices.clear();
+    }
+
+    std::array<LevelTextureArray, LEVEL_MESH_TEXTURE_UNITS> textures;
+    std::array<std::vector<LevelMeshVertex>, LEVEL_MESH_TEXTURE_UNITS> vertices;
+    std::unordered_map<TransparentString, LevelTextureSlot, TransparentStringHash, TransparentStringEquals> slotByName;
+    int numDroppedTextures = 0; // Number of textures that didn't fit into texture arrays.
+};
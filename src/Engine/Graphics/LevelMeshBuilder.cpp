@@ -0,0 +1,81 @@
+#include "LevelMeshBuilder.h"
+
+#include <bitset>
+#include <cassert>
+#include <utility>
+
+LevelMeshBuilder::LevelMeshBuilder(TextureSizeFunction textureSize) : _textureSize(std::move(textureSize)) {
+    assert(_textureSize);
+}
+
+void LevelMeshBuilder::reserveTextures(Sizei size, std::span<const std::string> names) {
+    LevelTextureArray &array = _mesh.textures[0];
+    assert(array.layers.empty());
+    assert(names.size() <= LEVEL_MESH_TEXTURE_LAYERS);
+
+    array.size = size;
+    for (const std::string &name : names) {
+        _mesh.slotByName.emplace(name, LevelTextureSlot(0, array.layers.size()));
+        array.layers.push_back(name);
+    }
+}
+
+LevelTextureSlot LevelMeshBuilder::addFace(std::span<const std::string> frames, int numVertices) {
+    assert(!frames.empty());
+
+    LevelTextureSlot result;
+    std::bitset<LEVEL_MESH_TEXTURE_UNITS> usedUnits;
+    for (size_t i = 0; i < frames.size(); i++) {
+        LevelTextureSlot slot = addTexture(frames[i]);
+        if (i == 0)
+            result = slot;
+        usedUnits.set(slot.unit);
+    }
+
+    // Animated faces might be drawn with any of their frames, so we reserve space in all the arrays they might use.
+    size_t faceVertices = numVertices >= 3 ? 3 * (numVertices - 2) : 0;
+    for (int unit = 0; unit < LEVEL_MESH_TEXTURE_UNITS; unit++)
+        if (usedUnits[unit])
+            _vertexCounts[unit] += faceVertices;
+
+    return result;
+}
+
+LevelMesh LevelMeshBuilder::finish() {
+    for (int unit = 0; unit < LEVEL_MESH_TEXTURE_UNITS; unit++)
+        _mesh.vertices[unit].reserve(_vertexCounts[unit]);
+
+    LevelMesh result = std::move(_mesh);
+    _mesh = LevelMesh();
+    _vertexCounts = {};
+    return result;
+}
+
+LevelTextureSlot LevelMeshBuilder::addTexture(std::string_view name) {
+    if (const LevelTextureSlot *slot = _mesh.textureSlot(name))
+        return *slot;
+
+    if (name == "wtrtyl")
+        return LevelTextureSlot(); // Water tile, drawn from the water textures in array #0.
+
+    Sizei size = _textureSize(name);
+
+    int unit = 0;
+    for (; unit < LEVEL_MESH_TEXTURE_UNITS; unit++) {
+        const LevelTextureArray &array = _mesh.textures[unit];
+        if (array.layers.empty() || array.size == size)
+            break;
+    }
+
+    if (unit == LEVEL_MESH_TEXTURE_UNITS || _mesh.textures[unit].layers.size() >= LEVEL_MESH_TEXTURE_LAYERS) {
+        _mesh.numDroppedTextures++;
+        return LevelTextureSlot();
+    }
+
+    LevelTextureArray &array = _mesh.textures[unit];
+    LevelTextureSlot result(unit, array.layers.size());
+    array.size = size;
+    array.layers.emplace_back(name);
+    _mesh.slotByName.emplace(name, result);
+    return result;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Library/Geometry/Size.h"
+
+#include "LevelMesh.h"
+
+/**
+ * Builds a `LevelMesh` from a list of level faces.
+ *
+ * Builder assigns texture array slots to face textures, grouping textures by size, and reserves vertex storage for
+ * each texture array. It doesn't know anything about the renderer or the level format, so it can be used from tests
+ * without any assets.
+ *
+ * Example usage:
+ * ```
+ * LevelMeshBuilder builder([](std::string_view name) { return assets->getBitmap(name)->size(); });
+ * for (BLVFace &face : pIndoor->pFaces) {
+ *     LevelTextureSlot slot = builder.addFace(frameNames(face), face.uNumVertices);
+ *     ...
+ * }
+ * pIndoor->mesh = builder.finish();
+ * ```
+ */
+class LevelMeshBuilder {
+ public:
+    using TextureSizeFunction = std::function<Sizei(std::string_view)>;
+
+    /**
+     * @param textureSize               Function that returns texture size given its name.
+     */
+    explicit LevelMeshBuilder(TextureSizeFunction textureSize);
+
+    /**
+     * Reserves layers for textures that are not referenced from faces directly, e.g. for animated water. Must be
+     * called before any faces are added. Reserved textures go into texture array #0.
+     *
+     * @param size                      Size of the reserved textures.
+     * @param names                     Names of the reserved textures.
+     */
+    void reserveTextures(Sizei size, std::span<const std::string> names);
+
+    /**
+     * @param frames                    Texture names of all animation frames of a face. First one is the texture the
+     *                                  face is drawn with initially. Must not be empty.
+     * @param numVertices               Number of vertices in the face polygon.
+     * @return                          Texture slot for the first animation frame.
+     */
+    LevelTextureSlot addFace(std::span<const std::string> frames, int numVertices);
+
+    /**
+     * @return                          Built level mesh. Builder is left in an empty state.
+     */
+    [[nodiscard]] LevelMesh finish();
+
+ private:
+    LevelTextureSlot addTexture(std::string_view name);
+
+ private:
+    TextureSizeFunction _textureSize;
+    LevelMesh _mesh;
+    std::array<size_t, LEVEL_MESH_TEXTURE_UNITS> _vertexCounts = {};
+};
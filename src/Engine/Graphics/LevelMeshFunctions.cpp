@@ -0,0 +1,41 @@
+#include "LevelMeshFunctions.h"
+
+#include <array>
+
+#include "Engine/AssetsManager.h"
+#include "Engine/Graphics/Image.h"
+#include "Engine/Graphics/Renderer/Renderer.h"
+#include "Engine/Graphics/TextureFrameTable.h"
+
+#include "Utility/String/Format.h"
+
+LevelMeshBuilder createLevelMeshBuilder() {
+    LevelMeshBuilder result([](std::string_view name) { return assets->getBitmap(name)->size(); });
+
+    std::array<std::string, 7> waterTextures;
+    for (int i = 0; i < waterTextures.size(); i++)
+        waterTextures[i] = fmt::format("HDWTR{:03}", i);
+    result.reserveTextures(render->hd_water_tile_anim[0]->size(), waterTextures);
+
+    return result;
+}
+
+std::vector<std::string> levelFaceTextureFrames(GraphicsImage *texture, int64_t frameID) {
+    std::vector<std::string> result;
+    if (frameID < 0) {
+        result.push_back(texture->GetName());
+        return result;
+    }
+
+    // TODO(pskelton): any instances where animTime is not consistent would need checking
+    Duration animLength = pTextureFrameTable->textureFrameAnimLength(frameID);
+    Duration frame;
+    do {
+        GraphicsImage *frameTexture = pTextureFrameTable->GetFrameTexture(frameID, frame);
+        if (!frameTexture)
+            break;
+        result.push_back(frameTexture->GetName());
+        frame += pTextureFrameTable->textureFrameAnimTime(frameID);
+    } while (animLength > frame);
+    return result;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LevelMeshBuilder.h"
+
+class GraphicsImage;
+
+/**
+ * @return                              Level mesh builder that takes texture sizes from the global assets manager,
+ *                                      with animated water textures already reserved in texture array #0.
+ */
+LevelMeshBuilder createLevelMeshBuilder();
+
+/**
+ * @param texture                       Face texture.
+ * @param frameID                       Index into `pTextureFrameTable` if the face is animated, -1 otherwise.
+ * @return                              Names of all the textures the face can be drawn with, starting with the
+ *                                      first animation frame.
+ */
+std::vector<std::string> levelFaceTextureFrames(GraphicsImage *texture, int64_t frameID);
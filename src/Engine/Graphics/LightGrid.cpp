@@ -0,0 +1,43 @@
+#include "LightGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+void LightGrid::clear() {
+    for (int cell : _usedCells)
+        _cells[cell].clear();
+    _usedCells.clear();
+    _globalLights.clear();
+}
+
+void LightGrid::add(int index, const Vec3f &pos, float radius) {
+    // Pad by one unit so that float rounding in the callers' distance checks can't make us miss a light.
+    float extent = std::abs(radius) + 1.0f;
+    int minX = cellCoord(pos.x - extent);
+    int maxX = cellCoord(pos.x + extent);
+    int minY = cellCoord(pos.y - extent);
+    int maxY = cellCoord(pos.y + extent);
+
+    if ((maxX - minX + 1) * (maxY - minY + 1) > MAX_LIGHT_CELLS) {
+        _globalLights.push_back(index);
+        return;
+    }
+
+    if (_cells.empty())
+        _cells.resize(GRID_SIZE * GRID_SIZE);
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            int cell = cellIndex(x, y);
+            if (_cells[cell].empty())
+                _usedCells.push_back(cell);
+            _cells[cell].push_back(index);
+        }
+    }
+}
+
+int LightGrid::cellCoord(float coord) {
+    // Clamp in float first so that huge values don't overflow the int conversion.
+    float cell = std::floor(coord / CELL_SIZE) + GRID_SIZE / 2;
+    return static_cast<int>(std::clamp(cell, 0.0f, static_cast<float>(GRID_SIZE - 1)));
+}
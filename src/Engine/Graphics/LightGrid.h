@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Uniform 2d grid over the level's XY plane used to quickly find lights that might affect a given point.
+ *
+ * Each light is added to all the cells its XY bounding square overlaps. Lights that are too big to be binned
+ * efficiently are stored separately and are reported for every point.
+ *
+ * Grid only narrows down the set of candidate lights, it's up to the caller to do the actual distance checks.
+ * Candidate set for a point is guaranteed to contain every light for which `abs(light.x - x) <= radius` and
+ * `abs(light.y - y) <= radius`.
+ */
+class LightGrid {
+ public:
+    /** Size of a grid cell, in world units. */
+    static constexpr int CELL_SIZE = 1024;
+
+    /** Number of cells along each axis. Grid covers [-32768, 32768) on both axes, points outside are clamped. */
+    static constexpr int GRID_SIZE = 64;
+
+    /** Lights overlapping more cells than this are not binned. */
+    static constexpr int MAX_LIGHT_CELLS = 16;
+
+    /**
+     * Removes all lights from the grid, keeping the allocated storage.
+     */
+    void clear();
+
+    /**
+     * @param index                     Light index, as it should be reported back by `forEachCandidate`.
+     * @param pos                       Light position.
+     * @param radius                    Light radius.
+     */
+    void add(int index, const Vec3f &pos, float radius);
+
+    /**
+     * Calls the provided callback for all lights that might affect the point at (x, y). Every light is reported at
+     * most once.
+     *
+     * @param x                         X coordinate.
+     * @param y                         Y coordinate.
+     * @param callback                  Callback to invoke, takes a single `int` light index.
+     */
+    template<class Callback>
+    void forEachCandidate(float x, float y, Callback &&callback) const {
+        for (int index : _globalLights)
+            callback(index);
+
+        if (_cells.empty())
+            return;
+
+        for (int index : _cells[cellIndex(cellCoord(x), cellCoord(y))])
+            callback(index);
+    }
+
+ private:
+    static int cellCoord(float coord);
+
+    static int cellIndex(int cellX, int cellY) {
+        return cellY * GRID_SIZE + cellX;
+    }
+
+ private:
+    std::vector<std::vector<int>> _cells; // Lazily allocated on first add.
+    std::vector<int> _usedCells; // Indices of non-empty cells, for fast clear.
+    std::vector<int> _globalLights;
+};
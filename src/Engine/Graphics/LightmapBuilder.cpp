@@ -95,6 +95,34 @@ Color GetActorTintColor(int max_dimm, int min_dimm, float distance, int bNoLight
     }
 }
 
+/**
+ * @param lightPos                      Light position.
+ * @param lightRadius                   Light radius.
+ * @param x, y, z                       Co-ords of point.
+ *
+ * @return                              Dimming level change (negative or zero) caused by the light at point.
+ */
+static int lightLevelDelta(const Vec3f &lightPos, float lightRadius, float x, float y, float z) {
+    float distX = std::abs(lightPos.x - x);
+    if (distX > lightRadius)
+        return 0;
+
+    float distY = std::abs(lightPos.y - y);
+    if (distY > lightRadius)
+        return 0;
+
+    float distZ = std::abs(lightPos.z - z);
+    if (distZ > lightRadius)
+        return 0;
+
+    unsigned int approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
+    if (approx_distance >= lightRadius)
+        return 0;
+
+    //* ORIGONAL */lightlevel += ((uint64_t)(30i64 *(signed int)(approx_distance << 16) / light_radius) >> 16) - 30;
+    return static_cast<int> (30 * approx_distance / lightRadius) - 30;
+}
+
 /**
  * @offset 0x0043F5C8.
  *
@@ -106,31 +134,12 @@ Color GetActorTintColor(int max_dimm, int min_dimm, float distance, int bNoLight
  */
 int GetLightLevelAtPoint(unsigned int uBaseLightLevel, int uSectorID, float x, float y, float z) {
     int lightlevel = uBaseLightLevel;
-    float light_radius{};
-    float distX{};
-    float distY{};
-    float distZ{};
-    unsigned int approx_distance;
-
-    // mobile lights
-    for (unsigned i = 0; i < pMobileLightsStack->uNumLightsActive; ++i) {
-        MobileLight *p = &pMobileLightsStack->pLights[i];
-        light_radius = p->uRadius;
-
-        distX = std::abs(p->vPosition.x - x);
-        if (distX <= light_radius) {
-            distY = std::abs(p->vPosition.y - y);
-            if (distY <= light_radius) {
-                distZ = std::abs(p->vPosition.z - z);
-                if (distZ <= light_radius) {
-                    approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
-                    if (approx_distance < light_radius)
-                        //* ORIGONAL */lightlevel += ((uint64_t)(30i64 *(signed int)(approx_distance << 16) / light_radius) >> 16) - 30;
-                        lightlevel += static_cast<int> (30 * approx_distance / light_radius) - 30;
-                }
-            }
-        }
-    }
+
+    // mobile lights, only checking the ones that are binned close to the point
+    pMobileLightsStack->grid.forEachCandidate(x, y, [&](int i) {
+        const MobileLight &light = pMobileLightsStack->pLights[i];
+        lightlevel += lightLevelDelta(light.vPosition, light.uRadius, x, y, z);
+    });
 
     // sector lights
     if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
@@ -138,43 +147,16 @@ int GetLightLevelAtPoint(unsigned int uBaseLightLevel, int uSectorID, float x, f
 
         for (unsigned i = 0; i < pSector->uNumLights; ++i) {
             BLVLight *this_light = &pIndoor->pLights[pSector->pLights[i]];
-            light_radius = this_light->uRadius;
-
-            if (~this_light->uAtributes & 8) {
-                distX = std::abs(this_light->vPosition.x - x);
-                if (distX <= light_radius) {
-                    distY = std::abs(this_light->vPosition.y - y);
-                    if (distY <= light_radius) {
-                        distZ = std::abs(this_light->vPosition.z - z);
-                        if (distZ <= light_radius) {
-                            approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
-                            if (approx_distance < light_radius)
-                                lightlevel += static_cast<int> (30 * approx_distance / light_radius) - 30;
-                        }
-                    }
-                }
-            }
+            if (~this_light->uAtributes & 8)
+                lightlevel += lightLevelDelta(this_light->vPosition, this_light->uRadius, x, y, z);
         }
     }
 
     // stationary lights
-    for (unsigned i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i) {
-        StationaryLight *p = &pStationaryLightsStack->pLights[i];
-        light_radius = p->uRadius;
-
-        distX = std::abs(p->vPosition.x - x);
-        if (distX <= light_radius) {
-            distY = std::abs(p->vPosition.y - y);
-            if (distY <= light_radius) {
-                distZ = std::abs(p->vPosition.z - z);
-                if (distZ <= light_radius) {
-                    approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
-                    if (approx_distance < light_radius)
-                        lightlevel += static_cast<int> (30 * approx_distance / light_radius) - 30;
-                }
-            }
-        }
-    }
+    pStationaryLightsStack->grid.forEachCandidate(x, y, [&](int i) {
+        const StationaryLight &light = pStationaryLightsStack->pLights[i];
+        lightlevel += lightLevelDelta(light.vPosition, light.uRadius, x, y, z);
+    });
 
     lightlevel = std::clamp(lightlevel, 0, 31);
     return lightlevel;
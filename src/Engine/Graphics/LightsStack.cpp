@@ -23,17 +23,26 @@ bool LightsStack_MobileLight_::AddLight(const Vec3f &pos, int uSectorID, int uRa
     pLights[uNumLightsActive].uSectorID = uSectorID;
     pLights[uNumLightsActive].field_10 = uRadius * uRadius >> 5;
     pLights[uNumLightsActive].uLightColor = color;
-    pLights[uNumLightsActive++].uLightType = uLightType;
+    pLights[uNumLightsActive].uLightType = uLightType;
+    grid.add(uNumLightsActive, pos, pLights[uNumLightsActive].uRadius);
+    uNumLightsActive++;
 
     return true;
 }
 
+void LightsStack_MobileLight_::clear() {
+    uNumLightsActive = 0;
+    grid.clear();
+}
+
 bool LightsStack_StationaryLight_::AddLight(const Vec3f &pos, int16_t radius, Color color, char uLightType) {
     if (uNumLightsActive >= 400) {
         logger->warning("Too many stationary lights!");
         return false;
     }
 
+    grid.add(uNumLightsActive, pos, radius);
+
     StationaryLight *pLight = &pLights[uNumLightsActive++];
     pLight->vPosition = pos;
     pLight->uRadius = radius;
@@ -41,3 +50,8 @@ bool LightsStack_StationaryLight_::AddLight(const Vec3f &pos, int16_t radius, Co
     pLight->uLightType = uLightType;
     return true;
 }
+
+void LightsStack_StationaryLight_::clear() {
+    uNumLightsActive = 0;
+    grid.clear();
+}
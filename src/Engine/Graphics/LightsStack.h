@@ -5,6 +5,8 @@
 #include "Library/Color/Color.h"
 #include "Library/Geometry/Vec.h"
 
+#include "LightGrid.h"
+
 struct StationaryLight {
     Vec3f vPosition {};
     int16_t uRadius = 0;
@@ -45,8 +47,14 @@ struct LightsStack_StationaryLight_ {
     //----- (004AD3C8) --------------------------------------------------------
     bool AddLight(const Vec3f &pos, int16_t radius, Color color, char uLightType);
 
+    /**
+     * Removes all lights from this stack.
+     */
+    void clear();
+
     std::array<StationaryLight, 400> pLights;
     unsigned int uNumLightsActive;
+    LightGrid grid; // Spatial index over `pLights`, kept in sync by `AddLight` & `clear`.
 };
 
 struct LightsStack_MobileLight_ {
@@ -58,6 +66,12 @@ struct LightsStack_MobileLight_ {
 
     bool AddLight(const Vec3f &pos, int uSectorID, int uRadius, Color color, char uLightType);
 
+    /**
+     * Removes all lights from this stack.
+     */
+    void clear();
+
     std::array<MobileLight, 400> pLights;
     unsigned int uNumLightsActive;
+    LightGrid grid; // Spatial index over `pLights`, kept in sync by `AddLight` & `clear`.
 };
@@ -7,12 +7,16 @@
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
 #include "Engine/AssetsManager.h"
+#include "Engine/BakedLevelCache.h"
+#include "Engine/EngineFileSystem.h"
+#include "Engine/LevelPreloader.h"
 #include "Engine/Events/Processor.h"
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/Collisions.h"
 #include "Engine/Graphics/DecalBuilder.h"
 #include "Engine/Objects/DecorationList.h"
 #include "Engine/Objects/Decoration.h"
+#include "Engine/Graphics/LevelMeshFunctions.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
 #include "Engine/Graphics/ParticleEngine.h"
@@ -53,6 +57,7 @@
 #include "Utility/String/Ascii.h"
 #include "Utility/Memory/FreeDeleter.h"
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Streams/MemoryInputStream.h"
 #include "Utility/Exception.h"
 
 MapStartPoint uLevel_StartingPointType;
@@ -63,6 +68,12 @@ ODMRenderParams *pODMRenderParams = nullptr;
 SkyBillboardStruct SkyBillboard;  // skybox planes
 std::array<struct Polygon, 2000 + 18000> array_77EC08;
 
+/** Party can walk to the neighbouring map once it crosses this coordinate in any direction. */
+static constexpr int MAP_EDGE = 22528;
+
+/** Distance to the map edge at which we start preloading the neighbouring map. */
+static constexpr int MAP_PRELOAD_DISTANCE = 4096;
+
 static constexpr IndexedArray<std::array<MapId, 4>, MAP_EMERALD_ISLAND, MAP_SHOALS> footTravelDestinations = {
     // from                      north                south                east                 west
     {MAP_EMERALD_ISLAND,        {MAP_INVALID,         MAP_INVALID,         MAP_INVALID,         MAP_INVALID}},
@@ -190,8 +201,8 @@ void OutdoorLocation::ExecDraw(unsigned int bRedraw) {
     render->DrawOutdoorBuildings();
 
     // TODO(pskelton): consider order of drawing / lighting
-    pMobileLightsStack->uNumLightsActive = 0;
-    pStationaryLightsStack->uNumLightsActive = 0;
+    pMobileLightsStack->clear();
+    pStationaryLightsStack->clear();
     engine->StackPartyTorchLight();
 
     // engine->PrepareBloodsplats(); // not used?
@@ -317,47 +328,49 @@ bool OutdoorLocation::Initialize(std::string_view filename, int days_played,
     return false;
 }
 
+static int footTravelDirection(int partyX, int partyY, int edge) {
+    // Check which side of the map
+    if (partyX < -edge)
+        return 3; // west
+    else if (partyX > edge)
+        return 2; // east
+    else if (partyY < -edge)
+        return 1; // south
+    else if (partyY > edge)
+        return 0; // north
+    else
+        return -1;
+}
+
+static bool isShoalsTravel(MapId currentMap, int direction) {
+    if (currentMap == MAP_AVLEE && direction == 3) {  // to Shoals
+        for (Character &player : pParty->pCharacters)
+            if (!player.hasUnderwaterSuitEquipped())
+                return false;
+        return true;
+    }
+
+    return currentMap == MAP_SHOALS && direction == 2;  // from Shoals
+}
+
 MapId OutdoorLocation::getTravelDestination(int partyX, int partyY) {
-    int direction;
     MapId currentMap = engine->_currentLoadedMapId;
     MapId destinationMap;
 
     if (!isMapOutdoor(currentMap))
         return MAP_INVALID;
 
-    // Check which side of the map
-    if (partyX < -22528)
-        direction = 3; // west
-    else if (partyX > 22528)
-        direction = 2; // east
-    else if (partyY < -22528)
-        direction = 1; // south
-    else if (partyY > 22528)
-        direction = 0; // north
-    else
+    int direction = footTravelDirection(partyX, partyY, MAP_EDGE);
+    if (direction == -1)
         return MAP_INVALID;
 
-    if (currentMap == MAP_AVLEE && direction == 3) {  // to Shoals
-        bool wholePartyUnderwaterSuitEquipped = true;
-        for (Character &player : pParty->pCharacters) {
-            if (!player.hasUnderwaterSuitEquipped()) {
-                wholePartyUnderwaterSuitEquipped = false;
-                break;
-            }
-        }
-
-        if (wholePartyUnderwaterSuitEquipped) {
-            uDefaultTravelTime_ByFoot = 1;
-            uLevel_StartingPointType = MAP_START_POINT_EAST;
-            pParty->uFlags &= ~(PARTY_FLAG_BURNING | PARTY_FLAG_STANDING_ON_WATER | PARTY_FLAG_WATER_DAMAGE);
-            return MAP_SHOALS;
-        }
-    } else if (currentMap == MAP_SHOALS && direction == 2) {  // from Shoals
+    if (isShoalsTravel(currentMap, direction)) {
         uDefaultTravelTime_ByFoot = 1;
-        uLevel_StartingPointType = MAP_START_POINT_WEST;
+        uLevel_StartingPointType = currentMap == MAP_AVLEE ? MAP_START_POINT_EAST : MAP_START_POINT_WEST;
         pParty->uFlags &= ~(PARTY_FLAG_BURNING | PARTY_FLAG_STANDING_ON_WATER | PARTY_FLAG_WATER_DAMAGE);
-        return MAP_AVLEE;
+        return currentMap == MAP_AVLEE ? MAP_SHOALS : MAP_AVLEE;
     }
+
     destinationMap = footTravelDestinations[currentMap][direction];
     if (destinationMap == MAP_INVALID)
         return MAP_INVALID;
@@ -369,6 +382,21 @@ MapId OutdoorLocation::getTravelDestination(int partyX, int partyY) {
     return destinationMap;
 }
 
+MapId OutdoorLocation::peekTravelDestination(int partyX, int partyY, int margin) const {
+    MapId currentMap = engine->_currentLoadedMapId;
+    if (!isMapOutdoor(currentMap))
+        return MAP_INVALID;
+
+    int direction = footTravelDirection(partyX, partyY, MAP_EDGE - margin);
+    if (direction == -1)
+        return MAP_INVALID;
+
+    if (isShoalsTravel(currentMap, direction))
+        return currentMap == MAP_AVLEE ? MAP_SHOALS : MAP_AVLEE;
+
+    return footTravelDestinations[currentMap][direction];
+}
+
 //----- (0048917E) --------------------------------------------------------
 void OutdoorLocation::MessWithLUN() {
     this->pSpriteIDs_LUN[0] = -1;
@@ -810,10 +838,12 @@ void OutdoorLocation::Release() {
     this->sky_texture_filename = "sky043";
 
     pBModels.clear();
+    modelCullingSpheres.clear();
     pSpawnPoints.clear();
     pTerrain.Release();
     pFaceIDLIST.clear();
     pTerrainNormals.clear();
+    mesh = LevelMesh();
 
     // free shader data for outdoor location
     render->ReleaseTerrain();
@@ -849,10 +879,22 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     std::string odm_filename = std::string(filename);
     odm_filename.replace(odm_filename.length() - 4, 4, ".odm");
 
+    BakedLevelCache levelCache(ufs);
+
     OutdoorLocation_MM7 location;
-    deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
+    if (!engine->_levelPreloader->take(odm_filename, &location))
+        deserialize(levelCache.decode(odm_filename, pGames_LOD->read(odm_filename)), &location); // read throws.
     reconstruct(location, this);
 
+    modelCullingSpheres.clear();
+    for (BSPModel &model : pBModels) {
+        model.buildFacePolygons();
+        model.buildFaceBounds();
+
+        // Same radius adjustment as in IsBModelVisible.
+        modelCullingSpheres.add(model.vBoundingCenter, std::max(model.sBoundingRadius, 512.0f));
+    }
+
     // ****************.ddm file*********************//
 
     std::string ddm_filename = fmt::format("{}.ddm", filename.substr(0, filename.length() - 4));
@@ -862,7 +904,12 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     OutdoorDelta_MM7 delta;
     if (Blob blob = lod::decodeCompressed(pSave_LOD->read(ddm_filename))) {
         try {
-            deserialize(blob, &delta, tags::context(location));
+            // Only read the header & the explored map cells for now. If we're respawning, the rest of the delta comes
+            // from games.lod, and there's no point in deserializing the actors, items & chests from the save.
+            MemoryInputStream stream(blob.data(), blob.size());
+            deserialize(stream, &delta.header);
+            deserialize(stream, &delta.fullyRevealedCells);
+            deserialize(stream, &delta.partiallyRevealedCells);
 
             size_t totalFaces = 0;
             for (BSPModel &model : pBModels)
@@ -882,22 +929,26 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
 
             if (!respawnInitial && days_played - delta.header.info.lastRespawnDay >= respawn_interval_days)
                 respawnTimed = true;
+
+            if (!respawnInitial && !respawnTimed)
+                deserialize(blob, &delta, tags::context(location));
         } catch (const Exception &e) {
             logger->error("Failed to load '{}', respawning location: {}", ddm_filename, e.what());
             respawnInitial = true;
+            respawnTimed = false;
         }
     }
 
     assert(respawnInitial + respawnTimed <= 1);
 
     if (respawnInitial) {
-        deserialize(lod::decodeCompressed(pGames_LOD->read(ddm_filename)), &delta, tags::context(location));
+        deserialize(levelCache.decode(ddm_filename, pGames_LOD->read(ddm_filename)), &delta, tags::context(location));
         *outdoors_was_respawned = true;
     } else if (respawnTimed) {
         auto header = delta.header;
         auto fullyRevealedCells = delta.fullyRevealedCells;
         auto partiallyRevealedCells = delta.partiallyRevealedCells;
-        deserialize(lod::decodeCompressed(pGames_LOD->read(ddm_filename)), &delta, tags::context(location));
+        deserialize(levelCache.decode(ddm_filename, pGames_LOD->read(ddm_filename)), &delta, tags::context(location));
         delta.header = header;
         delta.fullyRevealedCells = fullyRevealedCells;
         delta.partiallyRevealedCells = partiallyRevealedCells;
@@ -913,6 +964,25 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     if (respawnTimed)
         ddm.respawnCount++;
 
+    LevelMeshBuilder meshBuilder = createLevelMeshBuilder();
+    for (BSPModel &model : pBModels) {
+        for (ODMFace &face : model.pFaces) {
+            if (face.Invisible() || !face.GetTexture())
+                continue;
+
+            std::vector<std::string> frames = levelFaceTextureFrames(face.GetTexture(), face.IsTextureFrameTable() ? (int64_t)face.resource : -1);
+            if (frames.empty())
+                continue;
+
+            LevelTextureSlot slot = meshBuilder.addFace(frames, face.uNumVertices);
+            face.texunit = slot.unit;
+            face.texlayer = slot.layer;
+        }
+    }
+    mesh = meshBuilder.finish();
+    if (mesh.numDroppedTextures)
+        logger->warning("{} textures didn't fit into texture arrays in '{}'", mesh.numDroppedTextures, filename);
+
     pTileTable->InitializeTileset(Tileset_Dirt);
     pTileTable->InitializeTileset(Tileset_Snow);
     pTileTable->InitializeTileset(pTileTypes[0].tileset);
@@ -1564,6 +1634,9 @@ void ODM_GetTerrainNormalAt(float pos_x, float pos_y, Vec3f *out) {
 void ODM_UpdateUserInputAndOther() {
     ODM_ProcessPartyActions();
 
+    // Start loading the neighbouring map in the background when the party gets close to the map edge.
+    engine->preloadMap(pOutdoor->peekTravelDestination(pParty->pos.x, pParty->pos.y, MAP_PRELOAD_DISTANCE));
+
     if (pParty->pos.x < -22528 || pParty->pos.x > 22528 ||
         pParty->pos.y < -22528 || pParty->pos.y > 22528) {
         MapId mapid = pOutdoor->getTravelDestination(pParty->pos.x, pParty->pos.y);
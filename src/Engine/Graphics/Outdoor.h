@@ -11,8 +11,10 @@
 #include "Media/Audio/SoundEnums.h"
 
 #include "Library/Color/Color.h"
+#include "Library/Geometry/SphereArray.h"
 
 #include "BSPModel.h"
+#include "LevelMesh.h"
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
@@ -118,6 +120,17 @@ struct OutdoorLocation {
      * @offset 0x48902E
      */
     MapId getTravelDestination(int partyX, int partyY);
+
+    /**
+     * Same as `getTravelDestination`, but doesn't change any state, and can look ahead.
+     *
+     * @param partyX                    Party x coordinate.
+     * @param partyY                    Party y coordinate.
+     * @param margin                    Distance to the map edge at which to start reporting the destination.
+     * @return                          Map that the party will travel to if it keeps moving towards the closest
+     *                                  map edge, or `MAP_INVALID`.
+     */
+    MapId peekTravelDestination(int partyX, int partyY, int margin = 0) const;
     void MessWithLUN();
     void UpdateSunlightVectors();
     void UpdateFog();
@@ -148,6 +161,9 @@ struct OutdoorLocation {
     OutdoorLocationTerrain pTerrain;
     std::array<uint16_t, 128 * 128> pCmap; // Unused
     std::vector<BSPModel> pBModels;
+    LevelMesh mesh; // Texture-batched bmodel faces for the renderer, built on load.
+    SphereArray modelCullingSpheres; // Bounding spheres of pBModels for frustum culling, built on load.
+    std::vector<int> modelFaceCandidates; // Scratch buffer for collision & LOS checks against pBModels faces.
     std::vector<Pid> pFaceIDLIST;
     std::array<uint32_t, 128 * 128> pOMAP;
     GraphicsImage *sky_texture = nullptr;        // signed int sSky_TextureID;
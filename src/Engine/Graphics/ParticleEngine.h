@@ -1,30 +1,17 @@
 #pragma once
 
-#include <array>
+#include <vector>
 
 #include "Engine/Graphics/RenderEntities.h"
 #include "Engine/Time/Duration.h"
 
 #include "Library/Color/Color.h"
 
-#include "Utility/Flags.h"
+#include "ParticleEnums.h"
+#include "ParticlePool.h"
 
 class GraphicsImage;
 
-enum class ParticleFlag : uint32_t {
-    ParticleType_Invalid = 0,
-    ParticleType_Dropping = 0x0001,  // particle drops with time
-    ParticleType_Rotating = 0x0004,  // particle rotates with time
-    ParticleType_Ascending = 0x0008, // particle ascends with time
-    ParticleType_Diffuse = 0x0100,   // colored plane
-    ParticleType_Line = 0x0200,      // line
-    ParticleType_Bitmap = 0x0400,    // textured planed
-    ParticleType_Sprite = 0x0800
-};
-using enum ParticleFlag;
-MM_DECLARE_FLAGS(ParticleFlags, ParticleFlag)
-MM_DECLARE_OPERATORS_FOR_FLAGS(ParticleFlags)
-
 // TODO(pskelton): eliminate this one
 struct Particle_sw {
     ParticleFlags type{ ParticleType_Invalid };
@@ -45,34 +32,14 @@ struct Particle_sw {
     int field_38[12]{};
 };
 
-struct Particle {
-    ParticleFlags type = ParticleType_Invalid;
-    float x = 0;
-    float y = 0;
-    float z = 0;
-    float shift_x = 0;
-    float shift_y = 0;
-    float shift_z = 0;
-    Color uParticleColor;
-    Duration timeToLive;
-    GraphicsImage *texture = nullptr;  // unsigned int resource_id;// bitmap IDirect3DTexture
-                       // idx or sprite idx depending on type
-    int paletteID = 0;
-    float particle_size = 0;  // field_28
-    float _x = 0;
-    float _y = 0;
-    float _z = 0;
-    int rotation_speed = 0;
-    int angle = 0;
-    int uScreenSpaceX = 0;
-    int uScreenSpaceY = 0;
-    int uScreenSpaceZ = 0;  // line end x
-    int uScreenSpaceW = 0;  // line end y
-    short zbuffer_depth;
-    int sZValue2 = 0;             // line end z
-    float screenspace_scale = 1.0;  // fixed screenspace_scale {};  // int _screenspace_scale;
-    float fov_x = 0;
-    Color uLightColor_bgr;
+/**
+ * Screen-space position of a particle, as calculated by `ParticleEngine::ViewProject_TrueIfStillVisible_BLV`.
+ */
+struct ParticleProjection {
+    int screenX = 0;
+    int screenY = 0;
+    short zbufferDepth = 0;
+    float screenspaceScale = 1.0f;
 };
 
 struct stru2_LineList {
@@ -83,8 +50,6 @@ struct stru2_LineList {
 
 class ParticleEngine {
  public:
-    static const int PARTICLES_ARRAY_SIZE = 500;
-
     /**
      * Particle engine constructor.
      *
@@ -100,7 +65,7 @@ class ParticleEngine {
     void ResetParticles();
 
     /**
-     * Add particle to engine.
+     * Add particle to engine. Particle storage grows as needed, so particles are never dropped.
      *
      * @offset 0x48AB23
      */
@@ -122,58 +87,44 @@ class ParticleEngine {
     void UpdateParticles();
 
     /**
+     * @param particleId                Index of the particle in `pParticles`.
+     * @param[out] projection           Particle's screen-space position.
+     * @return                          Whether the particle is visible.
      * @offset 0x48AE74
      */
-    bool ViewProject_TrueIfStillVisible_BLV(unsigned int uParticleID);
+    bool ViewProject_TrueIfStillVisible_BLV(int particleId, ParticleProjection *projection);
 
     /**
      * @offset 0x48BBA6
      */
     void DrawParticles_BLV();
 
-    std::array<Particle, PARTICLES_ARRAY_SIZE> pParticles;
+    ParticlePool pParticles;
     stru2_LineList pLines;
-    char field_D160[4800]; // unused
-    float field_E420; // unused
-    int uStartParticle;
-    int uEndParticle;
     Duration uTimeElapsed;
 };
 
-struct TrailParticle {
-    char field_0 = 0;
-    char field_1 = 0;
-    char field_2 = 0;
-    char field_3 = 0;
-    char field_4 = 0;
-    char field_5 = 0;
-    int16_t x = 0;
-    int16_t y = 0;
-    int16_t z = 0;
-    Duration time_left;
-    Duration time_to_live;
-    char field_10 = 0;
-    char field_11 = 0;
-    char field_12 = 0;
-    char field_13 = 0;
-    Color color;
-    char field_16 = 0;
-    char field_17 = 0;
-};
-
+/**
+ * Trail particles, stored as structure-of-arrays. Expired particles are removed in `UpdateParticles`.
+ */
 struct TrailParticleGenerator {  // stru167_wrap
  public:
-    inline TrailParticleGenerator() { num_particles = 0; }
-
     void GenerateTrailParticles(int x, int y, int z, Color color);
     void UpdateParticles();
 
+    [[nodiscard]] size_t size() const {
+        return _x.size();
+    }
+
  protected:
     void AddParticle(int x, int y, int z, Color color);
 
-    TrailParticle particles[100];
-    int num_particles;
-    int field_964 = 0;
+    std::vector<int> _x;
+    std::vector<int> _y;
+    std::vector<int> _z;
+    std::vector<Duration> _timeLeft;
+    std::vector<Duration> _timeToLive;
+    std::vector<Color> _color;
 };
 
 extern TrailParticleGenerator trail_particle_generator;  // 005118E8
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Utility/Flags.h"
+
+enum class ParticleFlag : uint32_t {
+    ParticleType_Invalid = 0,
+    ParticleType_Dropping = 0x0001,  // particle drops with time
+    ParticleType_Rotating = 0x0004,  // particle rotates with time
+    ParticleType_Ascending = 0x0008, // particle ascends with time
+    ParticleType_Diffuse = 0x0100,   // colored plane
+    ParticleType_Line = 0x0200,      // line
+    ParticleType_Bitmap = 0x0400,    // textured planed
+    ParticleType_Sprite = 0x0800
+};
+using enum ParticleFlag;
+MM_DECLARE_FLAGS(ParticleFlags, ParticleFlag)
+MM_DECLARE_OPERATORS_FOR_FLAGS(ParticleFlags)
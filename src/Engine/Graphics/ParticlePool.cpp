@@ -0,0 +1,158 @@
+#include "ParticlePool.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+#include "Library/Random/RandomEngine.h"
+
+#include "Utility/Math/TrigLut.h"
+#include "Utility/Simd.h"
+
+static constexpr float DROPPING_ACCELERATION = -5.0f; // Units per 128 ticks per tick.
+
+/**
+ * Applies acceleration to Z velocity, and then velocity to positions.
+ *
+ * @param dt                            Time step in ticks.
+ * @param shift                         Time step in velocity units, i.e. in 128s of a tick.
+ */
+static void integrate(float *x, float *y, float *z, const float *vx, const float *vy, float *vz, const float *az,
+                      size_t size, float dt, float shift) {
+    size_t i = 0;
+
+#if defined(MM_USE_SSE2)
+    __m128 dt4 = _mm_set1_ps(dt);
+    __m128 shift4 = _mm_set1_ps(shift);
+    for (; i + 4 <= size; i += 4) {
+        __m128 vz4 = _mm_add_ps(_mm_loadu_ps(vz + i), _mm_mul_ps(dt4, _mm_loadu_ps(az + i)));
+        _mm_storeu_ps(vz + i, vz4);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(shift4, _mm_loadu_ps(vx + i))));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(shift4, _mm_loadu_ps(vy + i))));
+        _mm_storeu_ps(z + i, _mm_add_ps(_mm_loadu_ps(z + i), _mm_mul_ps(shift4, vz4)));
+    }
+#elif defined(MM_USE_NEON)
+    // Not using vfmaq_f32 here so that the results are the same as with the scalar code below.
+    float32x4_t dt4 = vdupq_n_f32(dt);
+    float32x4_t shift4 = vdupq_n_f32(shift);
+    for (; i + 4 <= size; i += 4) {
+        float32x4_t vz4 = vaddq_f32(vld1q_f32(vz + i), vmulq_f32(dt4, vld1q_f32(az + i)));
+        vst1q_f32(vz + i, vz4);
+        vst1q_f32(x + i, vaddq_f32(vld1q_f32(x + i), vmulq_f32(shift4, vld1q_f32(vx + i))));
+        vst1q_f32(y + i, vaddq_f32(vld1q_f32(y + i), vmulq_f32(shift4, vld1q_f32(vy + i))));
+        vst1q_f32(z + i, vaddq_f32(vld1q_f32(z + i), vmulq_f32(shift4, vz4)));
+    }
+#endif
+
+    for (; i < size; i++) {
+        vz[i] += dt * az[i];
+        x[i] += shift * vx[i];
+        y[i] += shift * vy[i];
+        z[i] += shift * vz[i];
+    }
+}
+
+ParticlePool::ParticlePool() {
+    forEachArray([](auto &array) { array.reserve(INITIAL_CAPACITY); });
+}
+
+void ParticlePool::clear() {
+    forEachArray([](auto &array) { array.clear(); });
+    _stats = ParticlePoolStats();
+    _spawnedSinceUpdate = 0;
+}
+
+void ParticlePool::add(ParticleFlags type, const Vec3f &pos, const Vec3f &velocity, Color color, Duration timeToLive,
+                       GraphicsImage *texture, int paletteId, float size, RandomEngine *rng) {
+    assert(type != ParticleType_Invalid);
+
+    _x.push_back(pos.x);
+    _y.push_back(pos.y);
+    _z.push_back(pos.z);
+    _vx.push_back(velocity.x);
+    _vy.push_back(velocity.y);
+    _vz.push_back(velocity.z);
+    _az.push_back((type & ParticleType_Dropping) ? DROPPING_ACCELERATION : 0.0f);
+    _timeToLive.push_back(timeToLive);
+    _type.push_back(type);
+    if (type & ParticleType_Rotating) {
+        _rotationSpeed.push_back(rng->random(256) - 128);
+        _angle.push_back(rng->random(TrigLUT.uIntegerDoublePi));
+    } else {
+        _rotationSpeed.push_back(0);
+        _angle.push_back(0);
+    }
+    _color.push_back(color);
+    _lightColor.push_back(color);
+    _texture.push_back(texture);
+    _paletteId.push_back(paletteId);
+    _size.push_back(size);
+
+    _stats.spawned++;
+    _stats.peakAlive = std::max(_stats.peakAlive, _type.size());
+    _spawnedSinceUpdate++;
+}
+
+void ParticlePool::update(Duration dt, RandomEngine *rng) {
+    assert(dt > 0_ticks);
+
+    _stats.lastFrameSpawned = _spawnedSinceUpdate;
+    _stats.peakFrameSpawned = std::max(_stats.peakFrameSpawned, _spawnedSinceUpdate);
+    _spawnedSinceUpdate = 0;
+    _stats.expired += removeExpired(dt);
+
+    size_t size = _type.size();
+    int64_t ticks = dt.ticks();
+
+    // Ascending particles slowly float upward. Random numbers have to be generated in particle order, so this one is
+    // done separately from the vectorized part.
+    for (size_t i = 0; i < size; i++) {
+        if (_type[i] & ParticleType_Ascending) {
+            _x[i] += (rng->random(5) - 2) * ticks / 16.0;
+            _y[i] += (rng->random(5) - 2) * ticks / 16.0;
+            _z[i] += (rng->random(5) + 4) * ticks / 16.0;
+        }
+    }
+
+    // Dropping particles drop downward with acceleration, then all particles move along their velocity vector.
+    integrate(_x.data(), _y.data(), _z.data(), _vx.data(), _vy.data(), _vz.data(), _az.data(), size,
+              static_cast<float>(ticks), ticks / 128.0f);
+
+    for (size_t i = 0; i < size; i++) {
+        _angle[i] += ticks * _rotationSpeed[i] / 16;
+
+        // With time particles become more transparent.
+        // TODO(Nik-RE-dev): check colour format use in particles
+        float dissipateFactor = std::min<int64_t>(2 * _timeToLive[i].ticks(), 255) / 255.0f;
+        _lightColor[i] = Color(std::floor(_color[i].r * dissipateFactor + 0.5f),
+                               std::floor(_color[i].g * dissipateFactor + 0.5f),
+                               std::floor(_color[i].b * dissipateFactor + 0.5f));
+    }
+}
+
+size_t ParticlePool::removeExpired(Duration dt) {
+    size_t size = _type.size();
+
+    // Fast path - nothing expires on most updates.
+    size_t first = 0;
+    while (first < size && _timeToLive[first] > dt) {
+        _timeToLive[first] -= dt;
+        first++;
+    }
+    if (first == size)
+        return 0;
+
+    // Otherwise, squeeze out the expired particles, keeping the order.
+    size_t dst = first;
+    for (size_t src = first + 1; src < size; src++) {
+        if (_timeToLive[src] <= dt)
+            continue;
+
+        forEachArray([src, dst](auto &array) { array[dst] = array[src]; });
+        _timeToLive[dst] -= dt;
+        dst++;
+    }
+
+    forEachArray([dst](auto &array) { array.resize(dst); });
+    return size - dst;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Time/Duration.h"
+
+#include "Library/Color/Color.h"
+#include "Library/Geometry/Vec.h"
+
+#include "ParticleEnums.h"
+
+class GraphicsImage;
+class RandomEngine;
+
+struct ParticlePoolStats {
+    int64_t spawned = 0; // Total number of particles added.
+    int64_t expired = 0; // Total number of particles that have run out of time to live.
+    size_t peakAlive = 0; // Max number of particles alive at the same time.
+    int lastFrameSpawned = 0; // Number of particles added since the previous call to `ParticlePool::update`.
+    int peakFrameSpawned = 0; // Max value of `lastFrameSpawned` so far.
+};
+
+/**
+ * Structure-of-arrays particle storage.
+ *
+ * Particles are kept densely packed. Expired particles are squeezed out during `update`, so there are no dead slots
+ * to skip over, and storage grows as needed, so new particles are never dropped. Particles are stored in the order
+ * they were added.
+ *
+ * Position & velocity integration is done with SSE2 / NEON, four particles at a time.
+ */
+class ParticlePool {
+ public:
+    static constexpr size_t INITIAL_CAPACITY = 512;
+
+    ParticlePool();
+
+    /**
+     * Removes all particles, keeping the allocated storage. Stats are reset too.
+     */
+    void clear();
+
+    /**
+     * @param type                      Particle type, can't be `ParticleType_Invalid`.
+     * @param pos                       Initial position.
+     * @param velocity                  Initial velocity, in units per 128 ticks.
+     * @param color                     Particle color.
+     * @param timeToLive                Time to live.
+     * @param texture                   Particle texture, if any.
+     * @param paletteId                 Palette id.
+     * @param size                      Particle size.
+     * @param rng                       Random engine to use for rotating particles.
+     */
+    void add(ParticleFlags type, const Vec3f &pos, const Vec3f &velocity, Color color, Duration timeToLive,
+             GraphicsImage *texture, int paletteId, float size, RandomEngine *rng);
+
+    /**
+     * Advances all particles by `dt`, removing the ones that have expired.
+     *
+     * @param dt                        Time elapsed since the last update, must be positive.
+     * @param rng                       Random engine to use for ascending particles.
+     */
+    void update(Duration dt, RandomEngine *rng);
+
+    [[nodiscard]] size_t size() const {
+        return _type.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _type.empty();
+    }
+
+    [[nodiscard]] const ParticlePoolStats &stats() const {
+        return _stats;
+    }
+
+    [[nodiscard]] ParticleFlags type(size_t index) const { return _type[index]; }
+    [[nodiscard]] Vec3f position(size_t index) const { return Vec3f(_x[index], _y[index], _z[index]); }
+    [[nodiscard]] Vec3f velocity(size_t index) const { return Vec3f(_vx[index], _vy[index], _vz[index]); }
+    [[nodiscard]] Duration timeToLive(size_t index) const { return _timeToLive[index]; }
+    [[nodiscard]] Color color(size_t index) const { return _color[index]; }
+    [[nodiscard]] Color lightColor(size_t index) const { return _lightColor[index]; }
+    [[nodiscard]] GraphicsImage *texture(size_t index) const { return _texture[index]; }
+    [[nodiscard]] int paletteId(size_t index) const { return _paletteId[index]; }
+    [[nodiscard]] float particleSize(size_t index) const { return _size[index]; }
+    [[nodiscard]] int angle(size_t index) const { return _angle[index]; }
+
+ private:
+    size_t removeExpired(Duration dt);
+
+    template<class Fn>
+    void forEachArray(Fn &&fn) {
+        fn(_x);
+        fn(_y);
+        fn(_z);
+        fn(_vx);
+        fn(_vy);
+        fn(_vz);
+        fn(_az);
+        fn(_timeToLive);
+        fn(_type);
+        fn(_angle);
+        fn(_rotationSpeed);
+        fn(_color);
+        fn(_lightColor);
+        fn(_texture);
+        fn(_paletteId);
+        fn(_size);
+    }
+
+ private:
+    // Hot data, touched on each update.
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+    std::vector<float> _vx;
+    std::vector<float> _vy;
+    std::vector<float> _vz;
+    std::vector<float> _az; // Z acceleration, non-zero only for dropping particles.
+    std::vector<Duration> _timeToLive;
+    std::vector<ParticleFlags> _type;
+    std::vector<int> _angle;
+    std::vector<int> _rotationSpeed;
+    std::vector<Color> _color;
+    std::vector<Color> _lightColor; // Particle color dimmed as the particle is about to expire.
+
+    // Cold data, only needed for drawing.
+    std::vector<GraphicsImage *> _texture;
+    std::vector<int> _paletteId;
+    std::vector<float> _size;
+
+    ParticlePoolStats _stats;
+    int _spawnedSinceUpdate = 0;
+};
@@ -1,6 +1,7 @@
 #include "BaseRenderer.h"
 
 #include <cassert>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -30,6 +31,7 @@
 #include "Library/Logger/Logger.h"
 
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Memory/Arena.h"
 #include "Utility/Memory/MemSet.h"
 
 bool BaseRenderer::Initialize() {
@@ -704,8 +706,8 @@ void BaseRenderer::PresentBlackScreen() {
 }
 
 // TODO: should this be combined / moved out of render
-std::vector<Actor*> BaseRenderer::getActorsInViewport(int pDepth) {
-    std::vector<Actor*> foundActors;
+std::pmr::vector<Actor *> BaseRenderer::getActorsInViewport(int pDepth) {
+    std::pmr::vector<Actor *> foundActors(&frameArena());
 
     for (int i = 0; i < render->uNumBillboardsToDraw; i++) {
         int renderId = render->pBillboardRenderListD3D[i].sParentBillboardID;
@@ -787,6 +789,24 @@ Sizei BaseRenderer::GetPresentDimensions() {
     return outputPresent;
 }
 
+void BaseRenderer::submitScreenCapture(RgbaImage pixels, ScreenCaptureRequest request) {
+    if (!_screenCapture)
+        _screenCapture = std::make_unique<ScreenCapture>();
+    _screenCapture->submit(std::move(pixels), std::move(request));
+}
+
+void BaseRenderer::deliverScreenCaptures() {
+    if (_screenCapture)
+        _screenCapture->deliver();
+}
+
+Recti BaseRenderer::screenCaptureArea(const ScreenCaptureRequest &request) const {
+    Recti fullArea(0, 0, outputRender.w, outputRender.h);
+    if (request.area.isEmpty())
+        return fullArea;
+    return request.area.intersection(fullArea);
+}
+
 void BaseRenderer::updateRenderDimensions() {
     outputPresent = window->size();
     if (config->graphics.RenderFilter.value() != 0)
@@ -40,7 +40,7 @@ class BaseRenderer : public Renderer {
     virtual void DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene() override;
     virtual void PresentBlackScreen() override;
 
-    virtual std::vector<Actor*> getActorsInViewport(int pDepth) override;
+    virtual std::pmr::vector<Actor *> getActorsInViewport(int pDepth) override;
 
     virtual void CreateZBuffer() override;
     virtual void ClearZBuffer() override;
@@ -55,10 +55,30 @@ class BaseRenderer : public Renderer {
     unsigned int Billboard_ProbablyAddToListAndSortByZOrder(float z);
     void TransformBillboard(const SoftwareBillboard *a2, const RenderBillboard *pBillboard);
 
+    /**
+     * @param pixels                    Pixels read back for `request`, bottom-up.
+     * @param request                   Capture request.
+     */
+    void submitScreenCapture(RgbaImage pixels, ScreenCaptureRequest request);
+
+    /**
+     * Invokes the callbacks of all finished screen captures. Should be called once per frame.
+     */
+    void deliverScreenCaptures();
+
+    /**
+     * @param request                   Capture request.
+     * @return                          Capture area of the provided request, in top-down render target coordinates.
+     */
+    Recti screenCaptureArea(const ScreenCaptureRequest &request) const;
+
  protected:
     Sizei outputRender = {0, 0};
     Sizei outputPresent = {0, 0};
 
  private:
     void updateRenderDimensions();
+
+ private:
+    std::unique_ptr<ScreenCapture> _screenCapture;
 };
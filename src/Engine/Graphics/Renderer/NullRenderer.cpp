@@ -1,5 +1,7 @@
 #include "NullRenderer.h"
 
+#include <utility>
+
 #include "Engine/EngineGlobals.h"
 #include "Engine/Engine.h"
 #include "Engine/EngineCallObserver.h"
@@ -113,6 +115,11 @@ RgbaImage NullRenderer::MakeFullScreenshot() {
     return RgbaImage::solid(640, 480, Color());
 }
 
+void NullRenderer::captureScreenAsync(ScreenCaptureRequest request) {
+    Sizei size = request.area.isEmpty() ? Sizei(640, 480) : request.area.size();
+    submitScreenCapture(RgbaImage::solid(size.w, size.h, Color()), std::move(request));
+}
+
 void NullRenderer::BeginLightmaps() {}
 void NullRenderer::EndLightmaps() {}
 void NullRenderer::BeginLightmaps2() {}
@@ -144,4 +151,5 @@ void NullRenderer::endOverlays() {}
 void NullRenderer::flushAndScale() {}
 void NullRenderer::swapBuffers() {
     openGLContext->swapBuffers();
+    deliverScreenCaptures();
 }
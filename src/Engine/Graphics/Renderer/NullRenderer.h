@@ -80,6 +80,7 @@ class NullRenderer : public BaseRenderer {
 
     virtual RgbaImage MakeViewportScreenshot(const int width, const int height) override;
     virtual RgbaImage MakeFullScreenshot() override;
+    virtual void captureScreenAsync(ScreenCaptureRequest request) override;
 
     virtual void BeginLightmaps() override;
     virtual void EndLightmaps() override;
@@ -1,11 +1,14 @@
 #include "OpenGLRenderer.h"
 
+#include <cstring>
 #include <algorithm>
 #include <memory>
 #include <utility>
 #include <map>
+#include <span>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <glad/gl.h> // NOLINT: not a C system header.
 
@@ -21,6 +24,7 @@
 #include "Engine/Graphics/BspRenderer.h"
 #include "Engine/Graphics/Image.h"
 #include "Engine/Graphics/ImageLoader.h"
+#include "Engine/Graphics/LevelMesh.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/DecalBuilder.h"
 #include "Engine/Objects/Decoration.h"
@@ -53,6 +57,7 @@
 #include "Utility/Memory/MemSet.h"
 
 #include "OpenGLShader.h"
+#include "ShaderLights.h"
 
 #ifndef LOWORD
     #define LOWORD(l) ((unsigned short)(((std::uintptr_t)(l)) & 0xFFFF))
@@ -60,6 +65,9 @@
 
 static constexpr int DEFAULT_AMBIENT_LIGHT_LEVEL = 0;
 
+/** Max number of idle pixel pack buffers kept around for async screen captures. */
+static constexpr size_t MAX_FREE_SCREEN_CAPTURE_BUFFERS = 3;
+
 // globals
 //TODO(pskelton): Combine and contain
 int uNumDecorationsDrawnThisFrame;
@@ -194,6 +202,7 @@ OpenGLRenderer::OpenGLRenderer(
 
 OpenGLRenderer::~OpenGLRenderer() {
     logger->info("RenderGl - Destructor");
+    _releaseScreenCaptures();
     _shutdownImGui();
 }
 
@@ -365,6 +374,7 @@ void OpenGLRenderer::BeginScene3D() {
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     render->uNumBillboardsToDraw = 0;  // moved from drawbillboards - cant reset this until mouse picking finished
+    _pointLightsUploaded = false;
 
     SetFogParametersGL();
     gamma = GetGamma();
@@ -1025,6 +1035,101 @@ RgbaImage OpenGLRenderer::MakeFullScreenshot() {
     return flipVertically(ReadScreenPixels());
 }
 
+void OpenGLRenderer::captureScreenAsync(ScreenCaptureRequest request) {
+    Recti area = screenCaptureArea(request);
+    if (area.isEmpty()) {
+        submitScreenCapture(RgbaImage(), std::move(request));
+        return;
+    }
+
+    PendingScreenCapture &capture = _pendingScreenCaptures.emplace_back();
+    capture.size = area.size();
+    capture.request = std::move(request);
+
+    // Reading into a pixel pack buffer makes glReadPixels return right away, the copy happens on the GPU timeline.
+    capture.buffer = _acquireScreenCaptureBuffer(area.w * area.h * sizeof(Color));
+    if (outputRender != outputPresent) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    }
+    glReadPixels(area.x, outputRender.h - area.y - area.h, area.w, area.h, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    if (outputRender != outputPresent) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    capture.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+OpenGLRenderer::ScreenCaptureBuffer OpenGLRenderer::_acquireScreenCaptureBuffer(size_t size) {
+    // Captures are usually all of the same size, so prefer a buffer that won't need reallocating.
+    ScreenCaptureBuffer result;
+    auto pos = std::ranges::find(_freeScreenCaptureBuffers, size, &ScreenCaptureBuffer::size);
+    if (pos == _freeScreenCaptureBuffers.end() && !_freeScreenCaptureBuffers.empty())
+        pos = _freeScreenCaptureBuffers.end() - 1;
+    if (pos != _freeScreenCaptureBuffers.end()) {
+        result = *pos;
+        _freeScreenCaptureBuffers.erase(pos);
+    } else {
+        glGenBuffers(1, &result.id);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, result.id);
+    if (result.size != size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        result.size = size;
+    }
+    return result;
+}
+
+void OpenGLRenderer::_recycleScreenCaptureBuffer(ScreenCaptureBuffer buffer) {
+    if (_freeScreenCaptureBuffers.size() < MAX_FREE_SCREEN_CAPTURE_BUFFERS) {
+        _freeScreenCaptureBuffers.push_back(buffer);
+    } else {
+        glDeleteBuffers(1, &buffer.id);
+    }
+}
+
+void OpenGLRenderer::_readbackScreenCaptures() {
+    // Captures are completed in order, so we can stop at the first one that's not ready yet.
+    while (!_pendingScreenCaptures.empty()) {
+        PendingScreenCapture &capture = _pendingScreenCaptures.front();
+        GLenum status = glClientWaitSync(capture.fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+            break;
+
+        RgbaImage pixels;
+        if (status != GL_WAIT_FAILED) {
+            size_t bytes = capture.size.w * capture.size.h * sizeof(Color);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, capture.buffer.id);
+            if (const void *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT)) {
+                pixels = RgbaImage::uninitialized(capture.size.w, capture.size.h);
+                memcpy(pixels.pixels().data(), data, bytes);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        if (!pixels)
+            logger->warning("Failed to read back screen capture");
+
+        glDeleteSync(capture.fence);
+        _recycleScreenCaptureBuffer(capture.buffer);
+        submitScreenCapture(std::move(pixels), std::move(capture.request));
+        _pendingScreenCaptures.pop_front();
+    }
+}
+
+void OpenGLRenderer::_releaseScreenCaptures() {
+    for (PendingScreenCapture &capture : _pendingScreenCaptures) {
+        glDeleteSync(capture.fence);
+        glDeleteBuffers(1, &capture.buffer.id);
+    }
+    _pendingScreenCaptures.clear();
+
+    for (ScreenCaptureBuffer &buffer : _freeScreenCaptureBuffers)
+        glDeleteBuffers(1, &buffer.id);
+    _freeScreenCaptureBuffers.clear();
+}
+
 // TODO(pskelton): drop - not required in gl renderer now
 void OpenGLRenderer::BeginLightmaps() { return; }
 void OpenGLRenderer::EndLightmaps() { return; }
@@ -1422,20 +1527,7 @@ const int terrain_block_scale = 512;
 const int terrain_height_scale = 32;
 
 // struct for storing vert data for gpu submit
-struct GLshaderverts {
-    GLfloat x;
-    GLfloat y;
-    GLfloat z;
-    GLfloat u;
-    GLfloat v;
-    GLfloat texunit;
-    GLfloat texturelayer;
-    GLfloat normx;
-    GLfloat normy;
-    GLfloat normz;
-    GLfloat attribs;
-    GLfloat sector;
-};
+using GLshaderverts = LevelMeshVertex;
 
 GLshaderverts terrshaderstore[127 * 127 * 6] = {};
 
@@ -1775,91 +1867,8 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
     }
 
 
-    // TODO(pskelton): this should be a seperate function
-    // rest of lights stacking
-    GLuint num_lights = 0;
-
-    // get party torchlight as priority - can be radius == 0
-    for (int i = 0; i < 1; ++i) {
-        if (pMobileLightsStack->uNumLightsActive < 1) continue;
-
-        MobileLight &test = pMobileLightsStack->pLights[i];
-        std::string slotnum = std::to_string(num_lights);
-
-        float x = pMobileLightsStack->pLights[i].vPosition.x;
-        float y = pMobileLightsStack->pLights[i].vPosition.y;
-        float z = pMobileLightsStack->pLights[i].vPosition.z;
-
-        Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
-
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
-        num_lights++;
-    }
-
-    for (int i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i) {
-        // maximum 20 lights sent to shader at the moment
-        // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
-        if (num_lights >= 20) break;
-
-        std::string slotnum = std::to_string(num_lights);
-        StationaryLight &test = pStationaryLightsStack->pLights[i];
-
-        float x = test.vPosition.x;
-        float y = test.vPosition.y;
-        float z = test.vPosition.z;
-
-        Colorf color = test.uLightColor.toColorf();
-
-        float lightrad = test.uRadius;
-
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 1.0);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
-
-        num_lights++;
-    }
-
-    // mobile
-    for (int i = 1; i < pMobileLightsStack->uNumLightsActive; ++i) {
-        // maximum 20 lights sent to shader at the moment
-        // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
-        if (num_lights >= 20) break;
-
-        std::string slotnum = std::to_string(num_lights);
-        MobileLight &test = pMobileLightsStack->pLights[i];
-
-        float x = pMobileLightsStack->pLights[i].vPosition.x;
-        float y = pMobileLightsStack->pLights[i].vPosition.y;
-        float z = pMobileLightsStack->pLights[i].vPosition.z;
-
-        Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
-
-        float lightrad = pMobileLightsStack->pLights[i].uRadius;
-
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
-
-        num_lights++;
-    }
-
-    // blank the rest of the lights
-    for (int blank = num_lights; blank < 20; blank++) {
-        std::string slotnum = std::to_string(blank);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 0.0);
-    }
+    // point lights
+    _updateOutdoorPointLights();
 
     // actually draw the whole terrain
     glDrawArrays(GL_TRIANGLES, 0, (127 * 127 * 6));
@@ -1997,6 +2006,31 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
     // end shder version
 }
 
+void OpenGLRenderer::_updateOutdoorPointLights() {
+    // terrain and outdoor buildings share the same lights
+    if (_pointLightsUploaded)
+        return;
+
+    // maximum 20 lights are used outdoors
+    Vec3f cameraPos(pCamera3D->vCameraPos.x, pCamera3D->vCameraPos.y, pCamera3D->vCameraPos.z);
+    selectShaderPointLights(*pStationaryLightsStack, *pMobileLightsStack, cameraPos, true, std::span(_pointLights).first(20));
+    _uploadPointLights();
+}
+
+void OpenGLRenderer::_uploadPointLights() {
+    if (!_pointLightsUBO) {
+        glGenBuffers(1, &_pointLightsUBO);
+        glBindBuffer(GL_UNIFORM_BUFFER, _pointLightsUBO);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(_pointLights), nullptr, GL_DYNAMIC_DRAW);
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, _pointLightsUBO);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(_pointLights), _pointLights.data());
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, POINT_LIGHTS_UNIFORM_BINDING, _pointLightsUBO);
+    _pointLightsUploaded = true;
+}
+
 // TODO(pskelton): drop - this is now obselete with shader terrain drawing
 void OpenGLRenderer::DrawTerrainPolygon(Polygon *poly, bool transparent, bool clampAtTextureBorders) { return; }
 
@@ -3207,6 +3241,9 @@ void OpenGLRenderer::swapBuffers() {
 
     openGLContext->swapBuffers();
 
+    _readbackScreenCaptures();
+    deliverScreenCaptures();
+
     if (engine->config->graphics.FPSLimit.value() > 0)
         _frameLimiter.tick(engine->config->graphics.FPSLimit.value());
 }
@@ -3216,8 +3253,107 @@ void OpenGLRenderer::Present() {
     swapBuffers();
 }
 
-GLshaderverts *outbuildshaderstore[16] = { nullptr };
-int numoutbuildverts[16] = { 0 };
+// ---------------------- level mesh -----------------------
+
+static void createLevelMeshBuffers(const LevelMesh &mesh, GLuint *vaos, GLuint *vbos, bool withSector) {
+    for (int l = 0; l < LEVEL_MESH_TEXTURE_UNITS; l++) {
+        glGenVertexArrays(1, &vaos[l]);
+        glGenBuffers(1, &vbos[l]);
+
+        glBindVertexArray(vaos[l]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[l]);
+
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * mesh.vertices[l].capacity(), NULL, GL_DYNAMIC_DRAW);
+
+        // position attribute
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
+        glEnableVertexAttribArray(0);
+        // tex uv attribute
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
+        glEnableVertexAttribArray(1);
+        // tex unit attribute
+        // tex array layer attribute
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
+        glEnableVertexAttribArray(2);
+        // normals
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
+        glEnableVertexAttribArray(3);
+        // attribs
+        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
+        glEnableVertexAttribArray(4);
+        if (withSector) {
+            // sector
+            glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, sector));
+            glEnableVertexAttribArray(5);
+        }
+    }
+}
+
+static void createLevelMeshTextures(const LevelMesh &mesh, GLuint *textures) {
+    for (int unit = 0; unit < LEVEL_MESH_TEXTURE_UNITS; unit++) {
+        const LevelTextureArray &array = mesh.textures[unit];
+        // skip if textures are empty
+        if (array.layers.empty())
+            continue;
+
+        glGenTextures(1, &textures[unit]);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, textures[unit]);
+
+        // create blank memory for later texture submission
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, array.size.w, array.size.h, array.layers.size(), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+        for (int layer = 0; layer < array.layers.size(); layer++) {
+            GraphicsImage *texture = assets->getBitmap(array.layers[layer]);
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                0,
+                0, 0, layer,
+                array.size.w, array.size.h, 1,
+                GL_RGBA,
+                GL_UNSIGNED_BYTE,
+                texture->rgba().pixels().data());
+        }
+
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    }
+}
+
+static void uploadLevelMeshVertices(const LevelMesh &mesh, GLuint *vbos) {
+    for (int l = 0; l < LEVEL_MESH_TEXTURE_UNITS; l++) {
+        const std::vector<GLshaderverts> &vertices = mesh.vertices[l];
+        if (vertices.empty())
+            continue;
+
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[l]);
+        // orphan buffer, capacity only grows if the same face was visible through several portals
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * vertices.capacity(), NULL, GL_DYNAMIC_DRAW);
+        // update buffer
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * vertices.size(), vertices.data());
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/**
+ * @param mesh                          Level mesh to look up the face texture in.
+ * @param texture                       Current face texture.
+ * @return                              Texture slot for the provided texture, or water texture slot if it's not in
+ *                                      the mesh.
+ */
+static LevelTextureSlot lookupLevelMeshTexture(const LevelMesh &mesh, GraphicsImage *texture) {
+    if (const LevelTextureSlot *slot = mesh.textureSlot(texture->GetName()))
+        return *slot;
+
+    logger->warning("Texture not found in map!");
+    // TODO(pskelton): set to water for now - fountains in walls of mist
+    return LevelTextureSlot();
+}
+
 
 void OpenGLRenderer::DrawOutdoorBuildings() {
     // shader
@@ -3234,352 +3370,83 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     _set_3d_projection_matrix();
     _set_3d_modelview_matrix();
 
-    if (outbuildVAO[0] == 0) {
-        // count all triangles
-        // make out build shader store
-        int verttotals = 0;
-
-        for (int i = 0; i < 16; i++) {
-            numoutbuildverts[i] = 0;
-
-            //for (BSPModel &model : pOutdoor->pBModels) {
-            //    //int reachable;
-            //    //if (IsBModelVisible(&model, &reachable)) {
-            //    //model.field_40 |= 1;
-            //    if (!model.pFaces.empty()) {
-            //        for (ODMFace &face : model.pFaces) {
-            //            if (!face.Invisible()) {
-            //                numoutbuildverts += 3 * (face.uNumVertices - 2);
-            //            }
-            //        }
-            //    }
-            //}
-
-            free(outbuildshaderstore[i]);
-            outbuildshaderstore[i] = nullptr;
-            outbuildshaderstore[i] = (GLshaderverts *)malloc(sizeof(GLshaderverts) * 20000);
-        }
-
-        // reserve first 7 layers for water tiles in unit 0
-        auto wtrtexture = this->hd_water_tile_anim[0];
-        //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
-        //numterraintexloaded[0]++;
-        outbuildtexturewidths[0] = wtrtexture->width();
-        outbuildtextureheights[0] = wtrtexture->height();
-
-        for (int buff = 0; buff < 7; buff++) {
-            std::string container_name = fmt::format("HDWTR{:03}", buff);
-            outbuildtexmap.insert(std::make_pair(container_name, outbuildtexmap.size()));
-            numoutbuildtexloaded[0]++;
-        }
-
-
+    LevelMesh &mesh = pOutdoor->mesh;
 
+    if (outbuildVAO[0] == 0) {
+        createLevelMeshBuffers(mesh, outbuildVAO, outbuildVBO, false);
+        createLevelMeshTextures(mesh, outbuildtextures);
+    }
 
+        // update verts - blank store
+        mesh.clearVertices();
 
-        for (BSPModel &model : pOutdoor->pBModels) {
-            //int reachable;
-            //if (IsBModelVisible(&model, &reachable)) {
+        std::vector<int> visibleModels;
+        FindBModelsInFrustum(&visibleModels);
+        for (int modelIndex : visibleModels) {
+            BSPModel &model = pOutdoor->pBModels[modelIndex];
+            //if (model.index == 35) continue;
             model.field_40 |= 1;
             if (!model.pFaces.empty()) {
                 for (ODMFace &face : model.pFaces) {
                     if (!face.Invisible()) {
-                        // TODO(pskelton): Same as indoors. When ODM and BLV face is combined - seperate out function
-
-                        if (!face.GetTexture()) continue;
-                        GraphicsImage *tex = face.GetTexture();
+                        array_73D150[0].vWorldPosition = model.pVertices[face.pVertexIDs[0]];
 
-                        std::string texname = tex->GetName();
+                        if (pCamera3D->is_face_faced_to_cameraODM(&face, &array_73D150[0])) {
+                            int texunit = 0;
+                            int texlayer = 0;
 
-                        Duration animLength;
-                        Duration frame;
-                        if (face.IsTextureFrameTable()) {
-                            tex = pTextureFrameTable->GetFrameTexture((int64_t)face.resource, frame);
-                            animLength = pTextureFrameTable->textureFrameAnimLength((int64_t)face.resource);
-                            texname = tex->GetName();
-                        }
-                        // gather up all texture and shaderverts data
-
-                        //auto tile = pOutdoor->getTileDescByGrid(x, y);
-
-                        int texunit = 0;
-                        int texlayer = 0;
-                        int attribflags = 0;
-
-                        if (face.uAttributes & FACE_IsFluid) attribflags |= 2;
-                        if (face.uAttributes & FACE_INDOOR_SKY) attribflags |= 0x400;
-
-                        if (face.uAttributes & FACE_FlowDown)
-                            attribflags |= 0x400;
-                        else if (face.uAttributes & FACE_FlowUp)
-                            attribflags |= 0x800;
-
-                        if (face.uAttributes & FACE_FlowRight)
-                            attribflags |= 0x2000;
-                        else if (face.uAttributes & FACE_FlowLeft)
-                            attribflags |= 0x1000;
-
-                        if (face.uAttributes & FACE_IsLava)
-                            attribflags |= 0x4000;
-
-                        // loop while running down animlength with frame animtimes
-                        do {
-                            // check if tile->name is already in list
-                            auto mapiter = outbuildtexmap.find(texname);
-                            if (mapiter != outbuildtexmap.end()) {
-                                // if so, extract unit and layer
-                                int unitlayer = mapiter->second;
-                                texlayer = unitlayer & 0xFF;
-                                texunit = (unitlayer & 0xFF00) >> 8;
-                            } else if (texname == "wtrtyl") {
-                                // water tile
-                                texunit = 0;
-                                texlayer = 0;
+                            if (face.IsTextureFrameTable()) {
+                                texlayer = -1;
+                                texunit = -1;
                             } else {
-                                // else need to add it
-                                auto thistexture = assets->getBitmap(texname);
-                                int width = thistexture->width();
-                                int height = thistexture->height();
-                                // check size to see what unit it needs
-                                int i;
-                                for (i = 0; i < 16; i++) {
-                                    if ((outbuildtexturewidths[i] == width && outbuildtextureheights[i] == height) || outbuildtexturewidths[i] == 0) break;
-                                }
-
-                                if (i == 16) {
-                                    logger->warning("Texture unit full - draw building!");
-                                    texunit = 0;
-                                    texlayer = 0;
-                                } else {
-                                    if (outbuildtexturewidths[i] == 0) {
-                                        outbuildtexturewidths[i] = width;
-                                        outbuildtextureheights[i] = height;
-                                    }
-
-                                    texunit = i;
-                                    texlayer = numoutbuildtexloaded[i];
-
-                                    // encode unit and layer together
-                                    int encode = (texunit << 8) | texlayer;
-
-                                    if (numoutbuildtexloaded[i] < 256) {
-                                        // intsert into tex map
-                                        outbuildtexmap.insert(std::make_pair(texname, encode));
-                                        numoutbuildtexloaded[i]++;
-                                    } else {
-                                        logger->warning("Texture layer full - draw building!");
-                                        texunit = 0;
-                                        texlayer = 0;
-                                    }
-                                }
+                                texlayer = face.texlayer;
+                                texunit = face.texunit;
                             }
 
-                            if (face.IsTextureFrameTable()) {
-                                // TODO(pskelton): any instances where animTime is not consistent would need checking
-                                frame += pTextureFrameTable->textureFrameAnimTime((int64_t)face.resource);
-                                tex = pTextureFrameTable->GetFrameTexture((int64_t)face.resource, frame);
-                                if (!tex) break;
-                                texname = tex->GetName();
+                            if (texlayer == -1) { // texture has been reset - see if its in the map
+                                LevelTextureSlot slot = lookupLevelMeshTexture(mesh, face.GetTexture());
+                                face.texunit = texunit = slot.unit;
+                                face.texlayer = texlayer = slot.layer;
                             }
-                        } while (animLength > frame);
-
-                        face.texunit = texunit;
-                        face.texlayer = texlayer;
-                    }
-                }
-            }
-            //}
-        }
-
-        for (int l = 0; l < 16; l++) {
-            glGenVertexArrays(1, &outbuildVAO[l]);
-            glGenBuffers(1, &outbuildVBO[l]);
-
-            glBindVertexArray(outbuildVAO[l]);
-            glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-
-            glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, outbuildshaderstore[l], GL_DYNAMIC_DRAW);
-
-            // position attribute
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
-            glEnableVertexAttribArray(0);
-            // tex uv attribute
-            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
-            glEnableVertexAttribArray(1);
-            // tex unit attribute
-            // tex array layer attribute
-            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
-            glEnableVertexAttribArray(2);
-            // normals
-            glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
-            glEnableVertexAttribArray(3);
-            // attribs - not used here yet
-            glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
-            glEnableVertexAttribArray(4);
-        }
-
-        // texture set up
-
-        // loop over all units
-        for (int unit = 0; unit < 16; unit++) {
-            assert(numoutbuildtexloaded[unit] <= 256);
-            // skip if textures are empty
-            if (numoutbuildtexloaded[unit] == 0) continue;
-
-            glGenTextures(1, &outbuildtextures[unit]);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
-
-            // create blank memory for later texture submission
-            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, outbuildtexturewidths[unit], outbuildtextureheights[unit], numoutbuildtexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-            std::map<std::string, int>::iterator it = outbuildtexmap.begin();
-            while (it != outbuildtexmap.end()) {
-                // skip if wtrtyl
-                //if ((it->first).substr(0, 6) == "wtrtyl") {
-                //    std::cout << "skipped  " << it->first << std::endl;
-                 //   it++;
-                 //   continue;
-                //}
-
-                int comb = it->second;
-                int tlayer = comb & 0xFF;
-                int tunit = (comb & 0xFF00) >> 8;
-
-                if (tunit == unit) {
-                    // get texture
-                    auto texture = assets->getBitmap(it->first);
-
-                    glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                        0,
-                        0, 0, tlayer,
-                        outbuildtexturewidths[unit], outbuildtextureheights[unit], 1,
-                        GL_RGBA,
-                        GL_UNSIGNED_BYTE,
-                        texture->rgba().pixels().data());
-                }
-
-                it++;
-            }
-
-            //iterate through terrain tex map
-            //ignore wtrtyl
-            //laod in
-
-            //auto tile = pOutdoor->getTileDescByGrid(0, 0);
-            //bool border = tile->IsWaterBorderTile();
 
+                            int attribflags = 0;
 
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+                            if (face.uAttributes & FACE_IsFluid) attribflags |= 2;
+                            if (face.uAttributes & FACE_INDOOR_SKY) attribflags |= 0x400;
 
-            glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-        }
-    }
-
-        // else update verts - blank store
-        for (int i = 0; i < 16; i++) {
-            numoutbuildverts[i] = 0;
-        }
+                            if (face.uAttributes & FACE_FlowDown)
+                                attribflags |= 0x400;
+                            else if (face.uAttributes & FACE_FlowUp)
+                                attribflags |= 0x800;
 
-        for (BSPModel &model : pOutdoor->pBModels) {
-            bool reachable;
-            if (IsBModelVisible(&model, 256, &reachable)) {
-                //if (model.index == 35) continue;
-                model.field_40 |= 1;
-                if (!model.pFaces.empty()) {
-                    for (ODMFace &face : model.pFaces) {
-                        if (!face.Invisible()) {
-                            array_73D150[0].vWorldPosition = model.pVertices[face.pVertexIDs[0]];
-
-                            if (pCamera3D->is_face_faced_to_cameraODM(&face, &array_73D150[0])) {
-                                int texunit = 0;
-                                int texlayer = 0;
-
-                                if (face.IsTextureFrameTable()) {
-                                    texlayer = -1;
-                                    texunit = -1;
-                                } else {
-                                    texlayer = face.texlayer;
-                                    texunit = face.texunit;
-                                }
+                            if (face.uAttributes & FACE_FlowRight)
+                                attribflags |= 0x2000;
+                            else if (face.uAttributes & FACE_FlowLeft)
+                                attribflags |= 0x1000;
 
-                                if (texlayer == -1) { // texture has been reset - see if its in the map
-                                    GraphicsImage *tex = face.GetTexture();
-                                    std::string texname = tex->GetName();
-                                    auto mapiter = bsptexmap.find(texname);
-                                    if (mapiter != bsptexmap.end()) {
-                                        // if so, extract unit and layer
-                                        int unitlayer = mapiter->second;
-                                        face.texlayer = texlayer = unitlayer & 0xFF;
-                                        face.texunit = texunit = (unitlayer & 0xFF00) >> 8;
-                                    } else {
-                                        logger->warning("Texture not found in map!");
-                                        // TODO(pskelton): set to water for now - fountains in walls of mist
-                                        texunit = face.texlayer = 0;
-                                        texlayer = face.texunit = 0;
-                                    }
-                                }
+                            if (face.uAttributes & FACE_IsLava)
+                                attribflags |= 0x4000;
 
-                                int attribflags = 0;
-
-                                if (face.uAttributes & FACE_IsFluid) attribflags |= 2;
-                                if (face.uAttributes & FACE_INDOOR_SKY) attribflags |= 0x400;
-
-                                if (face.uAttributes & FACE_FlowDown)
-                                    attribflags |= 0x400;
-                                else if (face.uAttributes & FACE_FlowUp)
-                                    attribflags |= 0x800;
-
-                                if (face.uAttributes & FACE_FlowRight)
-                                    attribflags |= 0x2000;
-                                else if (face.uAttributes & FACE_FlowLeft)
-                                    attribflags |= 0x1000;
-
-                                if (face.uAttributes & FACE_IsLava)
-                                    attribflags |= 0x4000;
-
-                                if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
-                                    attribflags |= 0x00010000;
-
-                                // load up verts here
-                                for (int z = 0; z < (face.uNumVertices - 2); z++) {
-                                    // 123, 134, 145, 156..
-                                    GLshaderverts *thisvert = &outbuildshaderstore[texunit][numoutbuildverts[texunit]];
-
-                                    // copy first
-                                    thisvert->x = model.pVertices[face.pVertexIDs[0]].x;
-                                    thisvert->y = model.pVertices[face.pVertexIDs[0]].y;
-                                    thisvert->z = model.pVertices[face.pVertexIDs[0]].z;
-                                    thisvert->u = face.pTextureUIDs[0] + face.sTextureDeltaU;
-                                    thisvert->v = face.pTextureVIDs[0] + face.sTextureDeltaV;
-                                    thisvert->texunit = texunit;
-                                    thisvert->texturelayer = texlayer;
-                                    thisvert->normx = face.facePlane.normal.x;
-                                    thisvert->normy = face.facePlane.normal.y;
-                                    thisvert->normz = face.facePlane.normal.z;
-                                    thisvert->attribs = attribflags;
-                                    thisvert++;
-
-                                    // copy other two (z+1)(z+2)
-                                    for (unsigned i = 1; i < 3; ++i) {
-                                        thisvert->x = model.pVertices[face.pVertexIDs[z + i]].x;
-                                        thisvert->y = model.pVertices[face.pVertexIDs[z + i]].y;
-                                        thisvert->z = model.pVertices[face.pVertexIDs[z + i]].z;
-                                        thisvert->u = face.pTextureUIDs[z + i] + face.sTextureDeltaU;
-                                        thisvert->v = face.pTextureVIDs[z + i] + face.sTextureDeltaV;
-                                        thisvert->texunit = texunit;
-                                        thisvert->texturelayer = texlayer;
-                                        thisvert->normx = face.facePlane.normal.x;
-                                        thisvert->normy = face.facePlane.normal.y;
-                                        thisvert->normz = face.facePlane.normal.z;
-                                        thisvert->attribs = attribflags;
-                                        thisvert++;
-                                    }
+                            if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
+                                attribflags |= 0x00010000;
 
-                                    numoutbuildverts[texunit] += 3;
-                                    assert(numoutbuildverts[texunit] <= 9999);
+                            // load up verts here
+                            std::vector<GLshaderverts> &unitverts = mesh.vertices[texunit];
+                            for (int z = 0; z < (face.uNumVertices - 2); z++) {
+                                // 123, 134, 145, 156..
+                                for (int i : {0, z + 1, z + 2}) {
+                                    GLshaderverts &thisvert = unitverts.emplace_back();
+                                    thisvert.x = model.pVertices[face.pVertexIDs[i]].x;
+                                    thisvert.y = model.pVertices[face.pVertexIDs[i]].y;
+                                    thisvert.z = model.pVertices[face.pVertexIDs[i]].z;
+                                    thisvert.u = face.pTextureUIDs[i] + face.sTextureDeltaU;
+                                    thisvert.v = face.pTextureVIDs[i] + face.sTextureDeltaV;
+                                    thisvert.texunit = texunit;
+                                    thisvert.texturelayer = texlayer;
+                                    thisvert.normx = face.facePlane.normal.x;
+                                    thisvert.normy = face.facePlane.normal.y;
+                                    thisvert.normz = face.facePlane.normal.z;
+                                    thisvert.attribs = attribflags;
                                 }
                             }
                         }
@@ -3588,17 +3455,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             }
         }
 
-        for (int l = 0; l < 16; l++) {
-            if (numoutbuildverts[l]) {
-                glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-                // orphan buffer
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                // update buffer
-                glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numoutbuildverts[l], outbuildshaderstore[l]);
-            }
-        }
-
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        uploadLevelMeshVertices(mesh, outbuildVBO);
 
     // terrain debug
     if (engine->config->debug.Terrain.value())
@@ -3651,91 +3508,8 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     }
 
 
-    // TODO(pskelton): this should be a seperate function
-    // rest of lights stacking
-    GLuint num_lights = 0;
-
-    // get party torchlight as priority - can be radius == 0
-    for (int i = 0; i < 1; ++i) {
-        if (pMobileLightsStack->uNumLightsActive < 1) continue;
-
-        MobileLight &test = pMobileLightsStack->pLights[i];
-        std::string slotnum = std::to_string(num_lights);
-
-        float x = pMobileLightsStack->pLights[i].vPosition.x;
-        float y = pMobileLightsStack->pLights[i].vPosition.y;
-        float z = pMobileLightsStack->pLights[i].vPosition.z;
-
-        Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
-
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
-        num_lights++;
-    }
-
-    for (int i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i) {
-        // maximum 20 lights sent to shader at the moment
-        // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
-        if (num_lights >= 20) break;
-
-        std::string slotnum = std::to_string(num_lights);
-        StationaryLight &test = pStationaryLightsStack->pLights[i];
-
-        float x = test.vPosition.x;
-        float y = test.vPosition.y;
-        float z = test.vPosition.z;
-
-        Colorf color = test.uLightColor.toColorf();
-
-        float lightrad = test.uRadius;
-
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 1.0);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
-
-        num_lights++;
-    }
-
-    // mobile
-    for (int i = 1; i < pMobileLightsStack->uNumLightsActive; ++i) {
-        // maximum 20 lights sent to shader at the moment
-        // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
-        if (num_lights >= 20) break;
-
-        std::string slotnum = std::to_string(num_lights);
-        MobileLight &test = pMobileLightsStack->pLights[i];
-
-        float x = pMobileLightsStack->pLights[i].vPosition.x;
-        float y = pMobileLightsStack->pLights[i].vPosition.y;
-        float z = pMobileLightsStack->pLights[i].vPosition.z;
-
-        Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
-
-        float lightrad = pMobileLightsStack->pLights[i].uRadius;
-
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
-
-        num_lights++;
-    }
-
-    // blank the rest of the lights
-    for (int blank = num_lights; blank < 20; blank++) {
-        std::string slotnum = std::to_string(blank);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 0.0);
-    }
+    // point lights
+    _updateOutdoorPointLights();
 
 
     // toggle for water faces or not
@@ -3753,7 +3527,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
             glBindVertexArray(outbuildVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numoutbuildverts[unit]));
+            glDrawArrays(GL_TRIANGLES, 0, mesh.vertices[unit].size());
             drawcalls++;
         //}
     }
@@ -3846,9 +3620,6 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     ///////////////// shader end
 }
 
-GLshaderverts *BSPshaderstore[16] = { nullptr };
-int numBSPverts[16] = { 0 };
-
 void OpenGLRenderer::DrawIndoorFaces() {
     // void RenderOpenGL::DrawIndoorBSP() {
 
@@ -3867,6 +3638,8 @@ void OpenGLRenderer::DrawIndoorFaces() {
         _set_3d_projection_matrix();
         _set_3d_modelview_matrix();
 
+        LevelMesh &mesh = pIndoor->mesh;
+
         if (bspVAO[0] == 0) {
             // lights setup
             int cntnosect = 0;
@@ -3883,221 +3656,13 @@ void OpenGLRenderer::DrawIndoorFaces() {
             if (cntnosect)
                 logger->warning("{} lights - sector not found", cntnosect);
 
-            for (int i = 0; i < 16; i++) {
-                numBSPverts[i] = 0;
-                free(BSPshaderstore[i]);
-                BSPshaderstore[i] = nullptr;
-                BSPshaderstore[i] = (GLshaderverts*)malloc(sizeof(GLshaderverts) * 20000);
-            }
-
-
-            // reserve first 7 layers for water tiles in unit 0
-            auto wtrtexture = this->hd_water_tile_anim[0];
-            //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
-            //numterraintexloaded[0]++;
-            bsptexturewidths[0] = wtrtexture->width();
-            bsptextureheights[0] = wtrtexture->height();
-
-            for (int buff = 0; buff < 7; buff++) {
-                std::string container_name = fmt::format("HDWTR{:03}", buff);
-                bsptexmap.insert(std::make_pair(container_name, bsptexmap.size()));
-                bsptexloaded[0]++;
-            }
-
-
-            for (int test = 0; test < pIndoor->pFaces.size(); test++) {
-                BLVFace *face = &pIndoor->pFaces[test];
-
-                if (face->isPortal()) continue;
-                if (!face->GetTexture()) continue;
-                //if (face->uAttributes & FACE_IS_DOOR) continue;
-
-                // TODO(pskelton): Same as outdoors. When ODM and BLV face is combined - seperate out function
-                GraphicsImage *tex = face->GetTexture();
-                std::string texname = tex->GetName();
-
-                Duration animLength;
-                Duration frame;
-                if (face->IsTextureFrameTable()) {
-                    tex = pTextureFrameTable->GetFrameTexture((int64_t)face->resource, frame);
-                    animLength = pTextureFrameTable->textureFrameAnimLength((int64_t)face->resource);
-                    texname = tex->GetName();
-                }
-
-                int texunit = 0;
-                int texlayer = 0;
-                int attribflags = 0;
-
-                if (face->uAttributes & FACE_IsFluid) attribflags |= 2;
-                if (face->uAttributes & FACE_INDOOR_SKY) attribflags |= 0x400;
-
-                if (face->uAttributes & FACE_FlowDown)
-                    attribflags |= 0x400;
-                else if (face->uAttributes & FACE_FlowUp)
-                    attribflags |= 0x800;
-
-                if (face->uAttributes & FACE_FlowRight)
-                    attribflags |= 0x2000;
-                else if (face->uAttributes & FACE_FlowLeft)
-                    attribflags |= 0x1000;
-
-                if (face->uAttributes & FACE_IsLava)
-                    attribflags |= 0x4000;
-
-                if (face->uAttributes & (FACE_OUTLINED | FACE_IsSecret))
-                    attribflags |= 0x00010000;
-
-                // loop while running down animlength with frame animtimes
-                do {
-                    // check if tile->name is already in list
-                    auto mapiter = bsptexmap.find(texname);
-                    if (mapiter != bsptexmap.end()) {
-                        // if so, extract unit and layer
-                        int unitlayer = mapiter->second;
-                        // TODO(pskelton): make this a pair/struct rather than encoding
-                        texlayer = unitlayer & 0xFF;
-                        texunit = (unitlayer & 0xFF00) >> 8;
-                    } else if (texname == "wtrtyl") {
-                        // water tile
-                        texunit = 0;
-                        texlayer = 0;
-                    } else {
-                        // else need to add it
-                        auto thistexture = assets->getBitmap(texname);
-                        int width = thistexture->width();
-                        int height = thistexture->height();
-                        // check size to see what unit it needs
-                        int i;
-                        for (i = 0; i < 16; i++) {
-                            if ((bsptexturewidths[i] == width && bsptextureheights[i] == height) || bsptexturewidths[i] == 0) break;
-                        }
-
-                        if (i == 16) {
-                            logger->warning("Texture unit full - draw Indoor faces!");
-                            texunit = 0;
-                            texlayer = 0;
-                        } else {
-                            if (bsptexturewidths[i] == 0) {
-                                bsptexturewidths[i] = width;
-                                bsptextureheights[i] = height;
-                            }
-
-                            texunit = i;
-                            texlayer = bsptexloaded[i];
-
-                            // encode unit and layer together
-                            int encode = (texunit << 8) | texlayer;
-
-                            if (bsptexloaded[i] < 256) {
-                                // intsert into tex map
-                                bsptexmap.insert(std::make_pair(texname, encode));
-                                bsptexloaded[i]++;
-                            } else {
-                                logger->warning("Texture layer full - draw indoor faces!");
-                                texunit = 0;
-                                texlayer = 0;
-                            }
-                        }
-                    }
-
-                    if (face->IsTextureFrameTable()) {
-                        // TODO(pskelton): any instances where animTime is not consistent would need checking
-                        frame += pTextureFrameTable->textureFrameAnimTime((int64_t)face->resource);
-                        tex = pTextureFrameTable->GetFrameTexture((int64_t)face->resource, frame);
-                        if (!tex) break;
-                        texname = tex->GetName();
-                    }
-                } while (animLength > frame);
-
-                face->texunit = texunit;
-                face->texlayer = texlayer;
-            }
-
-            for (int l = 0; l < 16; l++) {
-                glGenVertexArrays(1, &bspVAO[l]);
-                glGenBuffers(1, &bspVBO[l]);
-
-                glBindVertexArray(bspVAO[l]);
-                glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-
-                // position attribute
-                glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
-                glEnableVertexAttribArray(0);
-                // tex uv attribute
-                glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
-                glEnableVertexAttribArray(1);
-                // tex unit attribute
-                // tex array layer attribute
-                glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
-                glEnableVertexAttribArray(2);
-                // normals
-                glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
-                glEnableVertexAttribArray(3);
-                // attribs
-                glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
-                glEnableVertexAttribArray(4);
-                //sector
-                glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void*)offsetof(GLshaderverts, sector));
-                glEnableVertexAttribArray(5);
-            }
-
-            // texture set up
-
-            // loop over all units
-            for (int unit = 0; unit < 16; unit++) {
-                assert(bsptexloaded[unit] <= 256);
-                // skip if textures are empty
-                if (bsptexloaded[unit] == 0) continue;
-
-                glGenTextures(1, &bsptextures[unit]);
-                glActiveTexture(GL_TEXTURE0);
-                glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
-                glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, bsptexturewidths[unit], bsptextureheights[unit], bsptexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-
-                std::map<std::string, int>::iterator it = bsptexmap.begin();
-                while (it != bsptexmap.end()) {
-                    int comb = it->second;
-                    int tlayer = comb & 0xFF;
-                    int tunit = (comb & 0xFF00) >> 8;
-
-                    if (tunit == unit) {
-                        // get texture
-                        auto texture = assets->getBitmap(it->first);
-
-                        glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                            0,
-                            0, 0, tlayer,
-                            bsptexturewidths[unit], bsptextureheights[unit], 1,
-                            GL_RGBA,
-                            GL_UNSIGNED_BYTE,
-                            texture->rgba().pixels().data());
-
-                        //numterraintexloaded[0]++;
-                    }
-
-                    it++;
-                }
-
-
-
-
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-                glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
-            }
+            createLevelMeshBuffers(mesh, bspVAO, bspVBO, true);
+            createLevelMeshTextures(mesh, bsptextures);
         }
 
 
             // update verts - blank store
-
-            for (int i = 0; i < 16; i++) {
-                numBSPverts[i] = 0;
-            }
+            mesh.clearVertices();
 
             bool drawnsky = false;
 
@@ -4199,86 +3764,41 @@ void OpenGLRenderer::DrawIndoorFaces() {
                             }
 
                             if (texlayer == -1) { // texture has been reset - see if its in the map
-                                GraphicsImage *tex = face->GetTexture();
-                                std::string texname = tex->GetName();
-                                auto mapiter = bsptexmap.find(texname);
-                                if (mapiter != bsptexmap.end()) {
-                                    // if so, extract unit and layer
-                                    int unitlayer = mapiter->second;
-                                    face->texlayer = texlayer = unitlayer & 0xFF;
-                                    face->texunit = texunit = (unitlayer & 0xFF00) >> 8;
-                                } else {
-                                    logger->warning("Texture not found in map!");
-                                    // TODO(pskelton): set to water for now - fountains in walls of mist
-                                    texlayer = face->texlayer = 0;
-                                    texunit = face->texunit = 0;
-                                }
+                                LevelTextureSlot slot = lookupLevelMeshTexture(mesh, face->GetTexture());
+                                face->texunit = texunit = slot.unit;
+                                face->texlayer = texlayer = slot.layer;
                             }
 
 
+                            std::vector<GLshaderverts> &unitverts = mesh.vertices[texunit];
                             for (int z = 0; z < (face->uNumVertices - 2); z++) {
                                 // 123, 134, 145, 156..
-                                GLshaderverts *thisvert = &BSPshaderstore[texunit][numBSPverts[texunit]];
-
-                                // copy first
-                                thisvert->x = pIndoor->pVertices[face->pVertexIDs[0]].x;
-                                thisvert->y = pIndoor->pVertices[face->pVertexIDs[0]].y;
-                                thisvert->z = pIndoor->pVertices[face->pVertexIDs[0]].z;
-                                thisvert->u = face->pVertexUIDs[0] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
-                                thisvert->v = face->pVertexVIDs[0] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
-                                if (face->Indoor_sky()) {
-                                    thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
-                                    thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
-                                }
-                                thisvert->texunit = texunit;
-                                thisvert->texturelayer = texlayer;
-                                thisvert->normx = face->facePlane.normal.x;
-                                thisvert->normy = face->facePlane.normal.y;
-                                thisvert->normz = face->facePlane.normal.z;
-                                thisvert->attribs = attribflags;
-                                thisvert->sector = face->uSectorID;
-                                thisvert++;
-
-                                // copy other two (z+1)(z+2)
-                                for (unsigned i = 1; i < 3; ++i) {
-                                    thisvert->x = pIndoor->pVertices[face->pVertexIDs[z + i]].x;
-                                    thisvert->y = pIndoor->pVertices[face->pVertexIDs[z + i]].y;
-                                    thisvert->z = pIndoor->pVertices[face->pVertexIDs[z + i]].z;
-                                    thisvert->u = face->pVertexUIDs[z + i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
-                                    thisvert->v = face->pVertexVIDs[z + i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
+                                for (int i : {0, z + 1, z + 2}) {
+                                    GLshaderverts &thisvert = unitverts.emplace_back();
+                                    thisvert.x = pIndoor->pVertices[face->pVertexIDs[i]].x;
+                                    thisvert.y = pIndoor->pVertices[face->pVertexIDs[i]].y;
+                                    thisvert.z = pIndoor->pVertices[face->pVertexIDs[i]].z;
+                                    thisvert.u = face->pVertexUIDs[i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
+                                    thisvert.v = face->pVertexVIDs[i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
                                     if (face->Indoor_sky()) {
-                                        thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
-                                        thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
+                                        thisvert.u = (skymodtimex + thisvert.u) * 0.25f;
+                                        thisvert.v = (skymodtimey + thisvert.v) * 0.25f;
                                     }
-                                    thisvert->texunit = texunit;
-                                    thisvert->texturelayer = texlayer;
-                                    thisvert->normx = face->facePlane.normal.x;
-                                    thisvert->normy = face->facePlane.normal.y;
-                                    thisvert->normz = face->facePlane.normal.z;
-                                    thisvert->attribs = attribflags;
-                                    thisvert->sector = face->uSectorID;
-                                    thisvert++;
+                                    thisvert.texunit = texunit;
+                                    thisvert.texturelayer = texlayer;
+                                    thisvert.normx = face->facePlane.normal.x;
+                                    thisvert.normy = face->facePlane.normal.y;
+                                    thisvert.normz = face->facePlane.normal.z;
+                                    thisvert.attribs = attribflags;
+                                    thisvert.sector = face->uSectorID;
                                 }
-
-                                numBSPverts[texunit] += 3;
-                                assert(numBSPverts[texunit] <= 19999);
                             }
                         }
                     }
                 }
             }
 
-            for (int l = 0; l < 16; l++) {
-                if (numBSPverts[l]) {
-                    glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-                    // orphan buffer
-                    glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                    // update buffer
-                    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numBSPverts[l], BSPshaderstore[l]);
-                }
-            }
-
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            uploadLevelMeshVertices(mesh, bspVBO);
 
         // terrain debug
         if (engine->config->debug.Terrain.value())
@@ -4354,122 +3874,39 @@ void OpenGLRenderer::DrawIndoorFaces() {
         glUniform3f(bspshader.uniformLocation("sun.diffuse"), diffuseon * (ambient + 0.3f), diffuseon * (ambient + 0.3f), diffuseon * (ambient + 0.3f));
         glUniform3f(bspshader.uniformLocation("sun.specular"), diffuseon * 1.0f, diffuseon * 0.8f, 0.0f);
 
-        // point lights - fspointlights
-        // rest of lights stacking
-        GLuint num_lights = 0;   // 1;
-
-        // get party torchlight as priority
-        for (int i = 0; i < 1; ++i) {
-            if (pMobileLightsStack->uNumLightsActive < 1) continue;
-
-            MobileLight &test = pMobileLightsStack->pLights[i];
-            std::string slotnum = std::to_string(num_lights);
-
-            float x = pMobileLightsStack->pLights[i].vPosition.x;
-            float y = pMobileLightsStack->pLights[i].vPosition.y;
-            float z = pMobileLightsStack->pLights[i].vPosition.z;
-
-            Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
-
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
-            num_lights++;
-        }
-
-        // stack the static lights next (wall torches)
-        for (int i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i) {
-            if (num_lights >= 40) break;
-
-            StationaryLight &test = pStationaryLightsStack->pLights[i];
+        // point lights
+        auto isStationaryLightVisible = [](const StationaryLight &light) {
+            // does light sphere collide with current sector
+            // expanded current sector
+            if (pIndoor->pSectors[pBLVRenderParams->uPartySectorID].pBounding.intersectsCube(light.vPosition, light.uRadius))
+                return IsSphereInFrustum(light.vPosition, light.uRadius);
 
             // is this on the sector list
             bool onlist = false;
             for (unsigned i = 0; i < pBspRenderer->uNumVisibleNotEmptySectors; ++i) {
-                int listsector = pBspRenderer->pVisibleSectorIDs_toDrawDecorsActorsEtcFrom[i];
-                if (test.uSectorID == listsector) {
+                if (light.uSectorID == pBspRenderer->pVisibleSectorIDs_toDrawDecorsActorsEtcFrom[i]) {
                     onlist = true;
                     break;
                 }
             }
-
-            // does light sphere collide with current sector
-            // expanded current sector
-            bool fromexpanded{ false };
-            if (pIndoor->pSectors[pBLVRenderParams->uPartySectorID].pBounding.intersectsCube(test.vPosition, test.uRadius)) {
-                onlist = true;
-                fromexpanded = true;
-            }
-
-            if (!onlist) continue;
+            if (!onlist)
+                return false;
 
             // cull through viewing frustum
-            bool visinfrustum{ false };
-            if (!fromexpanded) {
-                for (int i = 0; i < pBspRenderer->num_nodes; ++i) {
-                    if (pBspRenderer->nodes[i].uSectorID == test.uSectorID) {
-                        if (IsSphereInFrustum(test.vPosition, test.uRadius, pBspRenderer->nodes[i].ViewportNodeFrustum.data()))
-                            visinfrustum = true;
-                    }
-                }
-            } else {
-                if (IsSphereInFrustum(test.vPosition, test.uRadius)) visinfrustum = true;
-            }
-            if (!visinfrustum) continue;
-
-            std::string slotnum = std::to_string(num_lights);
-
-            float x = test.vPosition.x;
-            float y = test.vPosition.y;
-            float z = test.vPosition.z;
-
-            Colorf color = test.uLightColor.toColorf();
-
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 1.0f);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), test.uSectorID);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
-            num_lights++;
-        }
-
-        // whatevers left for mobile lights
-        for (int i = 1; i < pMobileLightsStack->uNumLightsActive; ++i) {
-            if (num_lights >= 40) break;
-
-            // TODO(pskelton): nearest lights should be prioritsed
-            MobileLight &test = pMobileLightsStack->pLights[i];
-            if (!IsSphereInFrustum(test.vPosition, test.uRadius)) continue;
-
-            std::string slotnum = std::to_string(num_lights);
-
-            float x = pMobileLightsStack->pLights[i].vPosition.x;
-            float y = pMobileLightsStack->pLights[i].vPosition.y;
-            float z = pMobileLightsStack->pLights[i].vPosition.z;
-
-            Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
-
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
-            num_lights++;
-        }
+            for (int i = 0; i < pBspRenderer->num_nodes; ++i)
+                if (pBspRenderer->nodes[i].uSectorID == light.uSectorID)
+                    if (IsSphereInFrustum(light.vPosition, light.uRadius, pBspRenderer->nodes[i].ViewportNodeFrustum.data()))
+                        return true;
+            return false;
+        };
+        auto isMobileLightVisible = [](const MobileLight &light) {
+            return IsSphereInFrustum(light.vPosition, light.uRadius);
+        };
 
-        // blank any lights not used
-        for (int blank = num_lights; blank < 40; blank++) {
-            std::string slotnum = std::to_string(blank);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 0.0);
-        }
+        Vec3f cameraPos(pCamera3D->vCameraPos.x, pCamera3D->vCameraPos.y, pCamera3D->vCameraPos.z);
+        selectShaderPointLights(*pStationaryLightsStack, *pMobileLightsStack, cameraPos, false, _pointLights,
+                                isStationaryLightVisible, isMobileLightVisible);
+        _uploadPointLights();
 
 
 
@@ -4488,7 +3925,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
             glBindVertexArray(bspVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numBSPverts[unit]));
+            glDrawArrays(GL_TRIANGLES, 0, mesh.vertices[unit].size());
             drawcalls++;
             //}
         }
@@ -5008,6 +4445,9 @@ bool OpenGLRenderer::ReloadShaders() {
         }
     }
 
+    for (OpenGLShader *shader : {&terrainshader, &outbuildshader, &bspshader})
+        shader->bindUniformBlock("PointLights", POINT_LIGHTS_UNIFORM_BINDING);
+
     logger->info("Shaders reloaded.");
     return true;
 }
@@ -5046,56 +4486,24 @@ void OpenGLRenderer::ReleaseTerrain() {
     terrainVBO = 0;
     terrainVAO = 0;
 
-    /*GLuint outbuildVBO, outbuildVAO;
-    GLuint outbuildtextures[8];
-    unsigned numoutbuildtexloaded[8];
-    unsigned outbuildtexturewidths[8];
-    unsigned outbuildtextureheights[8];
-    std::map<std::string, int> outbuildtexmap;*/
-
-    outbuildtexmap.clear();
-
     for (int i = 0; i < 16; i++) {
         glDeleteTextures(1, &outbuildtextures[i]);
         outbuildtextures[i] = 0;
-        numoutbuildtexloaded[i] = 0;
-        outbuildtexturewidths[i] = 0;
-        outbuildtextureheights[i] = 0;
         glDeleteBuffers(1, &outbuildVBO[i]);
         glDeleteVertexArrays(1, &outbuildVAO[i]);
         outbuildVBO[i] = 0;
         outbuildVAO[i] = 0;
-        if (outbuildshaderstore[i]) {
-            free(outbuildshaderstore[i]);
-            outbuildshaderstore[i] = nullptr;
-        }
     }
 }
 
 void OpenGLRenderer::ReleaseBSP() {
-    /*GLuint bspVBO, bspVAO;
-    GLuint bsptextures[16];
-    unsigned bsptexloaded[16];
-    unsigned bsptexturewidths[16];
-    unsigned bsptextureheights[16];
-    std::map<std::string, int> bsptexmap;*/
-
-    bsptexmap.clear();
-
     for (int i = 0; i < 16; i++) {
         glDeleteTextures(1, &bsptextures[i]);
         bsptextures[i] = 0;
-        bsptexloaded[i] = 0;
-        bsptexturewidths[i] = 0;
-        bsptextureheights[i] = 0;
         glDeleteBuffers(1, &bspVBO[i]);
         glDeleteVertexArrays(1, &bspVAO[i]);
         bspVAO[i] = 0;
         bspVBO[i] = 0;
-        if (BSPshaderstore[i]) {
-            free(BSPshaderstore[i]);
-            BSPshaderstore[i] = nullptr;
-        }
     }
 }
 
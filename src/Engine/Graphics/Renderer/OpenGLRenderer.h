@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <map>
@@ -14,6 +15,7 @@
 #include "Library/Color/Colorf.h"
 
 #include "OpenGLShader.h"
+#include "ShaderLights.h"
 
 class PlatformOpenGLContext;
 
@@ -97,6 +99,7 @@ class OpenGLRenderer : public BaseRenderer {
 
     virtual RgbaImage MakeViewportScreenshot(const int width, const int height) override;
     virtual RgbaImage MakeFullScreenshot() override;
+    virtual void captureScreenAsync(ScreenCaptureRequest request) override;
 
     virtual void BeginLightmaps() override;
     virtual void EndLightmaps() override;
@@ -143,6 +146,15 @@ class OpenGLRenderer : public BaseRenderer {
     void _initImGui();
     void _shutdownImGui();
 
+    void _updateOutdoorPointLights();
+    void _uploadPointLights();
+
+    struct ScreenCaptureBuffer;
+    ScreenCaptureBuffer _acquireScreenCaptureBuffer(size_t size);
+    void _recycleScreenCaptureBuffer(ScreenCaptureBuffer buffer);
+    void _readbackScreenCaptures();
+    void _releaseScreenCaptures();
+
     FrameLimiter _frameLimiter;
 
     // these are the view and projection matrices for submission to shaders
@@ -181,21 +193,13 @@ class OpenGLRenderer : public BaseRenderer {
     unsigned int terraintexturesizes[8]{};
     std::map<std::string, int> terraintexmap;
 
-    // outside building shader
+    // outside building shader, textures & vertices come from pOutdoor->mesh
     GLuint outbuildVBO[16]{}, outbuildVAO[16]{};
     GLuint outbuildtextures[16]{};
-    unsigned int numoutbuildtexloaded[16]{};
-    unsigned int outbuildtexturewidths[16]{};
-    unsigned int outbuildtextureheights[16]{};
-    std::map<std::string, int> outbuildtexmap;
 
-    // indoors bsp shader
+    // indoors bsp shader, textures & vertices come from pIndoor->mesh
     GLuint bspVBO[16]{}, bspVAO[16]{};
     GLuint bsptextures[16]{};
-    unsigned int bsptexloaded[16]{};
-    unsigned int bsptexturewidths[16]{};
-    unsigned int bsptextureheights[16]{};
-    std::map<std::string, int> bsptexmap;
 
     // text shader
     GLuint textVBO{}, textVAO{};
@@ -217,6 +221,25 @@ class OpenGLRenderer : public BaseRenderer {
     // forced perspective shader
     GLuint forceperVBO{}, forceperVAO{};
 
+    // point lights uniform buffer, shared by terrain, outdoor buildings & indoor bsp shaders
+    GLuint _pointLightsUBO{};
+    ShaderPointLights _pointLights;
+    bool _pointLightsUploaded = false;
+
+    // async screen captures, waiting for the GPU to finish writing into their pixel pack buffers
+    struct ScreenCaptureBuffer {
+        GLuint id = 0;
+        size_t size = 0; // Size of the buffer's data store, in bytes.
+    };
+    struct PendingScreenCapture {
+        ScreenCaptureBuffer buffer;
+        GLsync fence = nullptr;
+        Sizei size;
+        ScreenCaptureRequest request;
+    };
+    std::deque<PendingScreenCapture> _pendingScreenCaptures;
+    std::vector<ScreenCaptureBuffer> _freeScreenCaptureBuffers; // pixel pack buffers reused between captures
+
     // Fog parameters
     Colorf fog;
     int fogstart{};
@@ -1,12 +1,17 @@
 #include "OpenGLShader.h"
 
+#include <algorithm>
 #include <cassert>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <glad/gl.h> // NOLINT: this is not a C system include.
 
 #include "Library/Logger/Logger.h"
 
+#include "Utility/String/Format.h"
+
 static std::string compileErrors(int shader) {
     GLint success = 1;
     GLchar infoLog[2048];
@@ -76,6 +81,7 @@ bool OpenGLShader::load(const Blob &vertSource, const Blob &fragSource, bool ope
     }
 
     _id = result;
+    cacheUniformLocations();
     return true;
 }
 
@@ -85,12 +91,14 @@ void OpenGLShader::release() {
 
     glDeleteProgram(_id);
     _id = 0;
+    _uniformLocations.clear();
 }
 
-int OpenGLShader::uniformLocation(const char *name) {
+int OpenGLShader::uniformLocation(std::string_view name) const {
     assert(isValid());
 
-    return glGetUniformLocation(_id, name);
+    auto pos = _uniformLocations.find(name);
+    return pos == _uniformLocations.end() ? -1 : pos->second;
 }
 
 int OpenGLShader::attribLocation(const char *name) {
@@ -99,6 +107,14 @@ int OpenGLShader::attribLocation(const char *name) {
     return glGetAttribLocation(_id, name);
 }
 
+void OpenGLShader::bindUniformBlock(const char *name, int binding) {
+    assert(isValid());
+
+    GLuint index = glGetUniformBlockIndex(_id, name);
+    if (index != GL_INVALID_INDEX)
+        glUniformBlockBinding(_id, index, binding);
+}
+
 void OpenGLShader::use() {
     assert(isValid());
 
@@ -129,3 +145,36 @@ unsigned OpenGLShader::loadShader(const Blob &source, int type, bool openGLES) {
 
     return result;
 }
+
+void OpenGLShader::cacheUniformLocations() {
+    _uniformLocations.clear();
+
+    GLint count = 0;
+    GLint maxLength = 0;
+    glGetProgramiv(_id, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::vector<GLchar> buffer(std::max(maxLength, 1));
+    for (GLint i = 0; i < count; i++) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(_id, i, buffer.size(), &length, &size, &type, buffer.data());
+
+        std::string name(buffer.data(), length);
+        GLint location = glGetUniformLocation(_id, name.c_str());
+        if (location == -1)
+            continue; // Uniform block member, these don't have locations.
+
+        // Arrays are reported once as "name[0]", but "name" is also a valid way to refer to the first element.
+        if (name.ends_with("[0]")) {
+            std::string baseName = name.substr(0, name.size() - 3);
+            for (GLint j = 1; j < size; j++) {
+                std::string elementName = fmt::format("{}[{}]", baseName, j);
+                _uniformLocations.emplace(elementName, glGetUniformLocation(_id, elementName.c_str()));
+            }
+            _uniformLocations.emplace(std::move(baseName), location);
+        }
+        _uniformLocations.emplace(std::move(name), location);
+    }
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "Utility/Memory/Blob.h"
+#include "Utility/String/TransparentFunctors.h"
 
 /**
  * Class for loading in and building gl shaders.
@@ -23,14 +26,31 @@ class OpenGLShader {
     [[nodiscard]] bool load(const Blob &vertSource, const Blob &fragSource, bool openGLES);
     void release();
 
-    [[nodiscard]] int uniformLocation(const char *name);
+    /**
+     * @param name                      Name of the uniform to look up, e.g. `"fog.color"`.
+     * @return                          Location of the uniform, or -1 if there is no such active uniform in this
+     *                                  shader. Locations are cached at link time, so this function doesn't call into
+     *                                  OpenGL.
+     */
+    [[nodiscard]] int uniformLocation(std::string_view name) const;
     [[nodiscard]] int attribLocation(const char *name);
 
+    /**
+     * Binds a uniform block in this shader to the provided uniform buffer binding point. Does nothing if there is
+     * no such uniform block in this shader.
+     *
+     * @param name                      Name of the uniform block.
+     * @param binding                   Uniform buffer binding point.
+     */
+    void bindUniformBlock(const char *name, int binding);
+
     void use();
 
  private:
     [[nodiscard]] unsigned loadShader(const Blob &source, int type, bool openGLES);
+    void cacheUniformLocations();
 
  private:
     unsigned _id = 0;
+    std::unordered_map<TransparentString, int, TransparentStringHash, TransparentStringEquals> _uniformLocations;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "Library/Color/ColorTable.h"
 #include "Library/Geometry/Rect.h"
 
+#include "ScreenCapture.h"
 #include "TextureRenderId.h"
 #include "Engine/Graphics/RenderEntities.h"
 
@@ -146,7 +148,21 @@ class Renderer {
 
     virtual RgbaImage MakeFullScreenshot() = 0;
 
-    virtual std::vector<Actor *> getActorsInViewport(int pDepth) = 0;
+    /**
+     * Starts an asynchronous capture of the current render target. Unlike `MakeFullScreenshot`, this doesn't stall
+     * the frame: the pixels are read back once the GPU is done with them, and the post-processing is done on a worker
+     * thread. Request callback is invoked from a later `swapBuffers` call.
+     *
+     * @param request                       Capture request.
+     */
+    virtual void captureScreenAsync(ScreenCaptureRequest request) = 0;
+
+    /**
+     * @param pDepth                    Max depth of the actors to look up.
+     * @return                          Alive actors in the viewport. Returned vector is allocated from the frame
+     *                                  arena, and thus shouldn't outlive the current frame.
+     */
+    virtual std::pmr::vector<Actor *> getActorsInViewport(int pDepth) = 0;
 
     virtual void BeginLightmaps() = 0;
     virtual void EndLightmaps() = 0;
@@ -0,0 +1,109 @@
+#include "ScreenCapture.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+
+#include "Library/Image/ImageFunctions.h"
+#include "Library/Image/PCX.h"
+
+RgbaImage processScreenCapture(RgbaImageView pixels, Sizei size) {
+    if (!pixels)
+        return RgbaImage();
+
+    ssize_t srcWidth = pixels.width();
+    ssize_t srcHeight = pixels.height();
+    if (size.w <= 0 || size.h <= 0 || (size.w == srcWidth && size.h == srcHeight))
+        return flipVertically(pixels);
+
+    float intervalX = static_cast<float>(srcWidth) / size.w;
+    float intervalY = static_cast<float>(srcHeight) / size.h;
+
+    RgbaImage result = RgbaImage::uninitialized(size.w, size.h);
+    for (int y = 0; y < size.h; ++y) {
+        ssize_t srcY = srcHeight - static_cast<ssize_t>(std::ceil((y + 1) * intervalY));
+        srcY = std::clamp<ssize_t>(srcY, 0, srcHeight - 1);
+        std::span<const Color> srcLine = pixels[srcY];
+        std::span<Color> dstLine = result[y];
+        for (int x = 0; x < size.w; ++x)
+            dstLine[x] = srcLine[std::min<ssize_t>(x * intervalX, srcWidth - 1)];
+    }
+    return result;
+}
+
+ScreenCapture::~ScreenCapture() {
+    if (!_thread.joinable())
+        return;
+
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _jobAdded.notify_one();
+    _thread.join();
+}
+
+void ScreenCapture::submit(RgbaImage pixels, ScreenCaptureRequest request) {
+    assert(request.callback);
+
+    {
+        std::lock_guard lock(_mutex);
+        Job &job = _jobs.emplace_back();
+        job.pixels = std::move(pixels);
+        job.request = std::move(request);
+    }
+    _jobAdded.notify_one();
+
+    if (!_thread.joinable())
+        _thread = std::thread([this] { run(); });
+}
+
+void ScreenCapture::deliver() {
+    std::deque<Job> finishedJobs;
+    {
+        std::lock_guard lock(_mutex);
+        finishedJobs.swap(_finishedJobs);
+    }
+
+    // Callbacks are invoked w/o holding the lock, so that they can submit new captures.
+    for (Job &job : finishedJobs)
+        job.request.callback(std::move(job.result));
+}
+
+void ScreenCapture::flush() {
+    {
+        std::unique_lock lock(_mutex);
+        _jobFinished.wait(lock, [this] { return _jobs.empty() && _runningJobs == 0; });
+    }
+    deliver();
+}
+
+size_t ScreenCapture::pendingCount() const {
+    std::lock_guard lock(_mutex);
+    return _jobs.size() + _runningJobs + _finishedJobs.size();
+}
+
+void ScreenCapture::run() {
+    std::unique_lock lock(_mutex);
+    while (true) {
+        _jobAdded.wait(lock, [this] { return _stopping || !_jobs.empty(); });
+        if (_stopping)
+            return;
+
+        Job job = std::move(_jobs.front());
+        _jobs.pop_front();
+        _runningJobs++;
+        lock.unlock();
+
+        job.result.image = processScreenCapture(job.pixels, job.request.size);
+        if (job.request.encodePcx)
+            job.result.pcx = pcx::encode(job.result.image);
+        job.pixels = RgbaImage();
+
+        lock.lock();
+        _runningJobs--;
+        _finishedJobs.push_back(std::move(job));
+        _jobFinished.notify_all();
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Library/Geometry/Rect.h"
+#include "Library/Geometry/Size.h"
+#include "Library/Image/Image.h"
+
+#include "Utility/Memory/Blob.h"
+
+struct ScreenCaptureResult {
+    RgbaImage image; // Captured image, top-down.
+    Blob pcx; // PCX-encoded image, only filled if it was requested.
+};
+
+struct ScreenCaptureRequest {
+    Recti area; // Area of the render target to capture, top-down. Empty rect means the whole render target.
+    Sizei size; // Size to downscale the captured area to. Zero size means no downscaling.
+    bool encodePcx = false; // Whether the result should also be encoded into PCX.
+    std::function<void(ScreenCaptureResult)> callback; // Invoked on the main thread once the capture is done.
+};
+
+/**
+ * Post-processes the pixels read back from the render target. Downscaling uses nearest-neighbor sampling.
+ *
+ * @param pixels                        Captured pixels, bottom-up, as returned by `glReadPixels`.
+ * @param size                          Size to downscale to, zero size means no downscaling.
+ * @return                              Top-down image of the requested size.
+ */
+RgbaImage processScreenCapture(RgbaImageView pixels, Sizei size);
+
+/**
+ * Worker thread for screen captures.
+ *
+ * Renderers read back the pixels in whatever way suits them, and then hand them over to this class. Flipping,
+ * downscaling & encoding are done on the worker thread, and the results are handed back to the main thread in
+ * `deliver`, in the order the captures were submitted.
+ *
+ * The worker thread is started on the first `submit` call.
+ */
+class ScreenCapture {
+ public:
+    ScreenCapture() = default;
+    ~ScreenCapture();
+
+    ScreenCapture(const ScreenCapture &) = delete;
+    ScreenCapture &operator=(const ScreenCapture &) = delete;
+
+    /**
+     * @param pixels                    Captured pixels of `request.area`, bottom-up.
+     * @param request                   Capture request.
+     */
+    void submit(RgbaImage pixels, ScreenCaptureRequest request);
+
+    /**
+     * Invokes callbacks for all finished captures. Must be called from the main thread.
+     */
+    void deliver();
+
+    /**
+     * Waits for all submitted captures to finish, and then delivers them. Must be called from the main thread.
+     */
+    void flush();
+
+    /**
+     * @return                          Number of captures that were submitted, but not yet delivered.
+     */
+    [[nodiscard]] size_t pendingCount() const;
+
+ private:
+    struct Job {
+        RgbaImage pixels;
+        ScreenCaptureRequest request;
+        ScreenCaptureResult result;
+    };
+
+    void run();
+
+ private:
+    mutable std::mutex _mutex;
+    std::condition_variable _jobAdded;
+    std::condition_variable _jobFinished;
+    std::deque<Job> _jobs; // Jobs waiting to be processed.
+    std::deque<Job> _finishedJobs; // Jobs waiting to be delivered.
+    size_t _runningJobs = 0;
+    bool _stopping = false;
+    std::thread _thread;
+};
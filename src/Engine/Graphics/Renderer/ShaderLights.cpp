@@ -0,0 +1,41 @@
+#include "ShaderLights.h"
+
+#include <algorithm>
+
+#include "Library/Color/Colorf.h"
+
+static Vec3f toVec3f(Color color) {
+    Colorf result = color.toColorf();
+    return Vec3f(result.r, result.g, result.b);
+}
+
+ShaderPointLight detail::makeShaderLight(const StationaryLight &light, bool coloredSpecular) {
+    ShaderPointLight result;
+    result.position = light.vPosition;
+    result.type = static_cast<float>(SHADER_LIGHT_STATIONARY);
+    result.sector = light.uSectorID;
+    result.radius = light.uRadius;
+    result.ambient = toVec3f(light.uLightColor);
+    result.diffuse = result.ambient;
+    if (coloredSpecular)
+        result.specular = result.ambient;
+    return result;
+}
+
+ShaderPointLight detail::makeShaderLight(const MobileLight &light, bool coloredSpecular) {
+    ShaderPointLight result;
+    result.position = light.vPosition;
+    result.type = static_cast<float>(SHADER_LIGHT_MOBILE);
+    result.radius = light.uRadius;
+    result.ambient = toVec3f(light.uLightColor);
+    result.diffuse = result.ambient;
+    if (coloredSpecular)
+        result.specular = result.ambient;
+    return result;
+}
+
+int detail::pickNearestLights(std::span<std::pair<float, int>> candidates, int limit) {
+    int count = std::clamp(limit, 0, static_cast<int>(candidates.size()));
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end());
+    return count;
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
+
+#include "Engine/Graphics/LightsStack.h"
+
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Number of point lights in the `PointLights` uniform block. Must match `MAX_POINT_LIGHTS` in the terrain, outdoor
+ * building & indoor BSP shaders.
+ */
+static constexpr int MAX_SHADER_POINT_LIGHTS = 40;
+
+/**
+ * Uniform buffer binding point for the `PointLights` uniform block.
+ */
+static constexpr int POINT_LIGHTS_UNIFORM_BINDING = 0;
+
+enum class ShaderLightType {
+    SHADER_LIGHT_DISABLED = 0,
+    SHADER_LIGHT_STATIONARY = 1,
+    SHADER_LIGHT_MOBILE = 2
+};
+using enum ShaderLightType;
+
+/**
+ * Point light as laid out in the std140 `PointLights` uniform block. Every `vec3` is followed by a `float`, so the
+ * C++ layout matches std140 without any explicit padding.
+ */
+struct ShaderPointLight {
+    Vec3f position;
+    float type = static_cast<float>(SHADER_LIGHT_DISABLED);
+    Vec3f ambient;
+    float radius = 0;
+    Vec3f diffuse;
+    float sector = 0;
+    Vec3f specular;
+    float unused = 0;
+};
+static_assert(sizeof(ShaderPointLight) == 64);
+
+using ShaderPointLights = std::array<ShaderPointLight, MAX_SHADER_POINT_LIGHTS>;
+
+namespace detail {
+struct AcceptAllLights {
+    bool operator()(const auto &) const {
+        return true;
+    }
+};
+
+ShaderPointLight makeShaderLight(const StationaryLight &light, bool coloredSpecular);
+ShaderPointLight makeShaderLight(const MobileLight &light, bool coloredSpecular);
+
+/**
+ * Sorts `candidates` by distance, nearest first, and leaves only the first `limit` of them. Ties are broken by light
+ * index, so the result doesn't depend on the sort implementation.
+ *
+ * @return                          Number of candidates left.
+ */
+int pickNearestLights(std::span<std::pair<float, int>> candidates, int limit);
+} // namespace detail
+
+/**
+ * Selects point lights for the `PointLights` uniform block.
+ *
+ * Party torchlight (mobile light #0) always goes into slot #0, even if its radius is zero. Remaining slots are filled
+ * with stationary lights first and then with mobile lights, in both cases nearest to `viewPos` first. Unused slots
+ * in `lights` are disabled.
+ *
+ * This function doesn't touch the GPU, and can be freely used from tests.
+ *
+ * @param stationary                Stationary lights stack.
+ * @param mobile                    Mobile lights stack.
+ * @param viewPos                   Camera position.
+ * @param coloredSpecular           Whether non-torch lights should get a specular component. Outdoor shaders use it,
+ *                                  indoor ones don't.
+ * @param[out] lights               Output lights. Size of this span is the max number of lights to select.
+ * @param stationaryFilter          Predicate that's called for each stationary light, lights for which it returns
+ *                                  `false` are skipped.
+ * @param mobileFilter              Same as `stationaryFilter`, but for mobile lights. Not called for the torchlight.
+ * @return                          Number of selected lights.
+ */
+template<class StationaryFilter = detail::AcceptAllLights, class MobileFilter = detail::AcceptAllLights>
+int selectShaderPointLights(const LightsStack_StationaryLight_ &stationary, const LightsStack_MobileLight_ &mobile,
+                            Vec3f viewPos, bool coloredSpecular, std::span<ShaderPointLight> lights,
+                            StationaryFilter &&stationaryFilter = {}, MobileFilter &&mobileFilter = {}) {
+    int maxLights = lights.size();
+    int numLights = 0;
+    std::array<std::pair<float, int>, std::tuple_size_v<decltype(stationary.pLights)>> candidates;
+
+    // Party torchlight always goes first.
+    if (mobile.uNumLightsActive > 0 && numLights < maxLights) {
+        ShaderPointLight &torch = lights[numLights++];
+        torch = detail::makeShaderLight(mobile.pLights[0], false);
+    }
+
+    int numCandidates = 0;
+    for (int i = 0; i < stationary.uNumLightsActive; i++)
+        if (stationaryFilter(stationary.pLights[i]))
+            candidates[numCandidates++] = {(stationary.pLights[i].vPosition - viewPos).lengthSqr(), i};
+    numCandidates = detail::pickNearestLights(std::span(candidates).first(numCandidates), maxLights - numLights);
+    for (int i = 0; i < numCandidates; i++)
+        lights[numLights++] = detail::makeShaderLight(stationary.pLights[candidates[i].second], coloredSpecular);
+
+    numCandidates = 0;
+    for (int i = 1; i < mobile.uNumLightsActive; i++)
+        if (mobileFilter(mobile.pLights[i]))
+            candidates[numCandidates++] = {(mobile.pLights[i].vPosition - viewPos).lengthSqr(), i};
+    numCandidates = detail::pickNearestLights(std::span(candidates).first(numCandidates), maxLights - numLights);
+    for (int i = 0; i < numCandidates; i++)
+        lights[numLights++] = detail::makeShaderLight(mobile.pLights[candidates[i].second], coloredSpecular);
+
+    std::fill(lights.begin() + numLights, lights.end(), ShaderPointLight());
+    return numLights;
+}
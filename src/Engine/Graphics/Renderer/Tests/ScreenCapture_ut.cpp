@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/Renderer/ScreenCapture.h"
+
+#include "Library/Image/PCX.h"
+
+static RgbaImage makeGradient(int width, int height) {
+    RgbaImage result = RgbaImage::uninitialized(width, height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            result[y][x] = Color(x, y, 0);
+    return result;
+}
+
+UNIT_TEST(ScreenCapture, Flip) {
+    RgbaImage pixels = makeGradient(16, 8);
+    RgbaImage image = processScreenCapture(pixels, Sizei(0, 0));
+    EXPECT_EQ(image.width(), 16);
+    EXPECT_EQ(image.height(), 8);
+    for (int y = 0; y < 8; y++)
+        for (int x = 0; x < 16; x++)
+            EXPECT_EQ(image[y][x], Color(x, 7 - y, 0));
+
+    EXPECT_FALSE(processScreenCapture(RgbaImage(), Sizei(10, 10)));
+}
+
+UNIT_TEST(ScreenCapture, Downscale) {
+    RgbaImage pixels = makeGradient(8, 8);
+    RgbaImage image = processScreenCapture(pixels, Sizei(4, 2));
+    EXPECT_EQ(image.width(), 4);
+    EXPECT_EQ(image.height(), 2);
+
+    // Top row of the result comes from the top of the bottom-up source.
+    for (int x = 0; x < 4; x++) {
+        EXPECT_EQ(image[0][x], Color(x * 2, 4, 0));
+        EXPECT_EQ(image[1][x], Color(x * 2, 0, 0));
+    }
+}
+
+UNIT_TEST(ScreenCapture, Ordering) {
+    ScreenCapture capture;
+    std::vector<int> delivered;
+
+    for (int i = 0; i < 10; i++) {
+        ScreenCaptureRequest request;
+        request.size = Sizei(4, 4);
+        request.encodePcx = i % 2 == 0;
+        request.callback = [&delivered, i] (ScreenCaptureResult result) {
+            EXPECT_EQ(result.image.width(), 4);
+            EXPECT_EQ(result.image.height(), 4);
+            if (i % 2 == 0) {
+                EXPECT_TRUE(std::ranges::equal(pcx::decode(result.pcx).pixels(), result.image.pixels()));
+            } else {
+                EXPECT_FALSE(result.pcx);
+            }
+            delivered.push_back(i);
+        };
+        capture.submit(makeGradient(32 + i, 32), std::move(request));
+    }
+
+    capture.flush();
+    EXPECT_EQ(capture.pendingCount(), 0);
+    EXPECT_EQ(delivered, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
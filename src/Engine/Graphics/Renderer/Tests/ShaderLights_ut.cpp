@@ -0,0 +1,87 @@
+#include <array>
+#include <memory>
+#include <span>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/Renderer/ShaderLights.h"
+
+static void addStationaryLight(LightsStack_StationaryLight_ *stack, Vec3f pos, int radius = 100) {
+    StationaryLight &light = stack->pLights[stack->uNumLightsActive++];
+    light.vPosition = pos;
+    light.uRadius = radius;
+    light.uLightColor = Color(255, 255, 255);
+}
+
+static void addMobileLight(LightsStack_MobileLight_ *stack, Vec3f pos, int radius = 100) {
+    MobileLight &light = stack->pLights[stack->uNumLightsActive++];
+    light.vPosition = pos;
+    light.uRadius = radius;
+    light.uLightColor = Color(255, 255, 255);
+}
+
+UNIT_TEST(ShaderLights, Empty) {
+    auto stationary = std::make_unique<LightsStack_StationaryLight_>();
+    auto mobile = std::make_unique<LightsStack_MobileLight_>();
+
+    ShaderPointLights lights;
+    lights[0].type = static_cast<float>(SHADER_LIGHT_MOBILE);
+    EXPECT_EQ(selectShaderPointLights(*stationary, *mobile, Vec3f(), false, lights), 0);
+    for (const ShaderPointLight &light : lights)
+        EXPECT_EQ(light.type, static_cast<float>(SHADER_LIGHT_DISABLED));
+}
+
+UNIT_TEST(ShaderLights, TorchGoesFirst) {
+    auto stationary = std::make_unique<LightsStack_StationaryLight_>();
+    auto mobile = std::make_unique<LightsStack_MobileLight_>();
+    addStationaryLight(stationary.get(), Vec3f(1, 0, 0));
+    addMobileLight(mobile.get(), Vec3f(1000, 0, 0), 0); // Torchlight, zero radius & far away.
+
+    ShaderPointLights lights;
+    EXPECT_EQ(selectShaderPointLights(*stationary, *mobile, Vec3f(), true, std::span(lights).first(1)), 1);
+    EXPECT_EQ(lights[0].type, static_cast<float>(SHADER_LIGHT_MOBILE));
+    EXPECT_EQ(lights[0].position, Vec3f(1000, 0, 0));
+    EXPECT_EQ(lights[0].specular, Vec3f()); // Torchlight never has specular.
+}
+
+UNIT_TEST(ShaderLights, NearestFirst) {
+    auto stationary = std::make_unique<LightsStack_StationaryLight_>();
+    auto mobile = std::make_unique<LightsStack_MobileLight_>();
+    addMobileLight(mobile.get(), Vec3f()); // Torchlight.
+    for (int i = 0; i < 10; i++)
+        addStationaryLight(stationary.get(), Vec3f(100 * (10 - i), 0, 0));
+    for (int i = 0; i < 10; i++)
+        addMobileLight(mobile.get(), Vec3f(0, 50 * (10 - i), 0));
+
+    std::array<ShaderPointLight, 8> lights;
+    EXPECT_EQ(selectShaderPointLights(*stationary, *mobile, Vec3f(), false, lights), 8);
+
+    // Stationary lights take priority, nearest ones first.
+    EXPECT_EQ(lights[0].type, static_cast<float>(SHADER_LIGHT_MOBILE));
+    for (int i = 1; i < 8; i++) {
+        EXPECT_EQ(lights[i].type, static_cast<float>(SHADER_LIGHT_STATIONARY));
+        EXPECT_EQ(lights[i].position, Vec3f(100 * i, 0, 0));
+    }
+}
+
+UNIT_TEST(ShaderLights, Filters) {
+    auto stationary = std::make_unique<LightsStack_StationaryLight_>();
+    auto mobile = std::make_unique<LightsStack_MobileLight_>();
+    addMobileLight(mobile.get(), Vec3f()); // Torchlight, not filtered.
+    for (int i = 0; i < 4; i++)
+        addStationaryLight(stationary.get(), Vec3f(i, 0, 0), 10 * i);
+    for (int i = 0; i < 4; i++)
+        addMobileLight(mobile.get(), Vec3f(0, i, 0), 10 * i);
+
+    auto filter = [](const auto &light) { return light.uRadius >= 20; };
+
+    ShaderPointLights lights;
+    EXPECT_EQ(selectShaderPointLights(*stationary, *mobile, Vec3f(), true, lights, filter, filter), 5);
+    EXPECT_EQ(lights[0].type, static_cast<float>(SHADER_LIGHT_MOBILE));
+    EXPECT_EQ(lights[1].position, Vec3f(2, 0, 0));
+    EXPECT_EQ(lights[2].position, Vec3f(3, 0, 0));
+    EXPECT_EQ(lights[3].position, Vec3f(0, 2, 0));
+    EXPECT_EQ(lights[4].position, Vec3f(0, 3, 0));
+    EXPECT_EQ(lights[4].specular, Vec3f(1, 1, 1));
+    EXPECT_EQ(lights[5].type, static_cast<float>(SHADER_LIGHT_DISABLED));
+}
@@ -0,0 +1,57 @@
+#include "SectorDetection.h"
+
+#include <cassert>
+#include <algorithm>
+
+static float axisDistance(float a1, float a2, float b1, float b2) {
+    return std::max({0.0f, b1 - a2, a1 - b2});
+}
+
+static float boxDistanceSqr(const BBoxf &a, const BBoxf &b) {
+    float dx = axisDistance(a.x1, a.x2, b.x1, b.x2);
+    float dy = axisDistance(a.y1, a.y2, b.y1, b.y2);
+    float dz = axisDistance(a.z1, a.z2, b.z1, b.z2);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+void SectorDetection::clear() {
+    _sectorCount = 0;
+    _wordsPerSector = 0;
+    _detectable.clear();
+}
+
+void SectorDetection::build(const SectorGraph &graph) {
+    assert(graph.sectorBounds.size() == graph.portals.size());
+
+    _sectorCount = graph.portals.size();
+    _wordsPerSector = (_sectorCount + 63) / 64;
+    _detectable.assign(_sectorCount * _wordsPerSector, 0);
+
+    constexpr float maxDistance = MAX_DETECTION_DISTANCE + DETECTION_SLACK;
+
+    std::vector<int> front, nextFront;
+    for (int from = 0; from < _sectorCount; from++) {
+        uint64_t *row = _detectable.data() + from * _wordsPerSector;
+        auto visit = [&](int sector) {
+            uint64_t mask = 1ull << (sector % 64);
+            if (row[sector / 64] & mask)
+                return false;
+            row[sector / 64] |= mask;
+            return true;
+        };
+
+        // Breadth-first search, hop by hop, only through portals that a ray from this sector can reach.
+        const BBoxf &fromBounds = graph.sectorBounds[from];
+        visit(from);
+        front.assign(1, from);
+        for (int hop = 0; hop < MAX_DETECTION_HOPS && !front.empty(); hop++) {
+            nextFront.clear();
+            for (int sector : front)
+                for (const SectorPortal &portal : graph.portals[sector])
+                    if (portal.sector >= 0 && portal.sector < _sectorCount &&
+                        boxDistanceSqr(fromBounds, portal.bounds) <= maxDistance * maxDistance && visit(portal.sector))
+                        nextFront.push_back(portal.sector);
+            front.swap(nextFront);
+        }
+    }
+}
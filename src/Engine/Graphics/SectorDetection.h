@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+
+/**
+ * Portal from one sector into another, as seen by `Detect_Between_Objects`.
+ */
+struct SectorPortal {
+    int sector = 0; // Sector on the other side of the portal.
+    BBoxf bounds; // Bounding box of the portal face.
+};
+
+/**
+ * Sector connectivity of an indoor location.
+ */
+struct SectorGraph {
+    /** For each sector, its bounding box. */
+    std::vector<BBoxf> sectorBounds;
+
+    /** For each sector, portals from the sector's portal list. */
+    std::vector<std::vector<SectorPortal>> portals;
+};
+
+/**
+ * Precomputed per-sector detection sets for indoor locations, stored as a bitset per sector.
+ *
+ * `Detect_Between_Objects` casts a ray of at most `MAX_DETECTION_DISTANCE` units and walks at most
+ * `MAX_DETECTION_HOPS` portals along it. Every portal that the ray crosses intersects the ray's bounding box, and thus
+ * lies within `MAX_DETECTION_DISTANCE` of the ray origin. So the set of sectors that can be reached from a given sector
+ * is bounded by a search that only steps through portals that are close enough to the source sector's bounding box.
+ * In big dungeons this rejects most sector pairs before any ray casting is done.
+ *
+ * The result is conservative, so a `true` result doesn't mean that the object is actually visible. Queries for sector
+ * ids that are out of range also return `true`, leaving the decision to the caller.
+ */
+class SectorDetection {
+ public:
+    static constexpr int MAX_DETECTION_HOPS = 30;
+    static constexpr float MAX_DETECTION_DISTANCE = 5120.0f;
+
+    /** Slack for objects that stick out of their sector's bounding box, e.g. tall actors in low sectors. */
+    static constexpr float DETECTION_SLACK = 512.0f;
+
+    void clear();
+
+    /**
+     * Computes detection sets for the provided graph.
+     *
+     * @param graph                     Sector graph, both vectors must have the same size.
+     */
+    void build(const SectorGraph &graph);
+
+    [[nodiscard]] int sectorCount() const {
+        return _sectorCount;
+    }
+
+    [[nodiscard]] bool isDetectable(int fromSector, int toSector) const {
+        if (fromSector < 0 || fromSector >= _sectorCount || toSector < 0 || toSector >= _sectorCount)
+            return true;
+        size_t index = fromSector * _wordsPerSector + toSector / 64;
+        return (_detectable[index] >> (toSector % 64)) & 1;
+    }
+
+ private:
+    int _sectorCount = 0;
+    size_t _wordsPerSector = 0;
+    std::vector<uint64_t> _detectable;
+};
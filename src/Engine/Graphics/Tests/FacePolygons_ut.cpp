@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/FacePolygons.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static const FaceAttributes allPlanes[] = {
+    FACE_XY_PLANE, FACE_XZ_PLANE, FACE_YZ_PLANE, FACE_XY_PLANE | FACE_YZ_PLANE, FACE_XZ_PLANE | FACE_YZ_PLANE, 0
+};
+
+// Same as what BLVFace::Contains does for faces that are not pre-flattened.
+static bool referenceContains(std::span<const Vec3f> vertices, std::span<const int16_t> vertexIds, FaceAttributes plane,
+                              const Vec3f &pos, int slack) {
+    if (vertexIds.size() < 3)
+        return false;
+
+    std::vector<float> u, v;
+    for (int16_t id : vertexIds) {
+        const Vec3f &vertex = vertices[id];
+        if (plane & FACE_XY_PLANE) {
+            u.push_back(vertex.x);
+            v.push_back(vertex.y);
+        } else if (plane & FACE_XZ_PLANE) {
+            u.push_back(vertex.x);
+            v.push_back(vertex.z);
+        } else {
+            u.push_back(vertex.y);
+            v.push_back(vertex.z);
+        }
+    }
+
+    if (plane & FACE_XY_PLANE) {
+        return flatPolygonContains(u, v, pos.x, pos.y, slack);
+    } else if (plane & FACE_YZ_PLANE) {
+        return flatPolygonContains(u, v, pos.y, pos.z, slack);
+    } else {
+        return flatPolygonContains(u, v, pos.x, pos.z, slack);
+    }
+}
+
+UNIT_TEST(FacePolygons, Square) {
+    std::vector<Vec3f> vertices = {{0, 0, 0}, {100, 0, 0}, {100, 100, 0}, {0, 100, 0}};
+    std::vector<int16_t> ids = {0, 1, 2, 3};
+
+    FacePolygons polygons;
+    polygons.addFace(vertices, ids);
+    ASSERT_TRUE(polygons.hasFace(0));
+    EXPECT_FALSE(polygons.hasFace(1));
+    EXPECT_FALSE(polygons.hasFace(-1));
+
+    EXPECT_TRUE(polygons.contains(0, FACE_XY_PLANE, Vec3f(50, 50, 0), 0));
+    EXPECT_FALSE(polygons.contains(0, FACE_XY_PLANE, Vec3f(150, 50, 0), 0));
+    EXPECT_FALSE(polygons.contains(0, FACE_XY_PLANE, Vec3f(102, 50, 0), 0));
+    EXPECT_TRUE(polygons.contains(0, FACE_XY_PLANE, Vec3f(102, 50, 0), 3)); // Within slack.
+    EXPECT_FALSE(polygons.contains(0, FACE_XZ_PLANE, Vec3f(50, 50, 0), 0)); // Degenerate in XZ.
+}
+
+UNIT_TEST(FacePolygons, DynamicAndDegenerate) {
+    std::vector<Vec3f> vertices = {{0, 0, 0}, {100, 0, 0}, {100, 100, 0}};
+    std::vector<int16_t> line = {0, 1};
+    std::vector<int16_t> triangle = {0, 1, 2};
+
+    FacePolygons polygons;
+    polygons.addFace(vertices, line);
+    polygons.addDynamicFace();
+    polygons.addFace(vertices, triangle);
+    EXPECT_EQ(polygons.size(), 3);
+    EXPECT_TRUE(polygons.hasFace(0));
+    EXPECT_FALSE(polygons.hasFace(1));
+    EXPECT_TRUE(polygons.hasFace(2));
+
+    EXPECT_FALSE(polygons.contains(0, FACE_XY_PLANE, Vec3f(50, 0, 0), 10));
+    EXPECT_TRUE(polygons.contains(2, FACE_XY_PLANE, Vec3f(90, 10, 0), 0));
+
+    polygons.clear();
+    EXPECT_EQ(polygons.size(), 0);
+    EXPECT_FALSE(polygons.hasFace(0));
+}
+
+// Checks that pre-flattened polygons give exactly the same results as the reference implementation, including
+// all the edge cases - points on edges & vertices, degenerate polygons, etc.
+UNIT_TEST(FacePolygons, MatchesReference) {
+    MersenneTwisterRandomEngine rng;
+
+    std::vector<Vec3f> vertices;
+    std::vector<std::vector<int16_t>> faces;
+    for (int i = 0; i < 500; i++) {
+        // Level vertices are integral, so we generate integral vertices too.
+        Vec3f center(rng.randomInSegment(-20000, 20000), rng.randomInSegment(-20000, 20000), rng.randomInSegment(-2000, 2000));
+        Vec3f a(rng.randomFloat() - 0.5f, rng.randomFloat() - 0.5f, rng.randomFloat() - 0.5f);
+        Vec3f b(rng.randomFloat() - 0.5f, rng.randomFloat() - 0.5f, rng.randomFloat() - 0.5f);
+        if (i % 5 == 0)
+            a.z = b.z = 0; // Axis-aligned.
+        float radius = rng.randomInSegment(1, 2000);
+
+        int size = rng.randomInSegment(0, 20);
+        std::vector<float> angles;
+        for (int j = 0; j < size; j++)
+            angles.push_back(rng.randomFloat() * 2 * std::numbers::pi_v<float>);
+        std::ranges::sort(angles);
+
+        std::vector<int16_t> &face = faces.emplace_back();
+        for (float angle : angles) {
+            Vec3f vertex = center + radius * 2 * (std::cos(angle) * a + std::sin(angle) * b);
+            face.push_back(vertices.size());
+            vertices.push_back(Vec3f(std::round(vertex.x), std::round(vertex.y), std::round(vertex.z)));
+            if (i % 7 == 0 && !face.empty())
+                face.push_back(face.back()); // Duplicate vertices.
+        }
+    }
+
+    FacePolygons polygons;
+    for (const std::vector<int16_t> &face : faces)
+        polygons.addFace(vertices, face);
+
+    for (size_t i = 0; i < faces.size(); i++) {
+        const std::vector<int16_t> &face = faces[i];
+
+        std::vector<Vec3f> points;
+        Vec3f centroid(0, 0, 0);
+        for (size_t j = 0; j < face.size(); j++) {
+            const Vec3f &vertex = vertices[face[j]];
+            const Vec3f &next = vertices[face[(j + 1) % face.size()]];
+            points.push_back(vertex);
+            points.push_back((vertex + next) / 2);
+            points.push_back(vertex + Vec3f(1, 1, 1));
+            centroid += vertex;
+        }
+        if (!face.empty())
+            centroid /= static_cast<float>(face.size());
+        points.push_back(centroid);
+        for (int j = 0; j < 20; j++)
+            points.push_back(centroid + Vec3f(rng.randomInSegment(-2000, 2000), rng.randomInSegment(-2000, 2000), rng.randomInSegment(-2000, 2000)));
+
+        for (FaceAttributes plane : allPlanes)
+            for (int slack : {0, 1, 3, 10})
+                for (const Vec3f &point : points)
+                    EXPECT_EQ(polygons.contains(i, plane, point, slack), referenceContains(vertices, face, plane, point, slack));
+    }
+}
@@ -0,0 +1,39 @@
+#include <chrono>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/FrameLimiter.h"
+
+UNIT_TEST(FrameLimiter, Pacing) {
+    FrameLimiter limiter;
+    EXPECT_EQ(limiter.stats().frames, 0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; i++)
+        limiter.tick(200);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Upper bounds would make this test flaky on a loaded machine, so we only check the lower one.
+    EXPECT_GE(elapsed, std::chrono::milliseconds(50));
+
+    const FrameLimiterStats &stats = limiter.stats();
+    EXPECT_LE(stats.frames, 10);
+    EXPECT_GE(stats.maxJitterNs, 0);
+    EXPECT_GE(stats.maxJitterNs, stats.meanJitterNs());
+    EXPECT_GE(stats.sleepOvershootNs, 0);
+    EXPECT_GT(stats.sleptNs + stats.spunNs, 0);
+}
+
+UNIT_TEST(FrameLimiter, Reset) {
+    FrameLimiter limiter;
+    limiter.tick(1000);
+    limiter.tick(1000);
+    int64_t sleepOvershootNs = limiter.stats().sleepOvershootNs;
+
+    limiter.reset();
+    EXPECT_EQ(limiter.stats().frames, 0);
+    EXPECT_EQ(limiter.stats().totalJitterNs, 0);
+    EXPECT_EQ(limiter.stats().sleptNs, 0);
+    EXPECT_EQ(limiter.stats().spunNs, 0);
+    EXPECT_EQ(limiter.stats().sleepOvershootNs, sleepOvershootNs);
+}
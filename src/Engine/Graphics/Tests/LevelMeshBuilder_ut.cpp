@@ -0,0 +1,132 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/LevelMeshBuilder.h"
+
+static Sizei textureSize(std::string_view name) {
+    // Name encodes texture size: "a64" is 64x64.
+    int size = std::stoi(std::string(name.substr(1)));
+    return Sizei(size, size);
+}
+
+UNIT_TEST(LevelMeshBuilder, GroupBySize) {
+    LevelMeshBuilder builder(&textureSize);
+
+    std::vector<std::string> a = {"a64"};
+    std::vector<std::string> b = {"b128"};
+    std::vector<std::string> c = {"c64"};
+    EXPECT_EQ(builder.addFace(a, 4).unit, 0);
+    EXPECT_EQ(builder.addFace(b, 3).unit, 1);
+
+    LevelTextureSlot slot = builder.addFace(c, 5);
+    EXPECT_EQ(slot.unit, 0);
+    EXPECT_EQ(slot.layer, 1);
+
+    slot = builder.addFace(a, 3); // Already added.
+    EXPECT_EQ(slot.unit, 0);
+    EXPECT_EQ(slot.layer, 0);
+
+    LevelMesh mesh = builder.finish();
+    EXPECT_EQ(mesh.textures[0].size, Sizei(64, 64));
+    EXPECT_EQ(mesh.textures[0].layers, std::vector<std::string>({"a64", "c64"}));
+    EXPECT_EQ(mesh.textures[1].size, Sizei(128, 128));
+    EXPECT_EQ(mesh.textures[1].layers, std::vector<std::string>({"b128"}));
+    EXPECT_TRUE(mesh.textures[2].layers.empty());
+    EXPECT_EQ(mesh.numDroppedTextures, 0);
+
+    EXPECT_GE(mesh.vertices[0].capacity(), 6 + 9 + 3);
+    EXPECT_GE(mesh.vertices[1].capacity(), 3);
+    EXPECT_TRUE(mesh.vertices[0].empty());
+}
+
+UNIT_TEST(LevelMeshBuilder, ReservedTextures) {
+    LevelMeshBuilder builder(&textureSize);
+
+    std::vector<std::string> water = {"w128", "x128"};
+    builder.reserveTextures(Sizei(128, 128), water);
+
+    std::vector<std::string> a = {"a64"};
+    std::vector<std::string> b = {"b128"};
+    std::vector<std::string> tile = {"wtrtyl"};
+    EXPECT_EQ(builder.addFace(a, 3).unit, 1);
+
+    LevelTextureSlot slot = builder.addFace(b, 3);
+    EXPECT_EQ(slot.unit, 0);
+    EXPECT_EQ(slot.layer, 2);
+
+    slot = builder.addFace(tile, 3); // Water tile is drawn from the reserved textures.
+    EXPECT_EQ(slot.unit, 0);
+    EXPECT_EQ(slot.layer, 0);
+
+    LevelMesh mesh = builder.finish();
+    ASSERT_NE(mesh.textureSlot("x128"), nullptr);
+    EXPECT_EQ(mesh.textureSlot("x128")->unit, 0);
+    EXPECT_EQ(mesh.textureSlot("x128")->layer, 1);
+    EXPECT_EQ(mesh.textureSlot("wtrtyl"), nullptr);
+}
+
+UNIT_TEST(LevelMeshBuilder, AnimatedFaces) {
+    LevelMeshBuilder builder(&textureSize);
+
+    std::vector<std::string> frames = {"a64", "b128", "c64"};
+    LevelTextureSlot slot = builder.addFace(frames, 4);
+    EXPECT_EQ(slot.unit, 0);
+    EXPECT_EQ(slot.layer, 0);
+
+    LevelMesh mesh = builder.finish();
+    EXPECT_EQ(mesh.textures[0].layers.size(), 2);
+    EXPECT_EQ(mesh.textures[1].layers.size(), 1);
+
+    // Space is reserved once per texture array, even if several frames share it.
+    EXPECT_EQ(mesh.vertices[0].capacity(), 6);
+    EXPECT_EQ(mesh.vertices[1].capacity(), 6);
+}
+
+UNIT_TEST(LevelMeshBuilder, Overflow) {
+    LevelMeshBuilder builder(&textureSize);
+
+    for (int i = 0; i < LEVEL_MESH_TEXTURE_UNITS; i++) {
+        std::vector<std::string> frames = {"a" + std::to_string(i + 1)};
+        EXPECT_EQ(builder.addFace(frames, 3).unit, i);
+    }
+
+    std::vector<std::string> extra = {"a1000"};
+    LevelTextureSlot slot = builder.addFace(extra, 3);
+    EXPECT_EQ(slot.unit, 0);
+    EXPECT_EQ(slot.layer, 0);
+
+    LevelMesh mesh = builder.finish();
+    EXPECT_EQ(mesh.numDroppedTextures, 1);
+    EXPECT_EQ(mesh.textureSlot("a1000"), nullptr);
+}
+
+UNIT_TEST(LevelMeshBuilder, LayerOverflow) {
+    LevelMeshBuilder builder(&textureSize);
+
+    for (int i = 0; i < LEVEL_MESH_TEXTURE_LAYERS + 2; i++) {
+        // All textures are 64x64, names differ only in the leading zeros.
+        std::vector<std::string> frames = {"a" + std::string(i, '0') + "64"};
+        builder.addFace(frames, 3);
+    }
+
+    LevelMesh mesh = builder.finish();
+    EXPECT_EQ(mesh.textures[0].layers.size(), LEVEL_MESH_TEXTURE_LAYERS);
+    EXPECT_EQ(mesh.numDroppedTextures, 2);
+}
+
+UNIT_TEST(LevelMeshBuilder, FinishResets) {
+    LevelMeshBuilder builder(&textureSize);
+
+    std::vector<std::string> a = {"a64"};
+    builder.addFace(a, 3);
+    LevelMesh mesh0 = builder.finish();
+    EXPECT_EQ(mesh0.textures[0].layers.size(), 1);
+
+    LevelMesh mesh1 = builder.finish();
+    EXPECT_TRUE(mesh1.textures[0].layers.empty());
+    EXPECT_TRUE(mesh1.slotByName.empty());
+    EXPECT_EQ(mesh1.vertices[0].capacity(), 0);
+}
@@ -0,0 +1,98 @@
+#include <cmath>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/LightGrid.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+struct TestLight {
+    Vec3f pos;
+    float radius = 0;
+};
+
+static std::vector<int> candidates(const LightGrid &grid, float x, float y) {
+    std::vector<int> result;
+    grid.forEachCandidate(x, y, [&](int index) { result.push_back(index); });
+    return result;
+}
+
+static bool isCandidate(const LightGrid &grid, float x, float y, int index) {
+    bool result = false;
+    grid.forEachCandidate(x, y, [&](int candidate) { result |= candidate == index; });
+    return result;
+}
+
+UNIT_TEST(LightGrid, Empty) {
+    LightGrid grid;
+    EXPECT_TRUE(candidates(grid, 0, 0).empty());
+    grid.clear();
+    EXPECT_TRUE(candidates(grid, 0, 0).empty());
+}
+
+UNIT_TEST(LightGrid, Basic) {
+    LightGrid grid;
+    grid.add(0, Vec3f(0, 0, 0), 100);
+    grid.add(1, Vec3f(10000, 10000, 0), 100);
+    grid.add(2, Vec3f(0, 0, 0), 30000); // Too big to bin.
+
+    EXPECT_TRUE(isCandidate(grid, 50, 50, 0));
+    EXPECT_TRUE(isCandidate(grid, 50, 50, 2));
+    EXPECT_FALSE(isCandidate(grid, 50, 50, 1));
+    EXPECT_TRUE(isCandidate(grid, 10000, 9950, 1));
+    EXPECT_TRUE(isCandidate(grid, -20000, 20000, 2));
+
+    grid.clear();
+    EXPECT_TRUE(candidates(grid, 50, 50).empty());
+    EXPECT_TRUE(candidates(grid, 10000, 9950).empty());
+}
+
+UNIT_TEST(LightGrid, OutOfBounds) {
+    LightGrid grid;
+    grid.add(0, Vec3f(40000, -40000, 0), 200);
+
+    EXPECT_TRUE(isCandidate(grid, 40100, -40100, 0));
+    EXPECT_TRUE(isCandidate(grid, 1e20f, -1e20f, 0)); // Clamped to the same corner cell.
+}
+
+// 100 lights & 500 billboards, the case GetLightLevelAtPoint is optimized for. Checks that the grid never drops
+// a light that the brute-force check would have applied.
+UNIT_TEST(LightGrid, MatchesBruteForce) {
+    MersenneTwisterRandomEngine rng;
+
+    for (int round = 0; round < 3; round++) {
+        std::vector<TestLight> lights;
+        LightGrid grid;
+        for (int i = 0; i < 100; i++) {
+            TestLight &light = lights.emplace_back();
+            light.pos = Vec3f(rng.randomInSegment(-20000, 20000), rng.randomInSegment(-20000, 20000), 0);
+            light.radius = rng.randomInSegment(0, round == 2 ? 4000 : 1000);
+            grid.add(i, light.pos, light.radius);
+        }
+
+        for (int j = 0; j < 500; j++) {
+            // Put every other point close to some light so that we actually hit something.
+            Vec3f point(rng.randomInSegment(-20000, 20000), rng.randomInSegment(-20000, 20000), 0);
+            if (j % 2) {
+                const TestLight &light = lights[rng.random(lights.size())];
+                point = light.pos + Vec3f(rng.randomInSegment(-1000, 1000), rng.randomInSegment(-1000, 1000), 0);
+            }
+
+            std::vector<int> found = candidates(grid, point.x, point.y);
+            std::vector<bool> seen(lights.size());
+            for (int index : found) {
+                EXPECT_FALSE(seen[index]);
+                seen[index] = true;
+            }
+
+            for (size_t i = 0; i < lights.size(); i++) {
+                const TestLight &light = lights[i];
+                bool inRange = std::abs(light.pos.x - point.x) <= light.radius && std::abs(light.pos.y - point.y) <= light.radius;
+                EXPECT_TRUE(seen[i] || !inRange);
+            }
+        }
+
+        grid.clear();
+    }
+}
@@ -0,0 +1,133 @@
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/ParticlePool.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static void addParticle(ParticlePool *pool, ParticleFlags type, Vec3f pos, Vec3f velocity, Duration timeToLive,
+                        RandomEngine *rng) {
+    pool->add(type, pos, velocity, Color(200, 100, 50), timeToLive, nullptr, 0, 1.0f, rng);
+}
+
+UNIT_TEST(ParticlePool, ExpireKeepsOrder) {
+    MersenneTwisterRandomEngine rng;
+    ParticlePool pool;
+    for (int i = 0; i < 10; i++)
+        addParticle(&pool, ParticleType_Diffuse, Vec3f(i, 0, 0), Vec3f(), Duration::fromTicks(i % 2 ? 100 : 10), &rng);
+    EXPECT_EQ(pool.size(), 10);
+
+    pool.update(10_ticks, &rng);
+    ASSERT_EQ(pool.size(), 5);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(pool.position(i).x, 2 * i + 1);
+        EXPECT_EQ(pool.timeToLive(i), 90_ticks);
+    }
+
+    EXPECT_EQ(pool.stats().spawned, 10);
+    EXPECT_EQ(pool.stats().expired, 5);
+    EXPECT_EQ(pool.stats().peakAlive, 10);
+    EXPECT_EQ(pool.stats().lastFrameSpawned, 10);
+
+    pool.update(100_ticks, &rng);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.stats().expired, 10);
+    EXPECT_EQ(pool.stats().lastFrameSpawned, 0);
+    EXPECT_EQ(pool.stats().peakFrameSpawned, 10);
+}
+
+UNIT_TEST(ParticlePool, Grows) {
+    MersenneTwisterRandomEngine rng;
+    ParticlePool pool;
+    size_t count = ParticlePool::INITIAL_CAPACITY * 4;
+    for (size_t i = 0; i < count; i++)
+        addParticle(&pool, ParticleType_Bitmap, Vec3f(), Vec3f(), 1000_ticks, &rng);
+    EXPECT_EQ(pool.size(), count);
+    EXPECT_EQ(pool.stats().peakAlive, count);
+
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.stats().spawned, 0);
+}
+
+UNIT_TEST(ParticlePool, Integration) {
+    MersenneTwisterRandomEngine rng;
+    ParticlePool pool;
+
+    // Odd count so that both the vectorized part & the tail get tested.
+    for (int i = 0; i < 7; i++) {
+        ParticleFlags type = i % 3 == 0 ? ParticleType_Dropping | ParticleType_Bitmap : ParticleType_Bitmap;
+        addParticle(&pool, type, Vec3f(i, 2 * i, 3 * i), Vec3f(128, -256, 64), 1000_ticks, &rng);
+    }
+
+    pool.update(2_ticks, &rng);
+    for (int i = 0; i < 7; i++) {
+        bool dropping = i % 3 == 0;
+        float vz = dropping ? 64 - 2 * 5 : 64;
+        EXPECT_EQ(pool.velocity(i), Vec3f(128, -256, vz)) << i;
+        EXPECT_EQ(pool.position(i), Vec3f(i + 2, 2 * i - 4, 3 * i + vz / 64)) << i;
+        EXPECT_EQ(pool.timeToLive(i), 998_ticks) << i;
+    }
+}
+
+UNIT_TEST(ParticlePool, Dissipation) {
+    MersenneTwisterRandomEngine rng;
+    ParticlePool pool;
+    addParticle(&pool, ParticleType_Bitmap, Vec3f(), Vec3f(), 1000_ticks, &rng);
+    addParticle(&pool, ParticleType_Bitmap, Vec3f(), Vec3f(), 52_ticks, &rng);
+
+    pool.update(1_ticks, &rng);
+    EXPECT_EQ(pool.lightColor(0), Color(200, 100, 50));
+    EXPECT_EQ(pool.lightColor(1), Color(80, 40, 20)); // 2 * 51 / 255 = 0.4.
+}
+
+UNIT_TEST(ParticlePool, Deterministic) {
+    MersenneTwisterRandomEngine rng0, rng1;
+    ParticlePool pool0, pool1;
+
+    for (ParticlePool *pool : {&pool0, &pool1}) {
+        RandomEngine *rng = pool == &pool0 ? &rng0 : &rng1;
+        for (int i = 0; i < 100; i++) {
+            ParticleFlags type = ParticleType_Sprite | ParticleType_Ascending;
+            if (i % 2)
+                type |= ParticleType_Rotating;
+            addParticle(pool, type, Vec3f(), Vec3f(1, 2, 3), Duration::fromTicks(10 + i), rng);
+        }
+        for (int i = 0; i < 20; i++)
+            pool->update(3_ticks, rng);
+    }
+
+    ASSERT_EQ(pool0.size(), pool1.size());
+    ASSERT_FALSE(pool0.empty());
+    for (size_t i = 0; i < pool0.size(); i++) {
+        EXPECT_EQ(pool0.position(i), pool1.position(i));
+        EXPECT_EQ(pool0.angle(i), pool1.angle(i));
+    }
+}
+
+UNIT_BENCHMARK(ParticlePool, Benchmark) {
+    constexpr int particleCount = 20000;
+    constexpr int updateCount = 500;
+
+    MersenneTwisterRandomEngine rng;
+    ParticlePool pool;
+
+    // Meteor shower-like load, all particles are kept alive for the whole run.
+    for (int i = 0; i < particleCount; i++) {
+        ParticleFlags type = ParticleType_Bitmap;
+        if (i % 2)
+            type |= ParticleType_Dropping;
+        if (i % 4 == 0)
+            type |= ParticleType_Rotating;
+        addParticle(&pool, type, Vec3f(rng.random(1000), rng.random(1000), rng.random(1000)),
+                    Vec3f(rng.random(100), rng.random(100), rng.random(100)),
+                    Duration::fromTicks(updateCount * 2 + rng.random(1000)), &rng);
+    }
+
+    double ns = benchmarkNsPerItem(particleCount, updateCount, [&] {
+        pool.update(1_ticks, &rng);
+    });
+
+    EXPECT_EQ(pool.size(), particleCount);
+    reportBenchmark("ParticlePool::update", ns, "particle");
+}
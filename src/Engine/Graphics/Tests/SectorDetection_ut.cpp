@@ -0,0 +1,76 @@
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/SectorDetection.h"
+
+// Sector 0 is the dummy sector, sectors 1..size-1 form a corridor along the x axis, each sector being `length` units
+// long, and the last sector is disconnected.
+static SectorGraph corridorGraph(int size, float length) {
+    SectorGraph result;
+    result.sectorBounds.resize(size + 1);
+    result.portals.resize(size + 1);
+    for (int i = 1; i <= size; i++)
+        result.sectorBounds[i] = BBoxf{.x1 = i * length, .x2 = (i + 1) * length, .y1 = 0, .y2 = 512, .z1 = 0, .z2 = 512};
+    for (int i = 1; i + 1 < size; i++) {
+        BBoxf portal{.x1 = (i + 1) * length, .x2 = (i + 1) * length, .y1 = 0, .y2 = 512, .z1 = 0, .z2 = 512};
+        result.portals[i].push_back({i + 1, portal});
+        result.portals[i + 1].push_back({i, portal});
+    }
+    return result;
+}
+
+UNIT_TEST(SectorDetection, HopLimit) {
+    SectorDetection detection;
+    detection.build(corridorGraph(50, 1.0f));
+    EXPECT_EQ(detection.sectorCount(), 51);
+
+    EXPECT_TRUE(detection.isDetectable(1, 1));
+    EXPECT_TRUE(detection.isDetectable(1, 1 + SectorDetection::MAX_DETECTION_HOPS));
+    EXPECT_FALSE(detection.isDetectable(1, 2 + SectorDetection::MAX_DETECTION_HOPS));
+    EXPECT_TRUE(detection.isDetectable(40, 40 - SectorDetection::MAX_DETECTION_HOPS));
+    EXPECT_FALSE(detection.isDetectable(40, 39 - SectorDetection::MAX_DETECTION_HOPS));
+
+    // Disconnected sectors are rejected.
+    EXPECT_FALSE(detection.isDetectable(1, 0));
+    EXPECT_FALSE(detection.isDetectable(1, 50));
+    EXPECT_FALSE(detection.isDetectable(50, 1));
+
+    // Out of range queries are not rejected.
+    EXPECT_TRUE(detection.isDetectable(-1, 1));
+    EXPECT_TRUE(detection.isDetectable(1, 51));
+
+    detection.clear();
+    EXPECT_EQ(detection.sectorCount(), 0);
+    EXPECT_TRUE(detection.isDetectable(1, 50));
+}
+
+UNIT_TEST(SectorDetection, DistanceLimit) {
+    // 1024-unit sectors, portal i->i+1 is (i - from) * 1024 units away from sector `from`.
+    SectorDetection detection;
+    detection.build(corridorGraph(20, 1024.0f));
+
+    constexpr int reach = (SectorDetection::MAX_DETECTION_DISTANCE + SectorDetection::DETECTION_SLACK) / 1024;
+    static_assert(reach == 5);
+    EXPECT_TRUE(detection.isDetectable(1, 2 + reach));
+    EXPECT_FALSE(detection.isDetectable(1, 3 + reach));
+    EXPECT_TRUE(detection.isDetectable(10, 10 - reach - 1));
+    EXPECT_FALSE(detection.isDetectable(10, 10 - reach - 2));
+
+    // Most of the pairs in a long corridor are rejected, even though all of them are within the hop limit.
+    detection.build(corridorGraph(30, 1024.0f));
+    int rejected = 0;
+    for (int i = 1; i < 30; i++)
+        for (int j = 1; j < 30; j++)
+            rejected += !detection.isDetectable(i, j);
+    EXPECT_GT(rejected, 29 * 29 / 2);
+}
+
+UNIT_TEST(SectorDetection, DirectedEdges) {
+    SectorGraph graph;
+    graph.sectorBounds.resize(3);
+    graph.portals = {{}, {}, {{1, BBoxf()}}};
+
+    SectorDetection detection;
+    detection.build(graph);
+    EXPECT_FALSE(detection.isDetectable(1, 2));
+    EXPECT_TRUE(detection.isDetectable(2, 1));
+}
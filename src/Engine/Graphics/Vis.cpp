@@ -2,6 +2,8 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <array>
+#include <limits>
 #include <vector>
 #include <utility>
 
@@ -26,6 +28,14 @@
 
 static Vis_SelectionList Vis_static_sub_4C1944_stru_F8BDE8;
 
+static constexpr int PICKING_TILE_SIZE = 32;
+
+// Projected faces are inflated by this many pixels to account for rounding errors in projection.
+static constexpr float PICKING_FACE_MARGIN = 2.0f;
+
+// Faces with vertices closer to the camera plane than this can't be reliably projected.
+static constexpr float PICKING_NEAR_DISTANCE = 1.0f;
+
 Vis_SelectionFilter vis_sprite_targets_filter = {
     VisObjectType_Sprite, OBJECT_Decoration, 0, 0, ExcludeType};  // 00F93E1C
 Vis_SelectionFilter vis_allsprites_filter = {
@@ -47,7 +57,7 @@ Vis_ObjectInfo *Vis::DetermineFacetIntersection(BLVFace *face, Pid pid, float pi
                                //  int v20; // [sp+84h] [bp-Ch]@10
 
     static Vis_SelectionList SelectedPointersList;  // stru_F8FE00
-    SelectedPointersList.uSize = 0;
+    SelectedPointersList.clear();
 
     static bool _init_flag = false;
     static RenderVertexSoft static_DetermineFacetIntersection_array_F8F200[64];
@@ -112,15 +122,12 @@ Vis_ObjectInfo *Vis::DetermineFacetIntersection(BLVFace *face, Pid pid, float pi
 
     SelectedPointersList.create_object_pointers();
     SelectedPointersList.sort_object_pointers();
-    if (!SelectedPointersList.uSize) return nullptr;
+    if (!SelectedPointersList.size()) return nullptr;
 
     if (!SelectedPointersList.SelectionPointers(VisObjectType_Face, pid))
         return nullptr;
 
-    if (SelectedPointersList.uSize)
-        return SelectedPointersList.object_pointers[0];
-    else
-        return nullptr;
+    return SelectedPointersList.object_pointers[0];
 }
 // F91E08: using guessed type char
 // static_DetermineFacetIntersection_byte_F91E08__init_flags;
@@ -129,10 +136,10 @@ Vis_ObjectInfo *Vis::DetermineFacetIntersection(BLVFace *face, Pid pid, float pi
 bool Vis::IsPolygonOccludedByBillboard(RenderVertexSoft *vertices,
                                        int num_vertices, float x, float y) {
     int v13 = -1;
-    // v5 = 0;
 
-    // v6 = render->pBillboardRenderListD3D;
-    for (unsigned i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    updatePickingTiles();
+    _billboardTiles.findContaining(x, y, &_billboardCandidates);
+    for (int i : _billboardCandidates) {
         RenderBillboardD3D *billboard = &render->pBillboardRenderListD3D[i];
         if (IsPointInsideD3DBillboard(billboard, x, y)) {
             if (v13 == -1)
@@ -226,7 +233,9 @@ void Vis::GetPolygonScreenSpaceCenter(RenderVertexSoft *vertices,
 void Vis::PickBillboards_Mouse(float fPickDepth, float fX, float fY,
                                Vis_SelectionList *list,
                                Vis_SelectionFilter *filter) {
-    for (int i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    updatePickingTiles();
+    _billboardTiles.findContaining(fX, fY, &_billboardCandidates);
+    for (int i : _billboardCandidates) {
         RenderBillboardD3D *d3d_billboard = &render->pBillboardRenderListD3D[i];
         if (isBillboardPartOfSelection(i, filter) && IsPointInsideD3DBillboard(d3d_billboard, fX, fY)) {
             if (DoesRayIntersectBillboard(fPickDepth, i)) {
@@ -283,25 +292,36 @@ bool Vis::IsPointInsideD3DBillboard(RenderBillboardD3D *billboard, float x, floa
 void Vis::PickIndoorFaces_Mouse(float fDepth, const Vec3f &rayOrigin, const Vec3f &rayStep,
                                 Vis_SelectionList *list,
                                 Vis_SelectionFilter *filter) {
+    Vec2f point;
+    if (usePickingTiles() && projectPickRay(rayOrigin, rayStep, &point)) {
+        _faceTiles.findContaining(point.x, point.y, &_faceCandidates);
+        for (int faceindex : _faceCandidates)
+            PickIndoorFace_Mouse(faceindex, rayOrigin, rayStep, list, filter);
+    } else {
+        for (int faceindex = 0; faceindex < (int)pIndoor->pFaces.size(); ++faceindex)
+            PickIndoorFace_Mouse(faceindex, rayOrigin, rayStep, list, filter);
+    }
+}
+
+void Vis::PickIndoorFace_Mouse(int faceIndex, const Vec3f &rayOrigin, const Vec3f &rayStep,
+                               Vis_SelectionList *list, Vis_SelectionFilter *filter) {
     RenderVertexSoft a1;
 
-    for (int faceindex = 0; faceindex < (int)pIndoor->pFaces.size(); ++faceindex) {
-        BLVFace *face = &pIndoor->pFaces[faceindex];
-        if (isFacePartOfSelection(nullptr, face, filter)) {
-            if (pCamera3D->is_face_faced_to_cameraBLV(face)) {
-                if (Intersect_Ray_Face(rayOrigin, rayStep, &a1, face, 0xFFFFFFFFu)) {
-                    pCamera3D->ViewTransform(&a1, 1);
-                    list->AddObject(VisObjectType_Face, a1.vWorldViewPosition.x, Pid(OBJECT_Face, faceindex));
-                }
+    BLVFace *face = &pIndoor->pFaces[faceIndex];
+    if (isFacePartOfSelection(nullptr, face, filter)) {
+        if (pCamera3D->is_face_faced_to_cameraBLV(face)) {
+            if (Intersect_Ray_Face(rayOrigin, rayStep, &a1, face, 0xFFFFFFFFu)) {
+                pCamera3D->ViewTransform(&a1, 1);
+                list->AddObject(VisObjectType_Face, a1.vWorldViewPosition.x, Pid(OBJECT_Face, faceIndex));
             }
         }
-
-        if (face->uAttributes & FACE_IsPicked)
-            face->uAttributes |= FACE_OUTLINED;
-        else
-            face->uAttributes &= ~FACE_OUTLINED;
-        face->uAttributes &= ~FACE_IsPicked;
     }
+
+    if (face->uAttributes & FACE_IsPicked)
+        face->uAttributes |= FACE_OUTLINED;
+    else
+        face->uAttributes &= ~FACE_OUTLINED;
+    face->uAttributes &= ~FACE_IsPicked;
 }
 
 bool IsBModelVisible(BSPModel *model, int reachable_depth, bool *reachable) {
@@ -319,6 +339,17 @@ bool IsBModelVisible(BSPModel *model, int reachable_depth, bool *reachable) {
     return IsSphereInFrustum(model->vBoundingCenter, radius);
 }
 
+void FindBModelsInFrustum(std::vector<int> *result) {
+    // Same planes as in IsSphereInFrustum.
+    std::array<Planef, 4> frustum;
+    for (int i = 0; i < 4; i++) {
+        frustum[i].normal = Vec3f(pCamera3D->FrustumPlanes[i].x, pCamera3D->FrustumPlanes[i].y, pCamera3D->FrustumPlanes[i].z);
+        frustum[i].dist = -pCamera3D->FrustumPlanes[i].w;
+    }
+
+    pOutdoor->modelCullingSpheres.findInFrustum(frustum, result);
+}
+
 bool IsSphereInFrustum(Vec3f center, float radius, Planef *frustum) {
     // center must be within all four of the camera frustum planes to be visible
     Vec3f planenormal;
@@ -360,6 +391,29 @@ void Vis::PickOutdoorFaces_Mouse(float fDepth, const Vec3f &rayOrigin, const Vec
                                  bool only_reachable) {
     if (!pOutdoor) return;
 
+    Vec2f point;
+    if (usePickingTiles() && projectPickRay(rayOrigin, rayStep, &point)) {
+        // Candidates are ordered by model, and only the models that were in the frustum when the tiles were built
+        // are binned. Reachability depends on the pick depth though, so it's checked here.
+        _faceTiles.findContaining(point.x, point.y, &_faceCandidates);
+
+        int lastModelIndex = -1;
+        bool reachable = false;
+        for (int id : _faceCandidates) {
+            const Vis_OutdoorFace &outdoorFace = _outdoorFaces[id];
+            BSPModel &model = pOutdoor->pBModels[outdoorFace.modelIndex];
+            if (outdoorFace.modelIndex != lastModelIndex) {
+                lastModelIndex = outdoorFace.modelIndex;
+                IsBModelVisible(&model, fDepth, &reachable);
+            }
+            if (!reachable && only_reachable)
+                continue;
+
+            PickOutdoorFace_Mouse(&model, &model.pFaces[outdoorFace.faceIndex], rayOrigin, rayStep, list, filter);
+        }
+        return;
+    }
+
     for (BSPModel &model : pOutdoor->pBModels) {
         bool reachable;
         if (!IsBModelVisible(&model, fDepth, &reachable)) {
@@ -369,31 +423,36 @@ void Vis::PickOutdoorFaces_Mouse(float fDepth, const Vec3f &rayOrigin, const Vec
             continue;
         }
 
-        for (ODMFace &face : model.pFaces) {
-            if (isFacePartOfSelection(&face, nullptr, filter)) {
-                BLVFace blv_face;
-                blv_face.FromODM(&face);
-
-                RenderVertexSoft intersection;
-                if (Intersect_Ray_Face(rayOrigin, rayStep, &intersection,
-                                       &blv_face, model.index)) {
-                    pCamera3D->ViewTransform(&intersection, 1);
-                    // int v13 = fixpoint_from_float(/*v12,
-                    // */intersection.vWorldViewPosition.x); v13 &= 0xFFFF0000;
-                    // v13 += Pid(OBJECT_Face, j | (i << 6));
-                    Pid pid =
-                        Pid(OBJECT_Face, face.index | (model.index << 6));
-                    list->AddObject(VisObjectType_Face, intersection.vWorldViewPosition.x, pid);
-                }
+        for (ODMFace &face : model.pFaces)
+            PickOutdoorFace_Mouse(&model, &face, rayOrigin, rayStep, list, filter);
+    }
+}
 
-                if (blv_face.uAttributes & FACE_IsPicked)
-                    face.uAttributes |= FACE_OUTLINED;
-                else
-                    face.uAttributes &= ~FACE_OUTLINED;
-                blv_face.uAttributes &= ~FACE_IsPicked;
-            }
-        }
+void Vis::PickOutdoorFace_Mouse(BSPModel *model, ODMFace *face, const Vec3f &rayOrigin, const Vec3f &rayStep,
+                                Vis_SelectionList *list, Vis_SelectionFilter *filter) {
+    if (!isFacePartOfSelection(face, nullptr, filter))
+        return;
+
+    BLVFace blv_face;
+    blv_face.FromODM(face);
+
+    RenderVertexSoft intersection;
+    if (Intersect_Ray_Face(rayOrigin, rayStep, &intersection,
+                           &blv_face, model->index)) {
+        pCamera3D->ViewTransform(&intersection, 1);
+        // int v13 = fixpoint_from_float(/*v12,
+        // */intersection.vWorldViewPosition.x); v13 &= 0xFFFF0000;
+        // v13 += Pid(OBJECT_Face, j | (i << 6));
+        Pid pid =
+            Pid(OBJECT_Face, face->index | (model->index << 6));
+        list->AddObject(VisObjectType_Face, intersection.vWorldViewPosition.x, pid);
     }
+
+    if (blv_face.uAttributes & FACE_IsPicked)
+        face->uAttributes |= FACE_OUTLINED;
+    else
+        face->uAttributes &= ~FACE_OUTLINED;
+    blv_face.uAttributes &= ~FACE_IsPicked;
 }
 
 //----- (004C1944) --------------------------------------------------------
@@ -408,13 +467,13 @@ Pid Vis::PickClosestActor(ObjectType object_type, unsigned int pick_depth,
     selectionFilter.at_ai_state = at_ai_state;
     selectionFilter.no_at_ai_state = not_at_ai_state;
     selectionFilter.select_flags = select_flags;
-    Vis_static_sub_4C1944_stru_F8BDE8.uSize = 0;
+    Vis_static_sub_4C1944_stru_F8BDE8.clear();
     PickBillboards_Keyboard(pick_depth, &Vis_static_sub_4C1944_stru_F8BDE8,
                             &selectionFilter);
     Vis_static_sub_4C1944_stru_F8BDE8.create_object_pointers(Vis_SelectionList::Unique);
     Vis_static_sub_4C1944_stru_F8BDE8.sort_object_pointers();
 
-    if (!Vis_static_sub_4C1944_stru_F8BDE8.uSize) return Pid();
+    if (!Vis_static_sub_4C1944_stru_F8BDE8.size()) return Pid();
     return Vis_static_sub_4C1944_stru_F8BDE8.object_pointers[0]->object_pid;
 }
 
@@ -589,22 +648,19 @@ Vis_ObjectInfo *Vis_SelectionList::SelectionPointers(VisObjectType pVisObjectTyp
     // char *v5; // eax@2
     // Vis_ObjectInfo *result; // eax@6
 
-    // v3 = this->uSize;
-    if (this->uSize > 0) {
-        for (unsigned i = 0; i < this->uSize; ++i) {
-            if (this->object_pool[i].object_type == pVisObjectType &&
-                this->object_pool[i].object_pid == pid)
-                return &this->object_pool[i];
-        }
-    }
+    for (Vis_ObjectInfo &info : object_pool)
+        if (info.object_type == pVisObjectType && info.object_pid == pid)
+            return &info;
     return nullptr;
 }
 
 //----- (004C2591) --------------------------------------------------------
 void Vis_SelectionList::create_object_pointers(PointerCreationType type) {
+    object_pointers.resize(object_pool.size());
+
     switch (type) {
         case All: {
-            for (unsigned i = 0; i < uSize; ++i)
+            for (unsigned i = 0; i < object_pool.size(); ++i)
                 object_pointers[i] = &object_pool[i];
         } break;
 
@@ -614,7 +670,7 @@ void Vis_SelectionList::create_object_pointers(PointerCreationType type) {
         {             // but it may be decompilation error thou
             bool create = true;
 
-            for (unsigned i = 0; i < uSize; ++i) {
+            for (unsigned i = 0; i < object_pool.size(); ++i) {
                 for (unsigned j = 0; j < i; ++j) {
                     if (object_pointers[j] == &object_pool[i]) {
                         create = false;
@@ -636,7 +692,7 @@ void Vis_SelectionList::sort_object_pointers() {
     auto cmp = [](Vis_ObjectInfo *l, Vis_ObjectInfo *r) {
         return l->depth < r->depth;
     };
-    std::stable_sort(object_pointers.data(), object_pointers.data() + uSize, cmp);
+    std::stable_sort(object_pointers.begin(), object_pointers.end(), cmp);
 }
 
 //----- (004C26D0) --------------------------------------------------------
@@ -673,7 +729,7 @@ void Vis::SortByScreenSpaceY(RenderVertexSoft *pArray, int start, int end) {
 
 //----- (004C05CC) --------------------------------------------------------
 Vis_PIDAndDepth Vis::PickKeyboard(float pick_depth, Vis_SelectionFilter *sprite_filter, Vis_SelectionFilter *face_filter) {
-    _selectionList.uSize = 0;
+    _selectionList.clear();
 
     PickBillboards_Keyboard(pick_depth, &_selectionList, sprite_filter);
     if (uCurrentlyLoadedLevelType == LEVEL_INDOOR)
@@ -686,7 +742,7 @@ Vis_PIDAndDepth Vis::PickKeyboard(float pick_depth, Vis_SelectionFilter *sprite_
     _selectionList.create_object_pointers(Vis_SelectionList::Unique);
     _selectionList.sort_object_pointers();
 
-    if (!_selectionList.uSize)
+    if (!_selectionList.size())
         return Vis_PIDAndDepth();
     return get_object_zbuf_val(_selectionList.object_pointers[0]);
 }
@@ -694,7 +750,7 @@ Vis_PIDAndDepth Vis::PickKeyboard(float pick_depth, Vis_SelectionFilter *sprite_
 //----- (004C0646) --------------------------------------------------------
 Vis_PIDAndDepth Vis::PickMouse(float fDepth, float fMouseX, float fMouseY,
                                Vis_SelectionFilter *sprite_filter, Vis_SelectionFilter *face_filter) {
-    _selectionList.uSize = 0;
+    _selectionList.clear();
 
     Vec3f rayOrigin, rayStep;
     CastPickRay(fMouseX, fMouseY, fDepth, &rayOrigin, &rayStep);
@@ -720,7 +776,7 @@ Vis_PIDAndDepth Vis::PickMouse(float fDepth, float fMouseX, float fMouseY,
     _selectionList.create_object_pointers(Vis_SelectionList::All);
     _selectionList.sort_object_pointers();
 
-    if (!_selectionList.uSize)
+    if (!_selectionList.size())
         return Vis_PIDAndDepth();
     return get_object_zbuf_val(_selectionList.object_pointers[0]);
 }
@@ -872,24 +928,22 @@ bool Vis::DoesRayIntersectBillboard(float fDepth, unsigned int uD3DBillboardIdx)
 }
 
 bool Vis::DoesRayMissLevelGeom(float test_x, float test_y, float fDepth, float fTestDepth) {
-    Vec3f rayOrigin, rayStep;
     Vec3f rayOrigin2, rayStep2;
-    Vis_SelectionList Vis_static_stru_F91E10;
-    Vis_static_stru_F91E10.uSize = 0;
+    _rayList.clear();
 
     CastPickRay(test_x, test_y, fDepth, &rayOrigin2, &rayStep2);
     if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-        PickIndoorFaces_Mouse(fDepth, rayOrigin2, rayStep2, &Vis_static_stru_F91E10, &vis_face_filter);
+        PickIndoorFaces_Mouse(fDepth, rayOrigin2, rayStep2, &_rayList, &vis_face_filter);
     } else {
-        PickOutdoorFaces_Mouse(fDepth, rayOrigin2, rayStep2, &Vis_static_stru_F91E10, &vis_face_filter, false);
+        PickOutdoorFaces_Mouse(fDepth, rayOrigin2, rayStep2, &_rayList, &vis_face_filter, false);
     }
-    Vis_static_stru_F91E10.create_object_pointers();
-    Vis_static_stru_F91E10.sort_object_pointers();
+    _rayList.create_object_pointers();
+    _rayList.sort_object_pointers();
 
-    if (!Vis_static_stru_F91E10.uSize) {
+    if (!_rayList.size()) {
         return true;
     }
-    if (Vis_static_stru_F91E10.object_pointers[0]->depth > fTestDepth) {
+    if (_rayList.object_pointers[0]->depth > fTestDepth) {
         return true;
     }
 
@@ -933,3 +987,172 @@ void Vis::PickOutdoorFaces_Keyboard(float pick_depth, Vis_SelectionList *list,
         }
     }
 }
+
+void Vis::invalidatePickingTiles() {
+    _pickingTilesValid = false;
+}
+
+bool Vis::usePickingTiles() {
+    if (engine->config->debug.ShowPickedFace.value())
+        return false;
+
+    updatePickingTiles();
+    return true;
+}
+
+void Vis::updatePickingTiles() {
+    // Billboard list can also be reset outside of the render pass, e.g. when a level is unloaded, so the tiles are
+    // rebuilt if it was changed since they were last built.
+    if (_pickingTilesValid && _pickingTilesBillboardCount == render->uNumBillboardsToDraw &&
+        _pickingTilesLevelType == uCurrentlyLoadedLevelType)
+        return;
+
+    _pickingTilesValid = true;
+    _pickingTilesBillboardCount = render->uNumBillboardsToDraw;
+    _pickingTilesLevelType = uCurrentlyLoadedLevelType;
+
+    Recti area(pViewport->uScreen_TL_X, pViewport->uScreen_TL_Y,
+               pViewport->uScreen_BR_X - pViewport->uScreen_TL_X + 1,
+               pViewport->uScreen_BR_Y - pViewport->uScreen_TL_Y + 1);
+    _billboardTiles.reset(area, PICKING_TILE_SIZE);
+    _faceTiles.reset(area, PICKING_TILE_SIZE);
+    _outdoorFaces.clear();
+
+    buildBillboardTiles();
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        buildIndoorFaceTiles();
+    } else if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) {
+        buildOutdoorFaceTiles();
+    }
+}
+
+void Vis::buildBillboardTiles() {
+    for (int i = 0; i < render->uNumBillboardsToDraw; ++i) {
+        const RenderBillboardD3D &billboard = render->pBillboardRenderListD3D[i];
+        if (billboard.sParentBillboardID == -1)
+            continue; // Never picked, see IsPointInsideD3DBillboard.
+
+        // Same bounds as in IsPointInsideD3DBillboard, quads can be mirrored.
+        _billboardTiles.add(i,
+                            std::min(billboard.pQuads[0].pos.x, billboard.pQuads[3].pos.x),
+                            std::min(billboard.pQuads[0].pos.y, billboard.pQuads[1].pos.y),
+                            std::max(billboard.pQuads[0].pos.x, billboard.pQuads[3].pos.x),
+                            std::max(billboard.pQuads[0].pos.y, billboard.pQuads[1].pos.y));
+    }
+}
+
+void Vis::buildIndoorFaceTiles() {
+    if (!pIndoor)
+        return;
+
+    projectVertices(pIndoor->pVertices);
+
+    // BLV_UpdateDoors moves door faces, and it can run after the tiles were built for this frame. Binning them by
+    // their current bounds would then make picking miss the door, so they go into all tiles instead.
+    _indoorDoorFaces.assign(pIndoor->pFaces.size(), 0);
+    for (const BLVDoor &door : pIndoor->pDoors)
+        for (int i = 0; i < door.uNumFaces; ++i)
+            _indoorDoorFaces[door.pFaceIDs[i]] = 1;
+
+    for (int faceIndex = 0; faceIndex < (int)pIndoor->pFaces.size(); ++faceIndex) {
+        BLVFace &face = pIndoor->pFaces[faceIndex];
+
+        // Picked faces are only outlined when the tiles are not used, so outlines are dropped here once instead of
+        // on each pick.
+        face.uAttributes &= ~(FACE_OUTLINED | FACE_IsPicked);
+
+        if (face.isPortal() || face.Invisible())
+            continue; // Never hit, see Intersect_Ray_Face.
+
+        if (_indoorDoorFaces[faceIndex]) {
+            addFaceToAllTiles(faceIndex);
+        } else {
+            addFaceToTiles(faceIndex, face.pVertexIDs, face.uNumVertices);
+        }
+    }
+}
+
+void Vis::buildOutdoorFaceTiles() {
+    if (!pOutdoor)
+        return;
+
+    for (int modelIndex = 0; modelIndex < (int)pOutdoor->pBModels.size(); ++modelIndex) {
+        BSPModel &model = pOutdoor->pBModels[modelIndex];
+        for (ODMFace &face : model.pFaces)
+            face.uAttributes &= ~FACE_OUTLINED;
+
+        // Frustum check doesn't depend on the pick depth, reachability is checked when picking.
+        bool reachable;
+        if (!IsBModelVisible(&model, 0, &reachable))
+            continue;
+
+        projectVertices(model.pVertices);
+
+        for (int faceIndex = 0; faceIndex < (int)model.pFaces.size(); ++faceIndex) {
+            ODMFace &face = model.pFaces[faceIndex];
+            _outdoorFaces.push_back({modelIndex, faceIndex});
+            addFaceToTiles(_outdoorFaces.size() - 1, face.pVertexIDs.data(), face.uNumVertices);
+        }
+    }
+}
+
+void Vis::projectVertices(const std::vector<Vec3f> &vertices) {
+    _projectedVertices.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+        _projectedVertices[i].vWorldPosition = vertices[i];
+
+    pCamera3D->ViewTransform(_projectedVertices.data(), _projectedVertices.size());
+    pCamera3D->Project(_projectedVertices.data(), _projectedVertices.size(), false);
+}
+
+void Vis::addFaceToTiles(int id, const int16_t *vertexIds, int numVertices) {
+    if (numVertices == 0)
+        return;
+
+    float minDepth = std::numeric_limits<float>::max();
+    float maxDepth = std::numeric_limits<float>::lowest();
+    float x1 = std::numeric_limits<float>::max();
+    float y1 = std::numeric_limits<float>::max();
+    float x2 = std::numeric_limits<float>::lowest();
+    float y2 = std::numeric_limits<float>::lowest();
+    for (int i = 0; i < numVertices; ++i) {
+        const RenderVertexSoft &vertex = _projectedVertices[vertexIds[i]];
+        minDepth = std::min(minDepth, vertex.vWorldViewPosition.x);
+        maxDepth = std::max(maxDepth, vertex.vWorldViewPosition.x);
+        x1 = std::min(x1, vertex.vWorldViewProjX);
+        y1 = std::min(y1, vertex.vWorldViewProjY);
+        x2 = std::max(x2, vertex.vWorldViewProjX);
+        y2 = std::max(y2, vertex.vWorldViewProjY);
+    }
+
+    // Pick rays go into the view, so faces that are fully behind the camera can't be hit.
+    if (maxDepth < -PICKING_NEAR_DISTANCE)
+        return;
+
+    if (minDepth < PICKING_NEAR_DISTANCE) {
+        addFaceToAllTiles(id);
+        return;
+    }
+
+    _faceTiles.add(id, x1 - PICKING_FACE_MARGIN, y1 - PICKING_FACE_MARGIN, x2 + PICKING_FACE_MARGIN,
+                   y2 + PICKING_FACE_MARGIN);
+}
+
+void Vis::addFaceToAllTiles(int id) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    _faceTiles.add(id, -inf, -inf, inf, inf);
+}
+
+bool Vis::projectPickRay(const Vec3f &rayOrigin, const Vec3f &rayStep, Vec2f *point) {
+    assert(rayOrigin == pCamera3D->vCameraPos);
+
+    RenderVertexSoft end;
+    end.vWorldPosition = rayOrigin + rayStep;
+    pCamera3D->ViewTransform(&end, 1);
+    if (end.vWorldViewPosition.x < PICKING_NEAR_DISTANCE)
+        return false;
+
+    pCamera3D->Project(&end, 1, false);
+    *point = Vec2f(end.vWorldViewProjX, end.vWorldViewProjY);
+    return true;
+}
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "Engine/Graphics/RenderEntities.h"
 #include "Engine/Objects/ActorEnums.h"
 #include "Engine/Pid.h"
+#include "Engine/MapEnums.h"
 
 #include "Library/Geometry/Plane.h"
+#include "Library/Geometry/TileGrid.h"
 
 #include "Utility/Flags.h"
 
@@ -67,15 +72,28 @@ struct Vis_SelectionList {
     void sort_object_pointers();
 
     inline void AddObject(VisObjectType type, int depth, Pid pid) {
-        object_pool[uSize].object_type = type;
-        object_pool[uSize].depth = depth;
-        object_pool[uSize].object_pid = pid;
-        uSize++;
+        Vis_ObjectInfo &info = object_pool.emplace_back();
+        info.object_type = type;
+        info.depth = depth;
+        info.object_pid = pid;
+    }
+
+    void clear() {
+        object_pool.clear();
+        object_pointers.clear();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return object_pool.size();
     }
 
-    std::array<Vis_ObjectInfo, 512> object_pool;
-    std::array<Vis_ObjectInfo*, 512> object_pointers = {{}};
-    unsigned int uSize = 0;
+    std::vector<Vis_ObjectInfo> object_pool;
+    std::vector<Vis_ObjectInfo *> object_pointers; // Filled by `create_object_pointers`.
+};
+
+struct Vis_OutdoorFace {
+    int modelIndex = -1;
+    int faceIndex = -1;
 };
 
 class Vis {
@@ -89,6 +107,12 @@ class Vis {
     Pid PickClosestActor(ObjectType object_type, unsigned int pick_depth,
                          VisSelectFlags selectFlags, int not_at_ai_state, int at_ai_state);
 
+    /**
+     * Marks the screen-space picking tiles as stale. Should be called once the frame's billboard list is final, the
+     * tiles are then rebuilt on the next pick.
+     */
+    void invalidatePickingTiles();
+
  private:
     void PickBillboards_Keyboard(float pick_depth, Vis_SelectionList *list,
                                  Vis_SelectionFilter *filter);
@@ -106,6 +130,10 @@ class Vis {
                                 Vis_SelectionList *list,
                                 Vis_SelectionFilter *filter,
                                 bool only_reachable);
+    void PickIndoorFace_Mouse(int faceIndex, const Vec3f &rayOrigin, const Vec3f &rayStep,
+                              Vis_SelectionList *list, Vis_SelectionFilter *filter);
+    void PickOutdoorFace_Mouse(BSPModel *model, ODMFace *face, const Vec3f &rayOrigin, const Vec3f &rayStep,
+                               Vis_SelectionList *list, Vis_SelectionFilter *filter);
 
     bool isBillboardPartOfSelection(int billboardId, Vis_SelectionFilter *filter);
     bool isFacePartOfSelection(ODMFace *odmFace, BLVFace *bvlFace, Vis_SelectionFilter *filter);
@@ -146,8 +174,46 @@ class Vis {
     void SortByScreenSpaceY(RenderVertexSoft *pArray, int start,
                             int end);
 
+    /**
+     * @return                          Whether the picking tiles can be used. They can't when picked faces are
+     *                                  being outlined, as this requires visiting all faces on each pick.
+     */
+    bool usePickingTiles();
+    void updatePickingTiles();
+    void buildBillboardTiles();
+    void buildIndoorFaceTiles();
+    void buildOutdoorFaceTiles();
+    void projectVertices(const std::vector<Vec3f> &vertices);
+    void addFaceToTiles(int id, const int16_t *vertexIds, int numVertices);
+    void addFaceToAllTiles(int id);
+
+    /**
+     * @param rayOrigin                 Pick ray origin, must be the camera position.
+     * @param rayStep                   Pick ray step.
+     * @param[out] point                Screen point that the pick ray passes through. All points of a ray cast from
+     *                                  the camera position are projected onto the same screen point.
+     * @return                          Whether the ray points into the view, `false` means that the screen point
+     *                                  can't be used.
+     */
+    bool projectPickRay(const Vec3f &rayOrigin, const Vec3f &rayStep, Vec2f *point);
+
  private:
     Vis_SelectionList _selectionList;
+    Vis_SelectionList _rayList; // Scratch list for `DoesRayMissLevelGeom`.
+
+    // Screen-space tiles for mouse picking, rebuilt once per drawn frame. Billboards are binned by their screen
+    // rectangles, faces by the screen bounds of their projected vertices. Faces that cross the camera plane can't be
+    // projected, and are put into all tiles. So are indoor door faces, as doors can move after the tiles are built.
+    TileGrid _billboardTiles;
+    TileGrid _faceTiles;
+    std::vector<Vis_OutdoorFace> _outdoorFaces; // Outdoor face tile ids index into this array.
+    std::vector<RenderVertexSoft> _projectedVertices;
+    std::vector<uint8_t> _indoorDoorFaces; // Non-zero for indoor faces that are moved by doors, indexed by face id.
+    std::vector<int> _billboardCandidates;
+    std::vector<int> _faceCandidates;
+    bool _pickingTilesValid = false;
+    unsigned int _pickingTilesBillboardCount = 0;
+    LevelType _pickingTilesLevelType = LEVEL_NULL;
 };
 
 
@@ -160,6 +226,14 @@ class Vis {
  */
 bool IsBModelVisible(BSPModel *model, int reachable_depth, bool *reachable);
 
+/**
+ * Batch version of `IsBModelVisible` that checks all outdoor models at once.
+ *
+ * @param[out] result                   Indices of the models in `pOutdoor->pBModels` that are visible within the
+ *                                      camera frustum planes, in increasing order.
+ */
+void FindBModelsInFrustum(std::vector<int> *result);
+
 /**
  * @param center                        Vec3f of centre point of sphere.
  * @param radius                        Float of sphere radius.
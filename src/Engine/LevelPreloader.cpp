@@ -0,0 +1,143 @@
+#include "LevelPreloader.h"
+
+#include <exception>
+#include <utility>
+
+#include "Library/Binary/BlobSerialization.h"
+#include "Library/LodFormats/LodFormats.h"
+
+#include "Utility/String/Ascii.h"
+
+LevelPreloader::LevelPreloader(FileSystem *cacheFs) : _cache(cacheFs) {}
+
+LevelPreloader::~LevelPreloader() {
+    cancel();
+
+    if (!_thread.joinable())
+        return;
+
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _jobAdded.notify_one();
+    _thread.join();
+}
+
+void LevelPreloader::preload(std::string_view fileName, Blob source) {
+    cancel();
+
+    auto job = std::make_shared<Job>();
+    job->fileName = ascii::toLower(fileName);
+    job->cached = _cache.lookup(job->fileName, source);
+    job->source = std::move(source);
+    _currentJob = job;
+
+    {
+        std::lock_guard lock(_mutex);
+        _pendingJob = std::move(job);
+    }
+    _jobAdded.notify_one();
+
+    if (!_thread.joinable())
+        _thread = std::thread([this] { run(); });
+}
+
+bool LevelPreloader::isPreloading(std::string_view fileName) const {
+    return _currentJob && ascii::noCaseEquals(_currentJob->fileName, fileName);
+}
+
+bool LevelPreloader::take(std::string_view fileName, IndoorLocation_MM7 *dst) {
+    return takeInternal(fileName, dst);
+}
+
+bool LevelPreloader::take(std::string_view fileName, OutdoorLocation_MM7 *dst) {
+    return takeInternal(fileName, dst);
+}
+
+void LevelPreloader::cancel() {
+    if (!_currentJob)
+        return;
+
+    // If the worker is already running this job, it will drop it at the next step.
+    _currentJob->cancelled = true;
+    {
+        std::lock_guard lock(_mutex);
+        if (_pendingJob == _currentJob)
+            _pendingJob.reset();
+    }
+    _currentJob.reset();
+}
+
+template<class Location>
+bool LevelPreloader::takeInternal(std::string_view fileName, Location *dst) {
+    if (!isPreloading(fileName)) {
+        cancel();
+        return false;
+    }
+
+    std::shared_ptr<Job> job = std::move(_currentJob);
+    {
+        std::unique_lock lock(_mutex);
+        _jobFinished.wait(lock, [&] { return job->finished; });
+    }
+
+    if (job->decompressed)
+        _cache.store(job->fileName, job->source, job->decompressed);
+
+    Location *location = std::get_if<Location>(&job->result);
+    if (!location)
+        return false;
+
+    *dst = std::move(*location);
+    return true;
+}
+
+void LevelPreloader::run() {
+    std::unique_lock lock(_mutex);
+    while (true) {
+        _jobAdded.wait(lock, [this] { return _stopping || _pendingJob; });
+        if (_stopping)
+            return;
+
+        std::shared_ptr<Job> job = std::move(_pendingJob);
+        lock.unlock();
+
+        load(job.get());
+
+        lock.lock();
+        job->finished = true;
+        _jobFinished.notify_all();
+    }
+}
+
+void LevelPreloader::load(Job *job) {
+    // Runs on a worker thread, so no logging here, and errors are dropped. If the level is broken, the main thread
+    // will report it when loading it the usual way.
+    try {
+        Blob data = Blob::share(job->cached);
+        if (!data) {
+            // Check the size before decompressing, so that we don't spend time & memory on data that we'll drop anyway.
+            if (job->cancelled || lod::decompressedSize(job->source) > MAX_LEVEL_SIZE)
+                return;
+
+            data = lod::decodeCompressed(job->source);
+            job->decompressed = Blob::share(data);
+        }
+
+        if (job->cancelled || !data || data.size() > MAX_LEVEL_SIZE)
+            return;
+
+        if (job->fileName.ends_with(".blv")) {
+            IndoorLocation_MM7 location;
+            deserialize(data, &location);
+            job->result = std::move(location);
+        } else if (job->fileName.ends_with(".odm")) {
+            OutdoorLocation_MM7 location;
+            deserialize(data, &location);
+            job->result = std::move(location);
+        }
+    } catch (const std::exception &) {
+        job->result = {};
+    }
+}
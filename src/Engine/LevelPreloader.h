@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <variant>
+
+#include "Engine/BakedLevelCache.h"
+#include "Engine/Snapshots/CompositeSnapshots.h"
+
+#include "Utility/Memory/Blob.h"
+
+class FileSystem;
+
+/**
+ * Speculative level loader.
+ *
+ * When it's likely that the party is about to change maps (e.g. the travel or the dungeon entry dialog is open),
+ * the next map's geometry can be decompressed & parsed on a worker thread while the player is looking at the dialog.
+ * If the transition does happen, `IndoorLocation::Load` / `OutdoorLocation::Load` pick up the preloaded data instead
+ * of doing the work themselves. If it doesn't, the data is just dropped on the next preload or on the next map load.
+ *
+ * Only the pure part of the load (`lod::decodeCompressed` + `deserialize`) is done on the worker thread, everything
+ * that touches the game state, the file systems or the asset managers still happens on the main thread. This means
+ * that preloading doesn't affect determinism - a preloaded level is exactly the same as the one that was loaded the
+ * usual way.
+ *
+ * Decompression goes through `BakedLevelCache`, with cache lookups & writes done on the main thread.
+ *
+ * Cancelled preloads are abandoned, not waited for. The worker thread drops them at the next step of the load.
+ */
+class LevelPreloader {
+ public:
+    /** Max size of a decompressed level file that we're willing to keep in memory. */
+    static constexpr size_t MAX_LEVEL_SIZE = 32 * 1024 * 1024;
+
+    /**
+     * @param cacheFs                   File system for the `BakedLevelCache`.
+     */
+    explicit LevelPreloader(FileSystem *cacheFs);
+    ~LevelPreloader();
+
+    LevelPreloader(const LevelPreloader &) = delete;
+    LevelPreloader &operator=(const LevelPreloader &) = delete;
+
+    /**
+     * Starts preloading the provided level file on a worker thread. Cancels the preload that's currently in progress,
+     * if any.
+     *
+     * @param fileName                  Name of the level file, e.g. `d01.blv` or `out01.odm`.
+     * @param source                    Level file as it's stored in the LOD.
+     */
+    void preload(std::string_view fileName, Blob source);
+
+    /**
+     * @param fileName                  Name of the level file.
+     * @return                          Whether the provided level file is being preloaded, or was already preloaded.
+     */
+    [[nodiscard]] bool isPreloading(std::string_view fileName) const;
+
+    /**
+     * Takes the preloaded level, waiting for the worker thread if it's still running. Data for any other level is
+     * dropped.
+     *
+     * @param fileName                  Name of the level file.
+     * @param[out] dst                  Location to write the preloaded level into. Not touched if this function
+     *                                  returns `false`.
+     * @return                          Whether the preloaded level was written into `dst`.
+     */
+    bool take(std::string_view fileName, IndoorLocation_MM7 *dst);
+    bool take(std::string_view fileName, OutdoorLocation_MM7 *dst);
+
+    /**
+     * Cancels the preload that's currently in progress & drops the preloaded data. Doesn't block.
+     */
+    void cancel();
+
+ private:
+    using LevelData = std::variant<std::monostate, IndoorLocation_MM7, OutdoorLocation_MM7>;
+
+    struct Job {
+        std::string fileName;
+        Blob source; // Level file as it's stored in the LOD.
+        Blob cached; // Decompressed level file from the cache, empty on a cache miss.
+        Blob decompressed; // Level file decompressed by the worker, to be stored in the cache.
+        LevelData result;
+        std::atomic<bool> cancelled = false;
+        bool finished = false; // Guarded by `_mutex`.
+    };
+
+    template<class Location>
+    bool takeInternal(std::string_view fileName, Location *dst);
+
+    void run();
+
+    static void load(Job *job);
+
+ private:
+    BakedLevelCache _cache;
+    std::mutex _mutex;
+    std::condition_variable _jobAdded;
+    std::condition_variable _jobFinished;
+    std::shared_ptr<Job> _pendingJob; // Job waiting for the worker thread, guarded by `_mutex`.
+    std::shared_ptr<Job> _currentJob; // Job for the last `preload` call, only accessed from the main thread.
+    bool _stopping = false;
+    std::thread _thread;
+};
@@ -6,12 +6,15 @@
 #include <utility>
 #include <vector>
 #include <optional>
+#include <memory_resource>
 
 #include "Engine/Engine.h"
+#include "Engine/EngineProfiler.h"
 #include "Engine/Data/AwardEnums.h"
 #include "Engine/Data/HouseEnumFunctions.h"
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/DecalBuilder.h"
+#include "Engine/Objects/ActorHotState.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
@@ -44,6 +47,7 @@
 #include "Library/Logger/Logger.h"
 
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Memory/Arena.h"
 
 // should be injected into Actor but struct size cant be changed
 static SpellFxRenderer *spell_fx_renderer = EngineIocContainer::ResolveSpellFxRenderer();
@@ -2506,8 +2510,14 @@ void Actor::SummonMinion(int summonerId) {
     actor->summonerId = Pid(OBJECT_Actor, summonerId);
 }
 
+static bool isSkippedByBackgroundAi(AIState state, ActorAttributes attributes) {
+    return state == Dead || state == Removed || state == Disabled || attributes & ACTOR_FULL_AI_STATE;
+}
+
 //----- (00401A91) --------------------------------------------------------
 void Actor::UpdateActorAI() {
+    EngineProfilerScope profilerScope(engine->profiler, ENGINE_PHASE_AI);
+
     double v42;              // st7@176
     double v43;              // st6@176
     ActorAbility v45;                 // eax@192
@@ -2541,12 +2551,15 @@ void Actor::UpdateActorAI() {
 
     // this loops over all actors in background ai state
     for (unsigned i = 0; i < pActors.size(); ++i) {
-        Actor *pActor = &pActors[i];
         ai_near_actors_targets_pid[i] = Pid(OBJECT_Character, 0);
 
-        // Skip actor if: Dead / Removed / Disabled / or in full ai state
-        if (pActor->aiState == Dead || pActor->aiState == Removed ||
-            pActor->aiState == Disabled || pActor->attributes & ACTOR_FULL_AI_STATE)
+        // Skip actor if: Dead / Removed / Disabled / or in full ai state. Checking the hot state first means that
+        // skipped actors are never touched.
+        if (i < actorHotState.size() && isSkippedByBackgroundAi(actorHotState.aiStates[i], actorHotState.attributes[i]))
+            continue;
+
+        Actor *pActor = &pActors[i];
+        if (isSkippedByBackgroundAi(pActor->aiState, pActor->attributes))
             continue;
 
         // Kill actor if HP == 0
@@ -3913,28 +3926,51 @@ void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag,
     }
 }
 
+/**
+ * Sets the provided attribute flags on an actor, keeping `actorHotState` in sync.
+ */
+static void setActorAiAttributes(int actorId, ActorAttributes flags) {
+    pActors[actorId].attributes |= flags;
+    actorHotState.attributes[actorId] |= flags;
+}
+
+/**
+ * Clears the provided attribute flags on an actor, keeping `actorHotState` in sync. Doesn't touch the actor if
+ * there's nothing to clear.
+ */
+static void resetActorAiAttributes(int actorId, ActorAttributes flags) {
+    if (!(actorHotState.attributes[actorId] & flags))
+        return;
+    pActors[actorId].attributes &= ~flags;
+    actorHotState.attributes[actorId] &= ~flags;
+}
+
 //----- (004014E6) --------------------------------------------------------
 void Actor::MakeActorAIList_ODM() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
+    std::pmr::vector<std::pair<int, int>> activeActorsDistances(&frameArena()); // pair<id, distance>
 
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
-    for (Actor &actor : pActors) {
-        actor.ResetFullAiState();
-        if (!actor.CanAct()) {
-            actor.ResetActive();
+    actorHotState.update(pActors);
+
+    for (int actorId = 0; actorId < actorHotState.size(); actorId++) {
+        if (!actorHotState.canAct[actorId]) {
+            resetActorAiAttributes(actorId, ACTOR_FULL_AI_STATE | ACTOR_ACTIVE);
             continue;
         }
 
-        int delta_x = std::abs(pParty->pos.x - actor.pos.x);
-        int delta_y = std::abs(pParty->pos.y - actor.pos.y);
-        int delta_z = std::abs(pParty->pos.z - actor.pos.z);
+        Vec3f pos = actorHotState.positions[actorId];
+        int delta_x = std::abs(pParty->pos.x - pos.x);
+        int delta_y = std::abs(pParty->pos.y - pos.y);
+        int delta_z = std::abs(pParty->pos.z - pos.z);
 
-        int distance = int_get_vector_length(delta_x, delta_y, delta_z) - actor.radius;
+        int distance = int_get_vector_length(delta_x, delta_y, delta_z) - actorHotState.radii[actorId];
         if (distance < 0)
             distance = 0;
 
         if (distance < 5632) {
+            Actor &actor = pActors[actorId];
+            actor.ResetFullAiState();
             actor.ResetHostile();
             if (actor.ActorEnemy() || actor.GetActorsRelation(0) != HOSTILITY_FRIENDLY) {
                 actor.attributes |= ACTOR_HOSTILE;
@@ -3944,9 +3980,10 @@ void Actor::MakeActorAIList_ODM() {
                     pParty->SetRedAlert();
             }
             actor.attributes |= ACTOR_ACTIVE;
+            actorHotState.attributes[actorId] = actor.attributes;
             activeActorsDistances.push_back({actor.id, distance});
         } else {
-            actor.ResetActive();
+            resetActorAiAttributes(actorId, ACTOR_FULL_AI_STATE | ACTOR_ACTIVE);
         }
     }
 
@@ -3958,7 +3995,7 @@ void Actor::MakeActorAIList_ODM() {
     int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
     for (int i = 0; (i < configLimit) && (i < activeActorsDistances.size()); i++) {
         ai_near_actors_ids[i] = activeActorsDistances[i].first;
-        pActors[ai_near_actors_ids[i]].attributes |= ACTOR_FULL_AI_STATE;
+        setActorAiAttributes(ai_near_actors_ids[i], ACTOR_FULL_AI_STATE);
     }
 
     ai_arrays_size = std::min(configLimit, (int)activeActorsDistances.size());
@@ -3966,30 +4003,34 @@ void Actor::MakeActorAIList_ODM() {
 
 //----- (004016FA) --------------------------------------------------------
 int Actor::MakeActorAIList_BLV() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
-    std::vector<int> pickedActorIds;
+    std::pmr::vector<std::pair<int, int>> activeActorsDistances(&frameArena()); // pair<id, distance>
+    std::pmr::vector<int> pickedActorIds(&frameArena());
 
     // reset party alert level
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
     // find actors that are in range and can act
-    for (Actor &actor : pActors) {
-        actor.ResetFullAiState();
-        if (!actor.CanAct()) {
-            actor.ResetActive();
+    actorHotState.update(pActors);
+
+    for (int actorId = 0; actorId < actorHotState.size(); actorId++) {
+        if (!actorHotState.canAct[actorId]) {
+            resetActorAiAttributes(actorId, ACTOR_FULL_AI_STATE | ACTOR_ACTIVE);
             continue;
         }
 
-        int delta_x = std::abs(pParty->pos.x - actor.pos.x);
-        int delta_y = std::abs(pParty->pos.y - actor.pos.y);
-        int delta_z = std::abs(pParty->pos.z - actor.pos.z);
+        Vec3f pos = actorHotState.positions[actorId];
+        int delta_x = std::abs(pParty->pos.x - pos.x);
+        int delta_y = std::abs(pParty->pos.y - pos.y);
+        int delta_z = std::abs(pParty->pos.z - pos.z);
 
-        int distance = int_get_vector_length(delta_x, delta_y, delta_z) - actor.radius;
+        int distance = int_get_vector_length(delta_x, delta_y, delta_z) - actorHotState.radii[actorId];
         if (distance < 0)
             distance = 0;
 
         // actor is in range
         if (distance < 10240) {
+            Actor &actor = pActors[actorId];
+            actor.ResetFullAiState();
             actor.ResetHostile();
             if (actor.ActorEnemy() || actor.GetActorsRelation(0) != HOSTILITY_FRIENDLY) {
                 actor.attributes |= ACTOR_HOSTILE;
@@ -3998,10 +4039,11 @@ int Actor::MakeActorAIList_BLV() {
                 if (!(pParty->GetYellowAlert()) && distance < 5120)
                     pParty->SetYellowAlert();
             }
+            actorHotState.attributes[actorId] = actor.attributes;
             activeActorsDistances.push_back({actor.id, distance});
         } else {
             // otherwise idle
-            actor.ResetActive();
+            resetActorAiAttributes(actorId, ACTOR_FULL_AI_STATE | ACTOR_ACTIVE);
         }
     }
 
@@ -4012,7 +4054,7 @@ int Actor::MakeActorAIList_BLV() {
     // checks nearby actors can detect player and take nearest 30
     for (const auto &[actorId, _] : activeActorsDistances) {
         if (pActors[actorId].ActorNearby() || Detect_Between_Objects(Pid(OBJECT_Actor, actorId), Pid(OBJECT_Character, 0))) {
-            pActors[actorId].attributes |= ACTOR_NEARBY;
+            setActorAiAttributes(actorId, ACTOR_NEARBY);
             pickedActorIds.push_back(actorId);
             if (pickedActorIds.size() >= 30) {
                 break;
@@ -4021,11 +4063,11 @@ int Actor::MakeActorAIList_BLV() {
     }
 
     // add any actors than can act and are in the same sector
-    for (int i = 0; i < pActors.size(); ++i) {
-        if (pActors[i].CanAct() && pActors[i].sectorId == pBLVRenderParams->uPartySectorID) {
+    for (int i = 0; i < actorHotState.size(); ++i) {
+        if (actorHotState.canAct[i] && actorHotState.sectorIds[i] == pBLVRenderParams->uPartySectorID) {
             auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&] (int id) { return id == i; });
             if (found == pickedActorIds.end()) {
-                pActors[i].attributes |= ACTOR_ACTIVE;
+                setActorAiAttributes(i, ACTOR_ACTIVE);
                 pickedActorIds.push_back(i);
             }
         }
@@ -4036,7 +4078,7 @@ int Actor::MakeActorAIList_BLV() {
         if (pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct()) {
             auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&actorId = actorId] (int id) { return id == actorId; });
             if (found == pickedActorIds.end()) {
-                pActors[actorId].attributes |= ACTOR_ACTIVE;
+                setActorAiAttributes(actorId, ACTOR_ACTIVE);
                 pickedActorIds.push_back(actorId);
             }
         }
@@ -4046,7 +4088,7 @@ int Actor::MakeActorAIList_BLV() {
     int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
     for (int i = 0; (i < configLimit) && (i < pickedActorIds.size()); i++) {
         ai_near_actors_ids[i] = pickedActorIds[i];
-        pActors[pickedActorIds[i]].attributes |= ACTOR_FULL_AI_STATE;
+        setActorAiAttributes(pickedActorIds[i], ACTOR_FULL_AI_STATE);
     }
 
     ai_arrays_size = std::min(configLimit, (int)pickedActorIds.size());
@@ -4118,6 +4160,9 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
     // monster in same sector with player/ monster
     if (obj1_sector == obj2_sector) return 1;
 
+    // can't get there by walking portals
+    if (!pIndoor->sectorDetection.isDetectable(obj1_sector, obj2_sector)) return 0;
+
     // normalising
     float rayxnorm = dist_x / dist_3d;
     float rayynorm = dist_y / dist_3d;
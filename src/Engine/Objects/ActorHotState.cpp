@@ -0,0 +1,36 @@
+#include "ActorHotState.h"
+
+#include <limits>
+
+#include "Actor.h"
+
+ActorHotState actorHotState;
+
+void ActorHotState::update(const std::deque<Actor> &actors) {
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+
+    positions.clear();
+    radii.clear();
+    heights.clear();
+    sectorIds.clear();
+    aiStates.clear();
+    attributes.clear();
+    canAct.clear();
+    collisionBoxes.clear();
+
+    for (const Actor &actor : actors) {
+        positions.push_back(actor.pos);
+        radii.push_back(actor.radius);
+        heights.push_back(actor.height);
+        sectorIds.push_back(actor.sectorId);
+        aiStates.push_back(actor.aiState);
+        attributes.push_back(actor.attributes);
+        canAct.push_back(actor.CanAct());
+
+        if (isAiStateSolid(actor.aiState)) {
+            collisionBoxes.add(BBoxf::forCylinder(actor.pos, actor.radius, actor.height));
+        } else {
+            collisionBoxes.add(BBoxf{nan, nan, nan, nan, nan, nan});
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Library/Geometry/BBoxArray.h"
+#include "Library/Geometry/Vec.h"
+
+#include "ActorEnums.h"
+
+class Actor;
+
+/**
+ * @param state                         Actor AI state.
+ * @return                              Whether actors in this state can be collided with.
+ */
+inline bool isAiStateSolid(AIState state) {
+    return !(state == Removed || state == Dying || state == Disabled || state == Dead || state == Summoned);
+}
+
+/**
+ * Hot per-tick state of all actors, laid out as a structure of arrays & indexed by actor id.
+ *
+ * `Actor` is over a kilobyte, so a loop over `pActors` that only needs positions & AI states pulls in several cache
+ * lines per actor. Loops that run over all actors every tick read these arrays instead, and only touch the actors
+ * that they actually need to update.
+ *
+ * This is a mirror of the actor state, it's not saved & not included in snapshots. It's rebuilt with `update` right
+ * before the loops that use it, and is not kept in sync with the actors after that - code that changes the mirrored
+ * fields of an actor while the mirror is in use should update the mirror too.
+ */
+class ActorHotState {
+ public:
+    /**
+     * Rebuilds all the arrays from the provided actors.
+     *
+     * @param actors                    Actors to mirror, normally `pActors`.
+     */
+    void update(const std::deque<Actor> &actors);
+
+    [[nodiscard]] size_t size() const {
+        return positions.size();
+    }
+
+    std::vector<Vec3f> positions;
+    std::vector<uint16_t> radii;
+    std::vector<uint16_t> heights;
+    std::vector<int> sectorIds;
+    std::vector<AIState> aiStates;
+    std::vector<ActorAttributes> attributes;
+    std::vector<uint8_t> canAct; // Result of `Actor::CanAct`, not a `std::vector<bool>` so that reads stay cheap.
+
+    /** Collision boxes of the actors, boxes of actors that can't be collided with are NaNs. */
+    BBoxArray collisionBoxes;
+
+    /** Scratch buffer for `collisionBoxes` queries. */
+    std::vector<int> collisionCandidates;
+};
+
+extern ActorHotState actorHotState;
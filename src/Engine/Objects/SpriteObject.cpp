@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Engine/Engine.h"
+#include "Engine/EngineProfiler.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Time/Timer.h"
 #include "Engine/Events/Processor.h"
@@ -1273,6 +1274,8 @@ void applySpellSpriteDamage(unsigned int uLayingItemID, Pid pid) {
 }
 
 void UpdateObjects() {
+    EngineProfilerScope profilerScope(engine->profiler, ENGINE_PHASE_OBJECTS);
+
     for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
         if (pSpriteObjects[i].uAttributes & SPRITE_SKIP_A_FRAME) {
             pSpriteObjects[i].uAttributes &= ~SPRITE_SKIP_A_FRAME;
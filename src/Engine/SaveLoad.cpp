@@ -178,7 +178,11 @@ std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view
         lodWriter.write(file_name, lod::encodeCompressed(uncompressed));
     }
 
-    lodWriter.write("image.pcx", pcx::encode(render->MakeViewportScreenshot(150, 112)));
+    if (RgbaImageView thumbnail = engine->saveThumbnail()) {
+        lodWriter.write("image.pcx", pcx::encode(thumbnail));
+    } else {
+        lodWriter.write("image.pcx", pcx::encode(render->MakeViewportScreenshot(150, 112)));
+    }
 
     resultHeader.name = title;
     resultHeader.locationName = currentMapName;
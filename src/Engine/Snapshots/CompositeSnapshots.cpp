@@ -31,6 +31,7 @@ void reconstruct(const IndoorLocation_MM7 &src, IndoorLocation *dst) {
 
     for (size_t i = 0, j = 0; i < dst->pFaces.size(); ++i) {
         BLVFace *pFace = &dst->pFaces[i];
+        pFace->index = i;
 
         pFace->pVertexIDs = dst->pLFaces.data() + j;
         j += pFace->uNumVertices + 1;
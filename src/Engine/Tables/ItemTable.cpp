@@ -258,11 +258,61 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         }
     }
 
+    initializeWeightedTables();
+
     ItemGen::PopulateSpecialBonusMap();
     ItemGen::PopulateArtifactBonusMap();
     ItemGen::PopulateRegularBonusMap();
 }
 
+void ItemTable::initializeWeightedTables() {
+    for (ItemTreasureLevel level : itemsByTreasureLevel.indices()) {
+        itemsByTreasureLevel[level].clear();
+        for (WeightedTable<ItemId> &table : itemsByType[level])
+            table.clear();
+        for (WeightedTable<ItemId> &table : itemsBySkill[level])
+            table.clear();
+
+        for (ItemId itemId : allSpawnableItems()) {
+            const ItemDesc &desc = pItems[itemId];
+            int weight = desc.uChanceByTreasureLvl[level];
+            itemsByTreasureLevel[level].add(itemId, weight);
+            itemsByType[level][desc.uEquipType].add(itemId, weight);
+            if (desc.uSkillType != CHARACTER_SKILL_INVALID)
+                itemsBySkill[level][desc.uSkillType].add(itemId, weight);
+        }
+    }
+
+    for (ItemType type : standardEnchantmentsByType.indices()) {
+        standardEnchantmentsByType[type].clear();
+        for (CharacterAttribute attr : allEnchantableAttributes())
+            standardEnchantmentsByType[type].add(attr, standardEnchantments[attr].chancesByItemType[type]);
+    }
+
+    for (ItemTreasureLevel level : specialEnchantmentsByType.indices()) {
+        for (ItemType type : specialEnchantmentsByType[level].indices()) {
+            WeightedTable<ItemEnchantment> &table = specialEnchantmentsByType[level][type];
+            table.clear();
+
+            for (ItemEnchantment ench : pSpecialEnchantments.indices()) {
+                int tr_lv = (pSpecialEnchantments[ench].iTreasureLevel) & 3;
+
+                // tr_lv  0 = treasure level 3/4
+                // tr_lv  1 = treasure level 3/4/5
+                // tr_lv  2 = treasure level 4/5
+                // tr_lv  3 = treasure level 5/6
+
+                if ((level == ITEM_TREASURE_LEVEL_3) && (tr_lv == 1 || tr_lv == 0) ||
+                    (level == ITEM_TREASURE_LEVEL_4) && (tr_lv == 2 || tr_lv == 1 || tr_lv == 0) ||
+                    (level == ITEM_TREASURE_LEVEL_5) && (tr_lv == 3 || tr_lv == 2 || tr_lv == 1) ||
+                    (level == ITEM_TREASURE_LEVEL_6) && (tr_lv == 3)) {
+                    table.add(ench, pSpecialEnchantments[ench].to_item_apply[type]);
+                }
+            }
+        }
+    }
+}
+
 //----- (00456D17) --------------------------------------------------------
 void ItemTable::SetSpecialBonus(ItemGen *pItem) {
     if (pItems[pItem->uItemID].uMaterial == RARITY_SPECIAL) {
@@ -371,11 +421,6 @@ void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
 void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTreasureType, ItemGen *outItem) {
     assert(isRandomTreasureLevel(treasureLevel));
 
-    std::vector<ItemId> possibleItems;
-    std::vector<ItemEnchantment> possibleEnchantments;
-    std::vector<int> cumulativeWeights;
-    int weightSum = 0;
-
     assert(outItem != NULL);
     *outItem = ItemGen();
 
@@ -471,35 +516,21 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
                 break;
         }
 
+        const WeightedTable<ItemId> *possibleItems = nullptr;
         if (requestedSkill == CHARACTER_SKILL_INVALID) {  // no skill for this item needed
-            for (ItemId itemId : allSpawnableItems()) {
-                if (pItems[itemId].uEquipType == requestedEquip) {
-                    if (pItems[itemId].uChanceByTreasureLvl[treasureLevel]) {
-                        weightSum += pItems[itemId].uChanceByTreasureLvl[treasureLevel];
-                        possibleItems.push_back(itemId);
-                        cumulativeWeights.push_back(weightSum);
-                    }
-                }
-            }
+            if (itemsByType[treasureLevel].indices().contains(requestedEquip))
+                possibleItems = &itemsByType[treasureLevel][requestedEquip];
         } else {  // have needed skill
-            for (ItemId itemId : allSpawnableItems()) {
-                if (pItems[itemId].uSkillType == requestedSkill) {
-                    if (pItems[itemId].uChanceByTreasureLvl[treasureLevel]) {
-                        weightSum += pItems[itemId].uChanceByTreasureLvl[treasureLevel];
-                        possibleItems.push_back(itemId);
-                        cumulativeWeights.push_back(weightSum);
-                    }
-                }
-            }
+            possibleItems = &itemsBySkill[treasureLevel][requestedSkill];
         }
 
-        if (weightSum) {
-            int pickedWeight = grng->random(weightSum) + 1;
-            auto foundWeight = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pickedWeight);
+        if (possibleItems && !possibleItems->empty()) {
+            int pickedWeight = grng->random(possibleItems->totalWeight()) + 1;
+            const ItemId *foundItem = possibleItems->find(pickedWeight);
 
-            assert(foundWeight != cumulativeWeights.end());
+            assert(foundItem);
 
-            outItem->uItemID = possibleItems[std::distance(cumulativeWeights.begin(), foundWeight)];
+            outItem->uItemID = *foundItem;
         } else {
             outItem->uItemID = ITEM_CRUDE_LONGSWORD;
         }
@@ -521,14 +552,10 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
         }
 
         // Otherwise try to spawn any random item
+        // Note that chanceByTreasureLevelSums also includes non-spawnable items, so we might not find anything here.
         int randomWeight = grng->random(this->chanceByTreasureLevelSums[treasureLevel]) + 1;
-        for (ItemId itemId : allSpawnableItems()) {
-            weightSum += pItems[itemId].uChanceByTreasureLvl[treasureLevel];
-            if (weightSum >= randomWeight) {
-                outItem->uItemID = itemId;
-                break;
-            }
-        }
+        if (const ItemId *foundItem = itemsByTreasureLevel[treasureLevel].find(randomWeight))
+            outItem->uItemID = *foundItem;
     }
     if (outItem->isPotion() && outItem->uItemID != ITEM_POTION_BOTTLE) {  // if it potion set potion spec
         outItem->potionPower = grng->randomDice(2, 4) * std::to_underlying(treasureLevel);
@@ -567,14 +594,8 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
             int bonusChanceRoll = grng->random(100);
             if (bonusChanceRoll < uBonusChanceStandart[treasureLevel]) {
                 int enchantmentChanceSumRoll = grng->random(chanceByItemTypeSums[outItem->GetItemEquipType()]) + 1;
-                int currentEnchantmentChancesSum = 0;
-                for (CharacterAttribute attr : allEnchantableAttributes()) {
-                    if (currentEnchantmentChancesSum >= enchantmentChanceSumRoll)
-                        break;
-
-                    currentEnchantmentChancesSum += standardEnchantments[attr].chancesByItemType[outItem->GetItemEquipType()];
-                    outItem->attributeEnchantment = attr;
-                }
+                const CharacterAttribute *foundAttribute = standardEnchantmentsByType[outItem->GetItemEquipType()].find(enchantmentChanceSumRoll);
+                outItem->attributeEnchantment = foundAttribute ? *foundAttribute : ATTRIBUTE_LAST_ENCHANTABLE;
                 assert(outItem->attributeEnchantment);
 
                 outItem->m_enchantmentStrength = bonusRanges[treasureLevel].minR + grng->random(bonusRanges[treasureLevel].maxR - bonusRanges[treasureLevel].minR + 1);
@@ -602,31 +623,9 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
             return;
     }
 
-    cumulativeWeights.clear();
-    weightSum = 0;
-    for (ItemEnchantment ench : pSpecialEnchantments.indices()) {
-        int tr_lv = (pSpecialEnchantments[ench].iTreasureLevel) & 3;
-
-        // tr_lv  0 = treasure level 3/4
-        // tr_lv  1 = treasure level 3/4/5
-        // tr_lv  2 = treasure level 4/5
-        // tr_lv  3 = treasure level 5/6
-
-        if ((treasureLevel == ITEM_TREASURE_LEVEL_3) && (tr_lv == 1 || tr_lv == 0) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_4) && (tr_lv == 2 || tr_lv == 1 || tr_lv == 0) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_5) && (tr_lv == 3 || tr_lv == 2 || tr_lv == 1) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_6) && (tr_lv == 3)) {
-            int spc = pSpecialEnchantments[ench].to_item_apply[outItem->GetItemEquipType()];
-            if (spc) {
-                weightSum += spc;
-                possibleEnchantments.push_back(ench);
-                cumulativeWeights.push_back(weightSum);
-            }
-        }
-    }
-
-    int pickedWeight = grng->random(weightSum) + 1;
-    auto foundWeight = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pickedWeight);
-    assert(foundWeight != cumulativeWeights.end());
-    outItem->special_enchantment = possibleEnchantments[std::distance(cumulativeWeights.begin(), foundWeight)];
+    const WeightedTable<ItemEnchantment> &possibleEnchantments = specialEnchantmentsByType[treasureLevel][outItem->GetItemEquipType()];
+    int pickedWeight = grng->random(possibleEnchantments.totalWeight()) + 1;
+    const ItemEnchantment *foundEnchantment = possibleEnchantments.find(pickedWeight);
+    assert(foundEnchantment);
+    outItem->special_enchantment = *foundEnchantment;
 }
@@ -6,6 +6,7 @@
 #include "Engine/Objects/Items.h"
 
 #include "Utility/IndexedArray.h"
+#include "Utility/WeightedTable.h"
 
 class GameResourceManager;
 class Blob;
@@ -28,6 +29,12 @@ struct ItemTable {
     bool IsMaterialSpecial(const ItemGen *pItem);
     bool IsMaterialNonCommon(const ItemGen *pItem);
 
+    /**
+     * Fills in the weighted tables that `generateItem` samples from. Must be called after the item & enchantment
+     * tables are loaded.
+     */
+    void initializeWeightedTables();
+
     IndexedArray<ItemDesc, ITEM_FIRST_VALID, ITEM_LAST_VALID> pItems;                   // 4-9604h
     IndexedArray<ItemEnchantmentTable, ATTRIBUTE_FIRST_ENCHANTABLE, ATTRIBUTE_LAST_ENCHANTABLE> standardEnchantments;                // 9604h
     IndexedArray<ItemSpecialEnchantmentTable, ITEM_ENCHANTMENT_FIRST_VALID, ITEM_ENCHANTMENT_LAST_VALID> pSpecialEnchantments;  // 97E4h -9FC4h
@@ -51,6 +58,14 @@ struct ItemTable {
     char field_1179D;
     char field_1179E;
     char field_1179F;
+
+    // Weighted tables for generateItem, built in initializeWeightedTables. Entries are in the same order as in the
+    // tables above, so sampling from them consumes the same random numbers & gives the same results as a linear scan.
+    IndexedArray<WeightedTable<ItemId>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> itemsByTreasureLevel;
+    IndexedArray<IndexedArray<WeightedTable<ItemId>, ITEM_TYPE_FIRST, ITEM_TYPE_LAST>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> itemsByType;
+    IndexedArray<IndexedArray<WeightedTable<ItemId>, CHARACTER_SKILL_FIRST, CHARACTER_SKILL_LAST>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> itemsBySkill;
+    IndexedArray<WeightedTable<CharacterAttribute>, ITEM_TYPE_FIRST_NORMAL_ENCHANTABLE, ITEM_TYPE_LAST_NORMAL_ENCHANTABLE> standardEnchantmentsByType;
+    IndexedArray<IndexedArray<WeightedTable<ItemEnchantment>, ITEM_TYPE_FIRST_SPECIAL_ENCHANTABLE, ITEM_TYPE_LAST_SPECIAL_ENCHANTABLE>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> specialEnchantmentsByType;
 };
 
 extern ItemTable *pItemTable;
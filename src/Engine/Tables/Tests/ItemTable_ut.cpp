@@ -0,0 +1,160 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/ItemEnumFunctions.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+// Linear scans below are what ItemTable::generateItem did before it switched to weighted tables.
+
+static ItemId linearScanItem(const ItemTable &table, ItemTreasureLevel level, ItemType type, CharacterSkillType skill,
+                             int pickedWeight) {
+    int weightSum = 0;
+    for (ItemId itemId : allSpawnableItems()) {
+        const ItemDesc &desc = table.pItems[itemId];
+        bool matches = skill == CHARACTER_SKILL_INVALID ? desc.uEquipType == type : desc.uSkillType == skill;
+        if (!matches || !desc.uChanceByTreasureLvl[level])
+            continue;
+        weightSum += desc.uChanceByTreasureLvl[level];
+        if (weightSum >= pickedWeight)
+            return itemId;
+    }
+    return ITEM_NULL;
+}
+
+static CharacterAttribute linearScanStandardEnchantment(const ItemTable &table, ItemType type, int roll) {
+    CharacterAttribute result = ATTRIBUTE_LAST_ENCHANTABLE;
+    int sum = 0;
+    for (CharacterAttribute attr : allEnchantableAttributes()) {
+        if (sum >= roll)
+            break;
+        sum += table.standardEnchantments[attr].chancesByItemType[type];
+        result = attr;
+    }
+    return result;
+}
+
+static ItemEnchantment linearScanSpecialEnchantment(const ItemTable &table, ItemTreasureLevel level, ItemType type,
+                                                    int pickedWeight) {
+    int weightSum = 0;
+    for (ItemEnchantment ench : table.pSpecialEnchantments.indices()) {
+        int trLv = table.pSpecialEnchantments[ench].iTreasureLevel & 3;
+        if ((level == ITEM_TREASURE_LEVEL_3) && (trLv == 1 || trLv == 0) ||
+            (level == ITEM_TREASURE_LEVEL_4) && (trLv == 2 || trLv == 1 || trLv == 0) ||
+            (level == ITEM_TREASURE_LEVEL_5) && (trLv == 3 || trLv == 2 || trLv == 1) ||
+            (level == ITEM_TREASURE_LEVEL_6) && (trLv == 3)) {
+            weightSum += table.pSpecialEnchantments[ench].to_item_apply[type];
+            if (table.pSpecialEnchantments[ench].to_item_apply[type] && weightSum >= pickedWeight)
+                return ench;
+        }
+    }
+    return ITEM_ENCHANTMENT_NULL;
+}
+
+static std::unique_ptr<ItemTable> makeRandomItemTable(RandomEngine *rng) {
+    auto result = std::make_unique<ItemTable>();
+
+    for (ItemId itemId : allSpawnableItems()) {
+        ItemDesc &desc = result->pItems[itemId];
+        desc.uEquipType = static_cast<ItemType>(rng->random(std::to_underlying(ITEM_TYPE_LAST) + 1));
+        desc.uSkillType = rng->randomBool() ? CHARACTER_SKILL_INVALID :
+                          static_cast<CharacterSkillType>(rng->random(std::to_underlying(CHARACTER_SKILL_LAST) + 1));
+        for (ItemTreasureLevel level : desc.uChanceByTreasureLvl.indices())
+            desc.uChanceByTreasureLvl[level] = rng->random(4) == 0 ? 0 : rng->random(50); // Lots of zeros.
+    }
+
+    for (CharacterAttribute attr : allEnchantableAttributes())
+        for (ItemType type : result->standardEnchantments[attr].chancesByItemType.indices())
+            result->standardEnchantments[attr].chancesByItemType[type] = rng->random(3) == 0 ? 0 : rng->random(30);
+
+    for (ItemEnchantment ench : result->pSpecialEnchantments.indices()) {
+        result->pSpecialEnchantments[ench].iTreasureLevel = rng->random(4);
+        for (ItemType type : result->pSpecialEnchantments[ench].to_item_apply.indices())
+            result->pSpecialEnchantments[ench].to_item_apply[type] = rng->random(3) == 0 ? 0 : rng->random(20);
+    }
+
+    result->initializeWeightedTables();
+    return result;
+}
+
+UNIT_TEST(ItemTable, WeightedTablesMatchLinearScan) {
+    MersenneTwisterRandomEngine rng;
+    rng.seed(1234);
+    std::unique_ptr<ItemTable> table = makeRandomItemTable(&rng);
+
+    for (ItemTreasureLevel level : table->itemsByTreasureLevel.indices()) {
+        for (ItemType type : table->itemsByType[level].indices()) {
+            const WeightedTable<ItemId> &items = table->itemsByType[level][type];
+            for (int i = 0; i < 100 && !items.empty(); i++) {
+                int weight = rng.random(items.totalWeight()) + 1;
+                EXPECT_EQ(*items.find(weight), linearScanItem(*table, level, type, CHARACTER_SKILL_INVALID, weight));
+            }
+        }
+
+        for (CharacterSkillType skill : table->itemsBySkill[level].indices()) {
+            const WeightedTable<ItemId> &items = table->itemsBySkill[level][skill];
+            for (int i = 0; i < 100 && !items.empty(); i++) {
+                int weight = rng.random(items.totalWeight()) + 1;
+                EXPECT_EQ(*items.find(weight), linearScanItem(*table, level, ITEM_TYPE_NONE, skill, weight));
+            }
+        }
+
+        for (ItemType type : table->specialEnchantmentsByType[level].indices()) {
+            const WeightedTable<ItemEnchantment> &enchantments = table->specialEnchantmentsByType[level][type];
+            for (int i = 0; i < 100 && !enchantments.empty(); i++) {
+                int weight = rng.random(enchantments.totalWeight()) + 1;
+                EXPECT_EQ(*enchantments.find(weight), linearScanSpecialEnchantment(*table, level, type, weight));
+            }
+        }
+    }
+
+    for (ItemType type : table->standardEnchantmentsByType.indices()) {
+        const WeightedTable<CharacterAttribute> &enchantments = table->standardEnchantmentsByType[type];
+        ASSERT_FALSE(enchantments.empty());
+        for (int i = 0; i < 100; i++) {
+            // Rolls past the end are also checked, the linear scan falls back to the last enchantment there.
+            int roll = rng.random(enchantments.totalWeight() + 10) + 1;
+            const CharacterAttribute *found = enchantments.find(roll);
+            EXPECT_EQ(found ? *found : ATTRIBUTE_LAST_ENCHANTABLE, linearScanStandardEnchantment(*table, type, roll));
+        }
+    }
+}
+
+UNIT_BENCHMARK(ItemTable, WeightedTables) {
+    // Shops, chests & monster loot can generate hundreds of items in a row, and each of these goes through an item
+    // table lookup. ItemTable::generateItem itself needs a party & a config, so we're timing the lookups directly.
+    MersenneTwisterRandomEngine rng;
+    rng.seed(1234);
+    std::unique_ptr<ItemTable> table = makeRandomItemTable(&rng);
+
+    std::vector<std::pair<ItemType, int>> queries;
+    for (int i = 0; i < 100000; i++) {
+        ItemType type = rng.randomSample(table->itemsByType[ITEM_TREASURE_LEVEL_3].indices());
+        const WeightedTable<ItemId> &items = table->itemsByType[ITEM_TREASURE_LEVEL_3][type];
+        if (!items.empty())
+            queries.emplace_back(type, rng.random(items.totalWeight()) + 1);
+    }
+
+    int tableSum = 0;
+    double tableNs = benchmarkNsPerItem(queries.size(), 1, [&] {
+        for (auto [type, weight] : queries)
+            tableSum += std::to_underlying(*table->itemsByType[ITEM_TREASURE_LEVEL_3][type].find(weight));
+    });
+
+    int scanSum = 0;
+    double scanNs = benchmarkNsPerItem(queries.size(), 1, [&] {
+        for (auto [type, weight] : queries)
+            scanSum += std::to_underlying(linearScanItem(*table, ITEM_TREASURE_LEVEL_3, type, CHARACTER_SKILL_INVALID,
+                                                         weight));
+    });
+
+    EXPECT_EQ(tableSum, scanSum);
+    reportBenchmark("WeightedTable::find", tableNs, "item");
+    reportBenchmark("ItemTable, linear scan", scanNs, "item");
+}
@@ -0,0 +1,107 @@
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+#include "Testing/Unit/UnitBenchmark.h"
+
+#include "Engine/BakedLevelCache.h"
+
+#include "Library/FileSystem/Directory/DirectoryFileSystem.h"
+#include "Library/FileSystem/Memory/MemoryFileSystem.h"
+#include "Library/LodFormats/LodFormats.h"
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+UNIT_TEST(BakedLevelCache, Basic) {
+    MemoryFileSystem fs("ramfs");
+    BakedLevelCache cache(&fs);
+
+    std::string data(10000, 'a');
+    Blob source = lod::encodeCompressed(Blob::view(data));
+
+    Blob decoded = cache.decode("d01.blv", source);
+    EXPECT_EQ(decoded.string_view(), data);
+    EXPECT_TRUE(fs.exists("cache/levels/d01.blv"));
+
+    // Cached data should be used directly.
+    std::string cached(fs.read("cache/levels/d01.blv").string_view());
+    cached.replace(cached.size() - 5, 5, "bbbbb");
+    fs.write("cache/levels/d01.blv", Blob::fromString(cached));
+    EXPECT_EQ(cache.decode("d01.blv", source).string_view(), std::string(9995, 'a') + std::string(5, 'b'));
+}
+
+UNIT_TEST(BakedLevelCache, SourceChanged) {
+    MemoryFileSystem fs("ramfs");
+    BakedLevelCache cache(&fs);
+
+    std::string data0(10000, 'a');
+    std::string data1(10000, 'c');
+    EXPECT_EQ(cache.decode("d01.blv", lod::encodeCompressed(Blob::view(data0))).string_view(), data0);
+    EXPECT_EQ(cache.decode("d01.blv", lod::encodeCompressed(Blob::view(data1))).string_view(), data1);
+    EXPECT_EQ(cache.decode("d01.blv", lod::encodeCompressed(Blob::view(data1))).string_view(), data1);
+}
+
+UNIT_TEST(BakedLevelCache, Corrupted) {
+    MemoryFileSystem fs("ramfs");
+    BakedLevelCache cache(&fs);
+
+    std::string data(10000, 'a');
+    Blob source = lod::encodeCompressed(Blob::view(data));
+
+    fs.write("cache/levels/d01.blv", Blob::fromString("OELC"));
+    EXPECT_EQ(cache.decode("d01.blv", source).string_view(), data);
+
+    // Cache was overwritten with a valid one.
+    EXPECT_GT(fs.read("cache/levels/d01.blv").size(), data.size());
+}
+
+UNIT_TEST(BakedLevelCache, Uncompressed) {
+    MemoryFileSystem fs("ramfs");
+    BakedLevelCache cache(&fs);
+
+    // Raw data is passed through as is, and is not cached.
+    std::string data = "raw level data";
+    EXPECT_EQ(cache.decode("d01.dlv", Blob::view(data)).string_view(), data);
+    EXPECT_FALSE(fs.exists("cache/levels/d01.dlv"));
+}
+
+UNIT_BENCHMARK(BakedLevelCache, Decode) {
+    // There's no game data in unit tests, so we're timing a synthetic 2Mb level. Real level files are mostly vertex
+    // coordinates & face index lists, so we generate a smooth random walk, which zlib compresses about as well.
+    MersenneTwisterRandomEngine rng;
+    rng.seed(1234);
+    std::vector<int16_t> level(1024 * 1024);
+    int16_t value = 0;
+    for (int16_t &element : level) {
+        value += static_cast<int16_t>(rng.random(65) - 32);
+        element = value;
+    }
+    Blob data = Blob::view(level.data(), level.size() * sizeof(int16_t));
+    Blob source = lod::encodeCompressed(data);
+
+    // Directory file system, so that cached reads go through Blob::fromFile like they do in the game.
+    std::filesystem::remove_all("baked_level_cache_benchmark");
+    std::filesystem::create_directory("baked_level_cache_benchmark");
+    DirectoryFileSystem fs("baked_level_cache_benchmark");
+    BakedLevelCache cache(&fs);
+    EXPECT_EQ(cache.decode("d01.blv", source).string_view(), data.string_view()); // Fill the cache.
+
+    constexpr int iterations = 20;
+    bool decompressedOk = true;
+    double decompressNs = benchmarkNsPerItem(data.size(), iterations, [&] {
+        decompressedOk &= lod::decodeCompressed(source).string_view() == data.string_view();
+    });
+
+    bool cachedOk = true;
+    double cachedNs = benchmarkNsPerItem(data.size(), iterations, [&] {
+        cachedOk &= cache.decode("d01.blv", source).string_view() == data.string_view();
+    });
+
+    EXPECT_TRUE(decompressedOk);
+    EXPECT_TRUE(cachedOk);
+    reportBenchmark("lod::decodeCompressed", decompressNs, "byte");
+    reportBenchmark("BakedLevelCache::decode", cachedNs, "byte");
+
+    std::filesystem::remove_all("baked_level_cache_benchmark");
+}
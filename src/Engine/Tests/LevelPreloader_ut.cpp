@@ -0,0 +1,127 @@
+#include <cstring>
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/BakedLevelCache.h"
+#include "Engine/LevelPreloader.h"
+
+#include "Library/FileSystem/Memory/MemoryFileSystem.h"
+#include "Library/LodFormats/LodFormats.h"
+
+// All-zero level file is a valid level file with no faces, no sectors, etc.
+static Blob emptyLevelData() {
+    return Blob::fromString(std::string(1024 * 1024, '\0'));
+}
+
+static Blob emptyLevel() {
+    return lod::encodeCompressed(emptyLevelData());
+}
+
+UNIT_TEST(LevelPreloader, Basic) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("d01.blv", emptyLevel());
+    EXPECT_TRUE(preloader.isPreloading("d01.blv"));
+    EXPECT_TRUE(preloader.isPreloading("D01.BLV"));
+    EXPECT_FALSE(preloader.isPreloading("d02.blv"));
+
+    IndoorLocation_MM7 location;
+    EXPECT_TRUE(preloader.take("d01.blv", &location));
+    EXPECT_TRUE(location.faces.empty());
+
+    // Preloaded data can only be taken once.
+    EXPECT_FALSE(preloader.isPreloading("d01.blv"));
+    EXPECT_FALSE(preloader.take("d01.blv", &location));
+}
+
+UNIT_TEST(LevelPreloader, Outdoor) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("out01.odm", emptyLevel());
+
+    OutdoorLocation_MM7 location;
+    EXPECT_TRUE(preloader.take("out01.odm", &location));
+    EXPECT_TRUE(location.models.empty());
+}
+
+UNIT_TEST(LevelPreloader, OtherLevel) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("d01.blv", emptyLevel());
+
+    // Transition didn't happen, preloaded data should be dropped.
+    IndoorLocation_MM7 location;
+    EXPECT_FALSE(preloader.take("d02.blv", &location));
+    EXPECT_FALSE(preloader.isPreloading("d01.blv"));
+    EXPECT_FALSE(preloader.take("d01.blv", &location));
+}
+
+UNIT_TEST(LevelPreloader, WrongType) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("d01.blv", emptyLevel());
+
+    OutdoorLocation_MM7 location;
+    EXPECT_FALSE(preloader.take("d01.blv", &location));
+}
+
+UNIT_TEST(LevelPreloader, Corrupted) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("d01.blv", Blob::fromString("not a level"));
+
+    // Errors are swallowed, the level is then loaded the usual way.
+    IndoorLocation_MM7 location;
+    EXPECT_FALSE(preloader.take("d01.blv", &location));
+}
+
+UNIT_TEST(LevelPreloader, Cancel) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("d01.blv", emptyLevel());
+    preloader.preload("d02.blv", emptyLevel());
+    EXPECT_FALSE(preloader.isPreloading("d01.blv"));
+    EXPECT_TRUE(preloader.isPreloading("d02.blv"));
+
+    preloader.cancel();
+    EXPECT_FALSE(preloader.isPreloading("d02.blv"));
+
+    IndoorLocation_MM7 location;
+    EXPECT_FALSE(preloader.take("d02.blv", &location));
+}
+
+UNIT_TEST(LevelPreloader, Cache) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+    preloader.preload("d01.blv", emptyLevel());
+
+    IndoorLocation_MM7 location;
+    EXPECT_TRUE(preloader.take("d01.blv", &location));
+    EXPECT_TRUE(fs.exists("cache/levels/d01.blv"));
+
+    // Corrupt the zlib stream, but put valid data into the cache. Preloader should take the data from the cache.
+    std::string compressed = std::string(emptyLevel().string_view());
+    for (size_t i = compressed.size() / 2; i < compressed.size(); i++)
+        compressed[i] ^= 0x55;
+    Blob source = Blob::fromString(compressed);
+    BakedLevelCache(&fs).store("d02.blv", source, emptyLevelData());
+
+    preloader.preload("d02.blv", Blob::share(source));
+    EXPECT_TRUE(preloader.take("d02.blv", &location));
+}
+
+UNIT_TEST(LevelPreloader, TooBig) {
+    MemoryFileSystem fs("ramfs");
+    LevelPreloader preloader(&fs);
+
+    // Patch the decompressed size in the LOD header, the preloader should bail out w/o decompressing anything.
+    std::string compressed = std::string(emptyLevel().string_view());
+    uint32_t decompressedSize = LevelPreloader::MAX_LEVEL_SIZE + 1;
+    std::memcpy(compressed.data() + 12, &decompressedSize, sizeof(decompressedSize));
+    preloader.preload("d01.blv", Blob::fromString(compressed));
+
+    IndoorLocation_MM7 location;
+    EXPECT_FALSE(preloader.take("d01.blv", &location));
+    EXPECT_FALSE(fs.exists("cache/levels/d01.blv"));
+}
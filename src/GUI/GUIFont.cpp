@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <ranges>
 #include <string>
+#include <utility>
 
 #include "Engine/AssetsManager.h"
 #include "Engine/LodTextureCache.h"
@@ -54,16 +55,18 @@ static Color parseColorTag(const char *tag, const Color &defaultColor) {
     }
 }
 
-GUIFont::GUIFont() = default;
+GUIFont::GUIFont(FontData data) : pData(std::move(data)) {
+    maxcharwidth = std::ranges::max(pData.header.pMetrics | std::views::transform(&GUICharMetric::uWidth));
+}
 
 GUIFont::~GUIFont() {
     ReleaseFontTex();
 }
 
 std::unique_ptr<GUIFont> GUIFont::LoadFont(std::string_view pFontFile, std::string_view pFontPalette) {
-    std::unique_ptr<GUIFont> result = std::make_unique<GUIFont>();
-
-    deserialize(pIcons_LOD->LoadCompressedTexture(pFontFile), &result->pData, tags::via<FontData_MM7>);
+    FontData data;
+    deserialize(pIcons_LOD->LoadCompressedTexture(pFontFile), &data, tags::via<FontData_MM7>);
+    std::unique_ptr<GUIFont> result = std::make_unique<GUIFont>(std::move(data));
 
     Texture_MM7 *pallete_texture = pIcons_LOD->loadTexture(pFontPalette);
     if (!pallete_texture) {
@@ -72,9 +75,6 @@ std::unique_ptr<GUIFont> GUIFont::LoadFont(std::string_view pFontFile, std::stri
         result->palette = pallete_texture->palette;
     }
 
-    // Get max char width.
-    result->maxcharwidth = std::ranges::max(result->pData.header.pMetrics | std::views::transform(&GUICharMetric::uWidth));
-
     result->CreateFontTex();
 
     return result;
@@ -262,7 +262,7 @@ std::string GUIFont::GetPageTop(std::string_view pInString, GUIWindow *pWindow,
 
     int text_height = 0;
 
-    std::string text_str = FitTextInAWindow(pInString, pWindow->uFrameWidth, uX);
+    const std::string &text_str = CachedFitTextInAWindow(pInString, pWindow->uFrameWidth, uX);
     int text_length = text_str.length();
     for (int i = 0; i < text_length; ++i) {
         unsigned char c = text_str[i];
@@ -271,7 +271,7 @@ std::string GUIFont::GetPageTop(std::string_view pInString, GUIWindow *pWindow,
             case '\n':  // Line Feed 0A 10
                 text_height += (pData.header.uFontHeight - 3);
                 if (text_height >= (int)(a5 * (pWindow->uFrameHeight - (pData.header.uFontHeight - 3)))) {
-                    return &text_str[i];
+                    return text_str.substr(i);
                 }
                 break;
             case '\f':  // Form Feed, page eject 0C 12
@@ -296,7 +296,7 @@ int GUIFont::CalcTextHeight(std::string_view pString, int width, int uXOffset, b
     }
 
     int uAllHeght = pData.header.uFontHeight - 6;
-    std::string test_string = FitTextInAWindow(pString, width, uXOffset);
+    const std::string &test_string = CachedFitTextInAWindow(pString, width, uXOffset);
     size_t uStringLen = pString.length();
     for (int i = 0; i < uStringLen; ++i) {
         unsigned char c = test_string[i];
@@ -355,6 +355,19 @@ int GUIFont::AlignText_Center(int width, std::string_view pString) {
 }
 
 std::string GUIFont::FitTextInAWindow(std::string_view inString, int width, int uX, bool return_on_carriage) {
+    return CachedFitTextInAWindow(inString, width, uX, return_on_carriage);
+}
+
+const std::string &GUIFont::CachedFitTextInAWindow(std::string_view inString, int width, int uX,
+                                                   bool return_on_carriage) {
+    TextLayoutParams params{width, uX, return_on_carriage};
+    if (const std::string *layout = _layoutCache.find(inString, params))
+        return *layout;
+
+    return _layoutCache.insert(inString, params, UncachedFitTextInAWindow(inString, width, uX, return_on_carriage));
+}
+
+std::string GUIFont::UncachedFitTextInAWindow(std::string_view inString, int width, int uX, bool return_on_carriage) {
     assert(uX < width);
 
     if (inString.empty()) {
@@ -450,12 +463,12 @@ void GUIFont::DrawText(GUIWindow *window, Pointi position, Color color, std::str
         position.x = 12;
     }
 
-    std::string string_begin = std::string(text);
-    if (maxHeight == 0) {
-        string_begin = FitTextInAWindow(text, window->uFrameWidth, position.x);
-    }
-    auto string_end = string_begin;
-    auto string_base = string_begin;
+    // Note that we need a null-terminated string here.
+    std::string unwrappedText;
+    if (maxHeight != 0)
+        unwrappedText = std::string(text);
+    const std::string &string_base =
+        maxHeight == 0 ? CachedFitTextInAWindow(text, window->uFrameWidth, position.x) : unwrappedText;
 
     int out_x = position.x + window->uFrameX;
     int out_y = position.y + window->uFrameY;
@@ -9,6 +9,8 @@
 #include "Library/Image/Palette.h"
 #include "Library/Geometry/Point.h"
 
+#include "GUI/TextLayoutCache.h"
+
 struct GUICharMetric {
     int32_t uLeftSpacing;
     int32_t uWidth;
@@ -33,7 +35,7 @@ class GraphicsImage;
 
 class GUIFont {
  public:
-    GUIFont();
+    explicit GUIFont(FontData data);
     ~GUIFont();
 
     static std::unique_ptr<GUIFont> LoadFont(std::string_view pFontFile, std::string_view pFontPalette);
@@ -72,8 +74,22 @@ class GUIFont {
                        Color color, std::string_view text, int rect_width,
                        int reverse_text);
 
+    /**
+     * Word-wraps the provided text by inserting line feeds. Results are cached, see `TextLayoutCache`.
+     *
+     * @param inString                      Text to wrap.
+     * @param width                         Window width.
+     * @param uX                            Horizontal offset of the text inside the window.
+     * @param return_on_carriage            Whether carriage return tags should be processed.
+     * @return                              Wrapped text.
+     */
     std::string FitTextInAWindow(std::string_view inString, int width, int uX, bool return_on_carriage = false);
 
+    /**
+     * Same as `FitTextInAWindow`, but bypasses the layout cache.
+     */
+    std::string UncachedFitTextInAWindow(std::string_view inString, int width, int uX, bool return_on_carriage = false);
+
     // TODO: these should take std::string_view
     void DrawCreditsEntry(GUIFont *pSecondFont, int uFrameX, int uFrameY,
                           unsigned int w, unsigned int h, Color firstColor,
@@ -87,6 +103,15 @@ class GUIFont {
     GraphicsImage *fontshadow = nullptr;
 
  private:
+    /**
+     * Same as `FitTextInAWindow`, but returns a reference into the layout cache.
+     *
+     * @return                              Wrapped text. The reference stays valid until the next call to this
+     *                                      function.
+     */
+    const std::string &CachedFitTextInAWindow(std::string_view inString, int width, int uX,
+                                              bool return_on_carriage = false);
+
     std::string FitTwoFontStringINWindow(std::string_view inString, GUIFont *pFontSecond,
                                     GUIWindow *pWindow, int startPixlOff,
                                     bool return_on_carriage = false);
@@ -96,6 +121,8 @@ class GUIFont {
  private:
     FontData pData;
     Palette palette;
+
+    TextLayoutCache _layoutCache;
 };
 
 void ReloadFonts();
@@ -0,0 +1,59 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "GUI/GUIFont.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static FontData randomFontData(RandomEngine *rng) {
+    FontData result;
+    result.header.cFirstChar = ' ';
+    result.header.cLastChar = 'z';
+    result.header.uFontHeight = 12;
+    for (GUICharMetric &metric : result.header.pMetrics) {
+        metric.uLeftSpacing = rng->random(2);
+        metric.uWidth = 3 + rng->random(6);
+        metric.uRightSpacing = rng->random(2);
+    }
+    return result;
+}
+
+static std::string randomText(RandomEngine *rng) {
+    static constexpr std::string_view alphabet = "abcdefghijklmnopqrstuvwxyz      \n";
+
+    std::string result;
+    int length = rng->random(200);
+    for (int i = 0; i < length; i++)
+        result += alphabet[rng->random(alphabet.size())];
+    if (rng->random(10) == 0)
+        result += "\r"; // Carriage returns are only processed when asked for.
+    return result;
+}
+
+UNIT_TEST(GUIFont, CachedMatchesUncached) {
+    MersenneTwisterRandomEngine rng;
+    GUIFont font(randomFontData(&rng));
+
+    std::vector<std::string> texts;
+    for (int i = 0; i < 50; i++)
+        texts.push_back(randomText(&rng));
+
+    std::vector<std::pair<int, int>> sizes;
+    for (int i = 0; i < 30; i++) {
+        // Wrapping never terminates if a single glyph doesn't fit, so always leave some room.
+        int width = 60 + rng.random(300);
+        sizes.emplace_back(width, rng.random(width - 20));
+    }
+
+    // 50 texts x 30 sizes x 2 flags is more than the cache can hold, so this also goes through eviction.
+    for (int i = 0; i < 10000; i++) {
+        const std::string &text = texts[rng.random(texts.size())];
+        auto [width, x] = sizes[rng.random(sizes.size())];
+        bool returnOnCarriage = rng.random(2);
+        EXPECT_EQ(font.FitTextInAWindow(text, width, x, returnOnCarriage),
+                  font.UncachedFitTextInAWindow(text, width, x, returnOnCarriage));
+    }
+}
@@ -0,0 +1,61 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "GUI/TextLayoutCache.h"
+
+UNIT_TEST(TextLayoutCache, Hits) {
+    TextLayoutCache cache;
+    TextLayoutParams params{100, 10, false};
+
+    EXPECT_EQ(cache.find("abc", params), nullptr);
+    const std::string &layout = cache.insert("abc", params, "a\nbc");
+    EXPECT_EQ(layout, "a\nbc");
+    EXPECT_EQ(cache.size(), 1);
+
+    const std::string *found = cache.find("abc", params);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found, &layout);
+    EXPECT_EQ(cache.find("abcd", params), nullptr);
+}
+
+UNIT_TEST(TextLayoutCache, DistinctParams) {
+    TextLayoutCache cache;
+
+    // These used to collide when params were packed into a single int64.
+    TextLayoutParams params0{2, -1, false};
+    TextLayoutParams params1{3, 0x7FFFFFFF, false};
+    TextLayoutParams params2{2, -1, true};
+
+    cache.insert("abc", params0, "0");
+    EXPECT_EQ(cache.find("abc", params1), nullptr);
+    EXPECT_EQ(cache.find("abc", params2), nullptr);
+    cache.insert("abc", params1, "1");
+    cache.insert("abc", params2, "2");
+
+    EXPECT_EQ(*cache.find("abc", params0), "0");
+    EXPECT_EQ(*cache.find("abc", params1), "1");
+    EXPECT_EQ(*cache.find("abc", params2), "2");
+    EXPECT_EQ(cache.size(), 3);
+}
+
+UNIT_TEST(TextLayoutCache, Eviction) {
+    TextLayoutCache cache(4);
+
+    for (int i = 0; i < 4; i++)
+        cache.insert(std::to_string(i), TextLayoutParams{100 + i, 0, false}, std::to_string(i));
+    EXPECT_EQ(cache.size(), 4);
+    for (int i = 0; i < 4; i++)
+        EXPECT_NE(cache.find(std::to_string(i), TextLayoutParams{100 + i, 0, false}), nullptr);
+
+    // Overflowing drops everything, including the per-params maps.
+    cache.insert("4", TextLayoutParams{104, 0, false}, "4");
+    EXPECT_EQ(cache.size(), 1);
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(cache.find(std::to_string(i), TextLayoutParams{100 + i, 0, false}), nullptr);
+    EXPECT_EQ(*cache.find("4", TextLayoutParams{104, 0, false}), "4");
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.find("4", TextLayoutParams{104, 0, false}), nullptr);
+}
@@ -0,0 +1,43 @@
+#include "TextLayoutCache.h"
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+size_t TextLayoutCache::ParamsHash::operator()(const TextLayoutParams &params) const {
+    uint64_t packed = (static_cast<uint64_t>(static_cast<uint32_t>(params.width)) << 32) |
+                      static_cast<uint32_t>(params.x);
+    return std::hash<uint64_t>()(packed) ^ static_cast<size_t>(params.returnOnCarriage);
+}
+
+TextLayoutCache::TextLayoutCache(size_t capacity) : _capacity(capacity) {
+    assert(capacity > 0);
+}
+
+const std::string *TextLayoutCache::find(std::string_view text, const TextLayoutParams &params) const {
+    auto layouts = _layouts.find(params);
+    if (layouts == _layouts.end())
+        return nullptr;
+
+    auto pos = layouts->second.find(text);
+    if (pos == layouts->second.end())
+        return nullptr;
+
+    return &pos->second;
+}
+
+const std::string &TextLayoutCache::insert(std::string_view text, const TextLayoutParams &params, std::string layout) {
+    if (_size >= _capacity)
+        clear();
+
+    auto [pos, inserted] = _layouts[params].emplace(text, std::move(layout));
+    assert(inserted);
+    _size++;
+    return pos->second;
+}
+
+void TextLayoutCache::clear() {
+    _layouts.clear();
+    _size = 0;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Utility/String/TransparentFunctors.h"
+
+/**
+ * Parameters of a single `GUIFont::FitTextInAWindow` call, minus the text itself.
+ */
+struct TextLayoutParams {
+    int width = 0;
+    int x = 0;
+    bool returnOnCarriage = false;
+
+    friend bool operator==(const TextLayoutParams &l, const TextLayoutParams &r) = default;
+};
+
+/**
+ * Cache of word-wrapped strings, used by `GUIFont`. UI code lays out the same strings every frame, so this saves us
+ * from re-measuring every glyph & allocating a new string on each call.
+ *
+ * The cache holds at most `capacity()` entries. Inserting into a full cache drops everything - UI rarely has this
+ * many distinct strings on screen, so there's no point in tracking which entries are stale.
+ */
+class TextLayoutCache {
+ public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit TextLayoutCache(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @param text                          Input text.
+     * @param params                        Layout parameters.
+     * @return                              Cached layout, or `nullptr` if there is none. The pointer stays valid
+     *                                      until the next call to `insert` or `clear`.
+     */
+    [[nodiscard]] const std::string *find(std::string_view text, const TextLayoutParams &params) const;
+
+    /**
+     * @param text                          Input text, must not be in the cache already.
+     * @param params                        Layout parameters.
+     * @param layout                        Layout to store.
+     * @return                              Reference to the stored layout. Stays valid until the next call to
+     *                                      `insert` or `clear`.
+     */
+    const std::string &insert(std::string_view text, const TextLayoutParams &params, std::string layout);
+
+    void clear();
+
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return _capacity;
+    }
+
+ private:
+    struct ParamsHash {
+        size_t operator()(const TextLayoutParams &params) const;
+    };
+
+    using LayoutMap =
+        std::unordered_map<TransparentString, std::string, TransparentStringHash, TransparentStringEquals>;
+
+    std::unordered_map<TextLayoutParams, LayoutMap, ParamsHash> _layouts;
+    size_t _size = 0;
+    size_t _capacity = 0;
+};
@@ -149,6 +149,10 @@ GUIWindow_IndoorEntryExit::GUIWindow_IndoorEntryExit(HouseId transitionHouse, un
 
     _mapName = locationName;
 
+    // Player is likely to accept the transition, so we can start loading the destination map right away.
+    if (!locationName.empty() && locationName[0] != '0')
+        engine->preloadMap(pMapStats->GetMapInfo(locationName));
+
     transition_ui_icon = assets->getImage_Solid(pHouse_ExitPictures[exit_pic_id]);
 
     // animation or special transfer message
@@ -10,8 +10,8 @@
 
 namespace zlib {
 
-Blob compress(const Blob &source) {
-    uLongf destLen = source.size();
+Blob compress(const Blob &source, int level) {
+    uLongf destLen = compressBound(source.size());
     std::unique_ptr<void, FreeDeleter> dest;
     int res = Z_BUF_ERROR;
     while (res == Z_BUF_ERROR) {
@@ -20,7 +20,7 @@ Blob compress(const Blob &source) {
             destLen *= 2;
         }
         dest.reset(malloc(destLen));
-        res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+        res = ::compress2(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size(), level);
     }
 
     return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
@@ -42,4 +42,8 @@ Blob uncompress(const Blob &source, size_t sizeHint) {
     return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
 }
 
+uint32_t crc32(const Blob &source) {
+    return ::crc32_z(::crc32(0, Z_NULL, 0), static_cast<const Bytef *>(source.data()), source.size());
+}
+
 };  // namespace zlib
@@ -1,8 +1,21 @@
 #pragma once
 
+#include <cstdint>
+
 #include "Utility/Memory/Blob.h"
 
 namespace zlib {
-Blob compress(const Blob &source);
+/**
+ * @param source                        Data to compress.
+ * @param level                         Compression level, 0-9. Default value of -1 means zlib's default level.
+ * @return                              Compressed data.
+ */
+Blob compress(const Blob &source, int level = -1);
 Blob uncompress(const Blob &source, size_t sizeHint = 0);
+
+/**
+ * @param source                        Data to checksum.
+ * @return                              CRC-32 of the provided data.
+ */
+uint32_t crc32(const Blob &source);
 };  // namespace zlib
@@ -0,0 +1,94 @@
+#include "BBoxArray.h"
+
+#include <bit>
+#include <limits>
+
+#include "Utility/Simd.h"
+
+static constexpr size_t BATCH = 4;
+
+void BBoxArray::clear() {
+    _size = 0;
+    _x1.clear();
+    _x2.clear();
+    _y1.clear();
+    _y2.clear();
+    _z1.clear();
+    _z2.clear();
+}
+
+void BBoxArray::add(const BBoxf &box) {
+    _x1.resize(_size);
+    _x2.resize(_size);
+    _y1.resize(_size);
+    _y2.resize(_size);
+    _z1.resize(_size);
+    _z2.resize(_size);
+
+    _x1.push_back(box.x1);
+    _x2.push_back(box.x2);
+    _y1.push_back(box.y1);
+    _y2.push_back(box.y2);
+    _z1.push_back(box.z1);
+    _z2.push_back(box.z2);
+    _size++;
+
+    size_t paddedSize = (_size + BATCH - 1) / BATCH * BATCH;
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    _x1.resize(paddedSize, nan);
+    _x2.resize(paddedSize, nan);
+    _y1.resize(paddedSize, nan);
+    _y2.resize(paddedSize, nan);
+    _z1.resize(paddedSize, nan);
+    _z2.resize(paddedSize, nan);
+}
+
+void BBoxArray::findIntersecting(const BBoxf &box, std::vector<int> *result) const {
+    result->clear();
+
+    // Same comparisons as in BBoxf::intersects, with this array's boxes on the right. Comparisons with NaNs are
+    // always false, so padding never makes it into the result.
+#if defined(MM_USE_SSE2)
+    __m128 x1 = _mm_set1_ps(box.x1);
+    __m128 x2 = _mm_set1_ps(box.x2);
+    __m128 y1 = _mm_set1_ps(box.y1);
+    __m128 y2 = _mm_set1_ps(box.y2);
+    __m128 z1 = _mm_set1_ps(box.z1);
+    __m128 z2 = _mm_set1_ps(box.z2);
+
+    for (size_t i = 0; i < _x1.size(); i += BATCH) {
+        __m128 x = _mm_and_ps(_mm_cmple_ps(x1, _mm_loadu_ps(&_x2[i])), _mm_cmpge_ps(x2, _mm_loadu_ps(&_x1[i])));
+        __m128 y = _mm_and_ps(_mm_cmple_ps(y1, _mm_loadu_ps(&_y2[i])), _mm_cmpge_ps(y2, _mm_loadu_ps(&_y1[i])));
+        __m128 z = _mm_and_ps(_mm_cmple_ps(z1, _mm_loadu_ps(&_z2[i])), _mm_cmpge_ps(z2, _mm_loadu_ps(&_z1[i])));
+        unsigned mask = _mm_movemask_ps(_mm_and_ps(_mm_and_ps(x, y), z));
+        for (; mask; mask &= mask - 1)
+            result->push_back(i + std::countr_zero(mask));
+    }
+#elif defined(MM_USE_NEON)
+    static constexpr uint32_t BITS[BATCH] = {1, 2, 4, 8};
+    uint32x4_t bits = vld1q_u32(BITS);
+
+    float32x4_t x1 = vdupq_n_f32(box.x1);
+    float32x4_t x2 = vdupq_n_f32(box.x2);
+    float32x4_t y1 = vdupq_n_f32(box.y1);
+    float32x4_t y2 = vdupq_n_f32(box.y2);
+    float32x4_t z1 = vdupq_n_f32(box.z1);
+    float32x4_t z2 = vdupq_n_f32(box.z2);
+
+    for (size_t i = 0; i < _x1.size(); i += BATCH) {
+        uint32x4_t x = vandq_u32(vcleq_f32(x1, vld1q_f32(&_x2[i])), vcgeq_f32(x2, vld1q_f32(&_x1[i])));
+        uint32x4_t y = vandq_u32(vcleq_f32(y1, vld1q_f32(&_y2[i])), vcgeq_f32(y2, vld1q_f32(&_y1[i])));
+        uint32x4_t z = vandq_u32(vcleq_f32(z1, vld1q_f32(&_z2[i])), vcgeq_f32(z2, vld1q_f32(&_z1[i])));
+        uint32_t mask = vaddvq_u32(vandq_u32(vandq_u32(vandq_u32(x, y), z), bits));
+        for (; mask; mask &= mask - 1)
+            result->push_back(i + std::countr_zero(mask));
+    }
+#else
+    for (size_t i = 0; i < _size; i++) {
+        if (box.x1 <= _x2[i] && box.x2 >= _x1[i] &&
+            box.y1 <= _y2[i] && box.y2 >= _y1[i] &&
+            box.z1 <= _z2[i] && box.z2 >= _z1[i])
+            result->push_back(i);
+    }
+#endif
+}
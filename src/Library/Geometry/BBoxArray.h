@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "BBox.h"
+
+/**
+ * Array of float bounding boxes stored in a structure-of-arrays layout, so that a single box can be tested against
+ * all of them four at a time with SSE2 / NEON.
+ *
+ * Results are exactly the same as the ones returned by `BBoxf::intersects`.
+ */
+class BBoxArray {
+ public:
+    void clear();
+
+    void add(const BBoxf &box);
+
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    /**
+     * @param box                       Bounding box to test against all the boxes in this array.
+     * @param[out] result               Indices of the boxes that intersect `box`, in increasing order. Cleared
+     *                                  before being filled.
+     */
+    void findIntersecting(const BBoxf &box, std::vector<int> *result) const;
+
+ private:
+    // Padded to a multiple of 4 with NaNs, which never intersect anything.
+    size_t _size = 0;
+    std::vector<float> _x1;
+    std::vector<float> _x2;
+    std::vector<float> _y1;
+    std::vector<float> _y2;
+    std::vector<float> _z1;
+    std::vector<float> _z2;
+};
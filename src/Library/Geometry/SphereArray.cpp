@@ -0,0 +1,99 @@
+#include "SphereArray.h"
+
+#include <bit>
+
+#include "Utility/Simd.h"
+
+static constexpr size_t BATCH = 4;
+
+void SphereArray::clear() {
+    _size = 0;
+    _x.clear();
+    _y.clear();
+    _z.clear();
+    _radius.clear();
+}
+
+void SphereArray::add(const Vec3f &center, float radius) {
+    _x.resize(_size);
+    _y.resize(_size);
+    _z.resize(_size);
+    _radius.resize(_size);
+
+    _x.push_back(center.x);
+    _y.push_back(center.y);
+    _z.push_back(center.z);
+    _radius.push_back(radius);
+    _size++;
+
+    size_t paddedSize = (_size + BATCH - 1) / BATCH * BATCH;
+    _x.resize(paddedSize);
+    _y.resize(paddedSize);
+    _z.resize(paddedSize);
+    _radius.resize(paddedSize);
+}
+
+void SphereArray::findInFrustum(std::span<const Planef> frustum, std::vector<int> *result) const {
+    result->clear();
+
+    // A sphere is culled if (dot(center, normal) - planeDist) < -radius for any of the planes, where planeDist is
+    // -plane.dist. This is the exact expression that IsSphereInFrustum uses, so that the results match bit for bit.
+#if defined(MM_USE_SSE2)
+    __m128 signMask = _mm_set1_ps(-0.0f);
+
+    for (size_t i = 0; i < _x.size(); i += BATCH) {
+        __m128 x = _mm_loadu_ps(&_x[i]);
+        __m128 y = _mm_loadu_ps(&_y[i]);
+        __m128 z = _mm_loadu_ps(&_z[i]);
+        __m128 negRadius = _mm_xor_ps(_mm_loadu_ps(&_radius[i]), signMask);
+
+        __m128 culled = _mm_setzero_ps();
+        for (const Planef &plane : frustum) {
+            __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.normal.x)), _mm_mul_ps(y, _mm_set1_ps(plane.normal.y))),
+                                    _mm_mul_ps(z, _mm_set1_ps(plane.normal.z)));
+            __m128 distance = _mm_sub_ps(dot, _mm_set1_ps(-plane.dist));
+            culled = _mm_or_ps(culled, _mm_cmplt_ps(distance, negRadius));
+        }
+
+        unsigned mask = ~_mm_movemask_ps(culled) & 0xF;
+        if (i + BATCH > _size)
+            mask &= (1u << (_size - i)) - 1;
+        for (; mask; mask &= mask - 1)
+            result->push_back(i + std::countr_zero(mask));
+    }
+#elif defined(MM_USE_NEON)
+    static constexpr uint32_t BITS[BATCH] = {1, 2, 4, 8};
+    uint32x4_t bits = vld1q_u32(BITS);
+
+    for (size_t i = 0; i < _x.size(); i += BATCH) {
+        float32x4_t x = vld1q_f32(&_x[i]);
+        float32x4_t y = vld1q_f32(&_y[i]);
+        float32x4_t z = vld1q_f32(&_z[i]);
+        float32x4_t negRadius = vnegq_f32(vld1q_f32(&_radius[i]));
+
+        uint32x4_t culled = vdupq_n_u32(0);
+        for (const Planef &plane : frustum) {
+            float32x4_t dot = vaddq_f32(vaddq_f32(vmulq_n_f32(x, plane.normal.x), vmulq_n_f32(y, plane.normal.y)),
+                                        vmulq_n_f32(z, plane.normal.z));
+            float32x4_t distance = vsubq_f32(dot, vdupq_n_f32(-plane.dist));
+            culled = vorrq_u32(culled, vcltq_f32(distance, negRadius));
+        }
+
+        uint32_t mask = vaddvq_u32(vbicq_u32(bits, culled));
+        if (i + BATCH > _size)
+            mask &= (1u << (_size - i)) - 1;
+        for (; mask; mask &= mask - 1)
+            result->push_back(i + std::countr_zero(mask));
+    }
+#else
+    for (size_t i = 0; i < _size; i++) {
+        bool culled = false;
+        for (const Planef &plane : frustum) {
+            float dot = _x[i] * plane.normal.x + _y[i] * plane.normal.y + _z[i] * plane.normal.z;
+            culled |= (dot - (-plane.dist)) < -_radius[i];
+        }
+        if (!culled)
+            result->push_back(i);
+    }
+#endif
+}
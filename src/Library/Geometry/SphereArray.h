@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Plane.h"
+#include "Vec.h"
+
+/**
+ * Array of bounding spheres stored in a structure-of-arrays layout, so that frustum culling can process four spheres
+ * at a time with SSE2 / NEON.
+ */
+class SphereArray {
+ public:
+    void clear();
+
+    void add(const Vec3f &center, float radius);
+
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    /**
+     * A sphere is considered to be inside the frustum if it's not entirely behind any of the frustum planes, that
+     * is, if `plane.signedDistanceTo(center) >= -radius` for all of them. Distances are calculated exactly the same
+     * way as in `IsSphereInFrustum`, so the results are identical.
+     *
+     * @param frustum                   Frustum planes, with normals pointing inside the frustum.
+     * @param[out] result               Indices of the spheres that are inside the frustum, in increasing order.
+     *                                  Cleared before being filled.
+     */
+    void findInFrustum(std::span<const Planef> frustum, std::vector<int> *result) const;
+
+ private:
+    // Padded to a multiple of 4 with zeros, padding is masked out in `findInFrustum`.
+    size_t _size = 0;
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+    std::vector<float> _radius;
+};
@@ -0,0 +1,97 @@
+#include <vector>
+
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/BBoxArray.h"
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static BBoxf randomBox(RandomEngine *rng, int range, int maxSize) {
+    Vec3f a(rng->randomInSegment(-range, range), rng->randomInSegment(-range, range), rng->randomInSegment(-range, range));
+    Vec3f size(rng->random(maxSize + 1), rng->random(maxSize + 1), rng->random(maxSize + 1));
+    return BBoxf::forPoints(a, a + size);
+}
+
+static std::vector<int> referenceFindIntersecting(const std::vector<BBoxf> &boxes, const BBoxf &box) {
+    std::vector<int> result;
+    for (size_t i = 0; i < boxes.size(); i++)
+        if (box.intersects(boxes[i]))
+            result.push_back(i);
+    return result;
+}
+
+UNIT_TEST(BBoxArray, Empty) {
+    BBoxArray array;
+    std::vector<int> result = {1, 2, 3};
+    array.findIntersecting(BBoxf::cubic(Vec3f(0, 0, 0), 100), &result);
+    EXPECT_TRUE(result.empty());
+}
+
+UNIT_TEST(BBoxArray, Touching) {
+    BBoxArray array;
+    array.add(BBoxf::cubic(Vec3f(0, 0, 0), 1));
+    array.add(BBoxf::cubic(Vec3f(2, 0, 0), 1)); // Touches the query box.
+    array.add(BBoxf::cubic(Vec3f(3, 0, 0), 0.5f)); // Doesn't.
+    array.add(BBoxf::cubic(Vec3f(0, 0, 5), 1));
+    array.add(BBoxf::cubic(Vec3f(0, 0, -1), 0)); // Degenerate, but on the border.
+
+    std::vector<int> result;
+    array.findIntersecting(BBoxf::cubic(Vec3f(0, 0, 0), 1), &result);
+    EXPECT_EQ(result, std::vector<int>({0, 1, 4}));
+}
+
+UNIT_TEST(BBoxArray, MatchesBBox) {
+    MersenneTwisterRandomEngine rng;
+
+    for (int size : {1, 3, 4, 5, 17, 64, 1000}) {
+        std::vector<BBoxf> boxes;
+        BBoxArray array;
+        for (int i = 0; i < size; i++) {
+            boxes.push_back(randomBox(&rng, 1000, 200));
+            array.add(boxes.back());
+        }
+        EXPECT_EQ(array.size(), size);
+
+        std::vector<int> result;
+        for (int i = 0; i < 200; i++) {
+            BBoxf box = randomBox(&rng, 1000, 500);
+            array.findIntersecting(box, &result);
+            EXPECT_EQ(result, referenceFindIntersecting(boxes, box));
+        }
+    }
+}
+
+UNIT_BENCHMARK(BBoxArray, Benchmark) {
+    // One ray bbox against all the faces of a large model, that's what the outdoor collision code does.
+    MersenneTwisterRandomEngine rng;
+    std::vector<BBoxf> boxes;
+    BBoxArray array;
+    for (int i = 0; i < 1000; i++) {
+        boxes.push_back(randomBox(&rng, 10000, 1000));
+        array.add(boxes.back());
+    }
+
+    std::vector<BBoxf> queries;
+    for (int i = 0; i < 1000; i++)
+        queries.push_back(randomBox(&rng, 10000, 1000));
+
+    std::vector<int> result;
+    size_t batchHits = 0;
+    double batchNs = benchmarkNsPerItem(queries.size() * boxes.size(), 1, [&] {
+        for (const BBoxf &query : queries) {
+            array.findIntersecting(query, &result);
+            batchHits += result.size();
+        }
+    });
+
+    size_t scalarHits = 0;
+    double scalarNs = benchmarkNsPerItem(queries.size() * boxes.size(), 1, [&] {
+        for (const BBoxf &query : queries)
+            for (const BBoxf &box : boxes)
+                scalarHits += query.intersects(box);
+    });
+
+    EXPECT_EQ(batchHits, scalarHits);
+    reportBenchmark("BBoxArray::findIntersecting", batchNs, "box");
+    reportBenchmark("BBoxf::intersects", scalarNs, "box");
+}
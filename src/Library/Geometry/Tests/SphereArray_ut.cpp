@@ -0,0 +1,121 @@
+#include <array>
+#include <span>
+#include <vector>
+
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/SphereArray.h"
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+struct Sphere {
+    Vec3f center;
+    float radius;
+};
+
+// Same check as in IsSphereInFrustum.
+static bool referenceIsInFrustum(const Sphere &sphere, std::span<const Planef> frustum) {
+    for (const Planef &plane : frustum) {
+        float planedist = -plane.dist;
+        if ((dot(sphere.center, plane.normal) - planedist) < -sphere.radius)
+            return false;
+    }
+    return true;
+}
+
+static std::array<Planef, 4> randomFrustum(RandomEngine *rng) {
+    std::array<Planef, 4> result;
+    for (Planef &plane : result) {
+        plane.normal = Vec3f(rng->randomFloat() - 0.5f, rng->randomFloat() - 0.5f, rng->randomFloat() - 0.5f);
+        plane.normal.normalize();
+        plane.dist = rng->randomInSegment(-5000, 5000) + rng->randomFloat();
+    }
+    return result;
+}
+
+UNIT_TEST(SphereArray, Simple) {
+    // Box frustum [-10, 10] x [-10, 10], unbounded in z.
+    std::array<Planef, 4> frustum = {{
+        {Vec3f(1, 0, 0), 10},
+        {Vec3f(-1, 0, 0), 10},
+        {Vec3f(0, 1, 0), 10},
+        {Vec3f(0, -1, 0), 10}
+    }};
+
+    SphereArray array;
+    array.add(Vec3f(0, 0, 0), 1);
+    array.add(Vec3f(20, 0, 0), 5); // Outside.
+    array.add(Vec3f(20, 0, 0), 10); // Touches the frustum.
+    array.add(Vec3f(0, 0, 1000), 1);
+    array.add(Vec3f(0, -15, 0), 4.5f); // Outside.
+
+    std::vector<int> result;
+    array.findInFrustum(frustum, &result);
+    EXPECT_EQ(result, std::vector<int>({0, 2, 3}));
+
+    array.clear();
+    array.findInFrustum(frustum, &result);
+    EXPECT_TRUE(result.empty());
+}
+
+UNIT_TEST(SphereArray, MatchesReference) {
+    MersenneTwisterRandomEngine rng;
+
+    for (int size : {1, 3, 4, 5, 17, 100}) {
+        std::vector<Sphere> spheres;
+        SphereArray array;
+        for (int i = 0; i < size; i++) {
+            Vec3f center(rng.randomInSegment(-10000, 10000), rng.randomInSegment(-10000, 10000), rng.randomInSegment(-2000, 2000));
+            spheres.push_back({center, static_cast<float>(rng.randomInSegment(0, 2000))});
+            array.add(spheres.back().center, spheres.back().radius);
+        }
+
+        std::vector<int> result;
+        for (int i = 0; i < 200; i++) {
+            std::array<Planef, 4> frustum = randomFrustum(&rng);
+
+            std::vector<int> expected;
+            for (size_t j = 0; j < spheres.size(); j++)
+                if (referenceIsInFrustum(spheres[j], frustum))
+                    expected.push_back(j);
+
+            array.findInFrustum(frustum, &result);
+            EXPECT_EQ(result, expected);
+        }
+    }
+}
+
+UNIT_BENCHMARK(SphereArray, Benchmark) {
+    MersenneTwisterRandomEngine rng;
+    std::vector<Sphere> spheres;
+    SphereArray array;
+    for (int i = 0; i < 1000; i++) {
+        Vec3f center(rng.randomInSegment(-10000, 10000), rng.randomInSegment(-10000, 10000), rng.randomInSegment(-2000, 2000));
+        spheres.push_back({center, static_cast<float>(rng.randomInSegment(0, 2000))});
+        array.add(spheres.back().center, spheres.back().radius);
+    }
+
+    std::vector<std::array<Planef, 4>> frustums;
+    for (int i = 0; i < 1000; i++)
+        frustums.push_back(randomFrustum(&rng));
+
+    std::vector<int> result;
+    size_t batchHits = 0;
+    double batchNs = benchmarkNsPerItem(frustums.size() * spheres.size(), 1, [&] {
+        for (const std::array<Planef, 4> &frustum : frustums) {
+            array.findInFrustum(frustum, &result);
+            batchHits += result.size();
+        }
+    });
+
+    size_t scalarHits = 0;
+    double scalarNs = benchmarkNsPerItem(frustums.size() * spheres.size(), 1, [&] {
+        for (const std::array<Planef, 4> &frustum : frustums)
+            for (const Sphere &sphere : spheres)
+                scalarHits += referenceIsInFrustum(sphere, frustum);
+    });
+
+    EXPECT_EQ(batchHits, scalarHits);
+    reportBenchmark("SphereArray::findInFrustum", batchNs, "sphere");
+    reportBenchmark("IsSphereInFrustum", scalarNs, "sphere");
+}
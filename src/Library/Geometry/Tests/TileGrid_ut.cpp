@@ -0,0 +1,124 @@
+#include <limits>
+#include <vector>
+
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/TileGrid.h"
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+struct TestBox {
+    float x1;
+    float y1;
+    float x2;
+    float y2;
+};
+
+static TestBox randomBox(RandomEngine *rng, int range, int maxSize) {
+    float x = rng->randomInSegment(-range, range);
+    float y = rng->randomInSegment(-range, range);
+    return {x, y, x + rng->random(maxSize + 1), y + rng->random(maxSize + 1)};
+}
+
+static std::vector<int> referenceFindContaining(const std::vector<TestBox> &boxes, float x, float y) {
+    std::vector<int> result;
+    for (size_t i = 0; i < boxes.size(); i++)
+        if (boxes[i].x1 <= x && x <= boxes[i].x2 && boxes[i].y1 <= y && y <= boxes[i].y2)
+            result.push_back(i);
+    return result;
+}
+
+UNIT_TEST(TileGrid, Empty) {
+    TileGrid grid;
+    std::vector<int> result = {1, 2, 3};
+    grid.findContaining(0, 0, &result);
+    EXPECT_TRUE(result.empty());
+
+    grid.reset(Recti(0, 0, 100, 100), 16);
+    grid.findContaining(50, 50, &result);
+    EXPECT_TRUE(result.empty());
+}
+
+UNIT_TEST(TileGrid, Borders) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+
+    TileGrid grid;
+    grid.reset(Recti(0, 0, 100, 100), 16);
+    grid.add(0, 10, 10, 20, 20);
+    grid.add(1, 20, 20, 40, 40); // Touches box 0.
+    grid.add(2, -inf, -inf, inf, inf); // Covers everything.
+    grid.add(3, nan, 0, 10, 10); // Dropped.
+    grid.add(4, 500, 500, 600, 600); // Outside the grid area.
+    grid.add(5, 30, 30, 10, 10); // Empty, dropped.
+    EXPECT_EQ(grid.size(), 4);
+
+    std::vector<int> result;
+    grid.findContaining(20, 20, &result);
+    EXPECT_EQ(result, std::vector<int>({0, 1, 2}));
+    grid.findContaining(550, 550, &result);
+    EXPECT_EQ(result, std::vector<int>({2, 4}));
+    grid.findContaining(-1000, 5, &result);
+    EXPECT_EQ(result, std::vector<int>({2}));
+    grid.findContaining(nan, 5, &result);
+    EXPECT_TRUE(result.empty());
+}
+
+UNIT_TEST(TileGrid, MatchesReference) {
+    MersenneTwisterRandomEngine rng;
+
+    for (int size : {1, 5, 64, 1000}) {
+        std::vector<TestBox> boxes;
+        TileGrid grid;
+        grid.reset(Recti(0, 0, 640, 480), 32);
+        for (int i = 0; i < size; i++) {
+            boxes.push_back(randomBox(&rng, 800, 200));
+            grid.add(i, boxes.back().x1, boxes.back().y1, boxes.back().x2, boxes.back().y2);
+        }
+        EXPECT_EQ(grid.size(), size);
+
+        std::vector<int> result;
+        for (int i = 0; i < 500; i++) {
+            float x = rng.randomInSegment(-1000, 1000);
+            float y = rng.randomInSegment(-1000, 1000);
+            grid.findContaining(x, y, &result);
+            EXPECT_EQ(result, referenceFindContaining(boxes, x, y));
+        }
+    }
+}
+
+UNIT_BENCHMARK(TileGrid, Benchmark) {
+    // Faces & billboards of a busy indoor frame, looked up at the mouse position.
+    MersenneTwisterRandomEngine rng;
+    std::vector<TestBox> boxes;
+    TileGrid grid;
+    grid.reset(Recti(0, 0, 640, 480), 32);
+    for (int i = 0; i < 3000; i++) {
+        boxes.push_back(randomBox(&rng, 640, 100));
+        grid.add(i, boxes.back().x1, boxes.back().y1, boxes.back().x2, boxes.back().y2);
+    }
+
+    std::vector<std::pair<float, float>> queries;
+    for (int i = 0; i < 10000; i++)
+        queries.emplace_back(rng.random(640), rng.random(480));
+
+    std::vector<int> result;
+    size_t gridHits = 0;
+    double gridNs = benchmarkNsPerItem(queries.size(), 1, [&] {
+        for (auto [x, y] : queries) {
+            grid.findContaining(x, y, &result);
+            gridHits += result.size();
+        }
+    });
+
+    size_t scalarHits = 0;
+    double scalarNs = benchmarkNsPerItem(queries.size(), 1, [&] {
+        for (auto [x, y] : queries)
+            for (const TestBox &box : boxes)
+                scalarHits += box.x1 <= x && x <= box.x2 && box.y1 <= y && y <= box.y2;
+    });
+
+    EXPECT_EQ(gridHits, scalarHits);
+    reportBenchmark("TileGrid::findContaining", gridNs, "query");
+    reportBenchmark("TileGrid, linear scan", scalarNs, "query");
+}
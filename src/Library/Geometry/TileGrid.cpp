@@ -0,0 +1,55 @@
+#include "TileGrid.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+void TileGrid::reset(const Recti &area, int tileSize) {
+    assert(tileSize > 0);
+
+    _area = area;
+    _tileSize = tileSize;
+    _columns = std::max(1, (area.w + tileSize - 1) / tileSize);
+    _rows = std::max(1, (area.h + tileSize - 1) / tileSize);
+    _size = 0;
+
+    _tiles.resize(static_cast<size_t>(_columns) * _rows);
+    for (std::vector<Entry> &tile : _tiles)
+        tile.clear();
+}
+
+void TileGrid::add(int id, float x1, float y1, float x2, float y2) {
+    assert(!_tiles.empty());
+
+    // Also filters out NaNs.
+    if (!(x1 <= x2 && y1 <= y2))
+        return;
+
+    int tx1 = tileX(x1);
+    int tx2 = tileX(x2);
+    int ty1 = tileY(y1);
+    int ty2 = tileY(y2);
+    for (int ty = ty1; ty <= ty2; ty++)
+        for (int tx = tx1; tx <= tx2; tx++)
+            _tiles[ty * _columns + tx].push_back({id, x1, y1, x2, y2});
+    _size++;
+}
+
+void TileGrid::findContaining(float x, float y, std::vector<int> *result) const {
+    result->clear();
+    if (_tiles.empty() || std::isnan(x) || std::isnan(y))
+        return;
+
+    for (const Entry &entry : _tiles[tileY(y) * _columns + tileX(x)])
+        if (entry.x1 <= x && x <= entry.x2 && entry.y1 <= y && y <= entry.y2)
+            result->push_back(entry.id);
+}
+
+int TileGrid::tileX(float x) const {
+    // Clamping in float space first so that huge & infinite coordinates don't overflow the int conversion.
+    return static_cast<int>(std::clamp(std::floor((x - _area.x) / _tileSize), 0.0f, _columns - 1.0f));
+}
+
+int TileGrid::tileY(float y) const {
+    return static_cast<int>(std::clamp(std::floor((y - _area.y) / _tileSize), 0.0f, _rows - 1.0f));
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Rect.h"
+
+/**
+ * Uniform 2D grid of square tiles that bins axis-aligned boxes, so that the boxes containing a point can be found by
+ * looking at a single tile instead of testing all of them.
+ *
+ * Boxes and points that fall outside the grid area are clamped to the border tiles, so the results don't depend on
+ * the grid area, only the performance does. Unbounded boxes (e.g. with infinite coordinates) end up in all tiles.
+ */
+class TileGrid {
+ public:
+    /**
+     * Clears the grid & sets up the tiles, keeping the allocated storage.
+     *
+     * @param area                      Area covered by the grid.
+     * @param tileSize                  Tile size, must be positive.
+     */
+    void reset(const Recti &area, int tileSize);
+
+    /**
+     * @param id                        Id of the box to add. Ids are returned in the order they were added.
+     * @param x1                        Left border of the box, inclusive.
+     * @param y1                        Top border of the box, inclusive.
+     * @param x2                        Right border of the box, inclusive.
+     * @param y2                        Bottom border of the box, inclusive.
+     */
+    void add(int id, float x1, float y1, float x2, float y2);
+
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _size == 0;
+    }
+
+    /**
+     * @param x                         X coordinate of the point to look up.
+     * @param y                         Y coordinate of the point to look up.
+     * @param[out] result               Ids of the boxes that contain the provided point, in the order they were
+     *                                  added. Cleared before being filled.
+     */
+    void findContaining(float x, float y, std::vector<int> *result) const;
+
+ private:
+    struct Entry {
+        int id;
+        float x1;
+        float y1;
+        float x2;
+        float y2;
+    };
+
+    int tileX(float x) const;
+    int tileY(float y) const;
+
+ private:
+    Recti _area;
+    int _tileSize = 1;
+    int _columns = 0;
+    int _rows = 0;
+    size_t _size = 0;
+    std::vector<std::vector<Entry>> _tiles;
+};
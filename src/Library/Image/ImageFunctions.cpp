@@ -1,19 +1,18 @@
 #include "ImageFunctions.h"
 
 #include <cassert>
+#include <cstring>
+
+#include "Utility/Simd.h"
+
+static constexpr size_t BATCH = 16;
 
 RgbaImage makeRgbaImage(GrayscaleImageView indexedImage, const Palette &palette) {
     if (!indexedImage)
         return RgbaImage();
 
     RgbaImage result = RgbaImage::uninitialized(indexedImage.width(), indexedImage.height());
-    auto srcPixels = indexedImage.pixels();
-    auto dstPixels = result.pixels();
-    assert(srcPixels.size() == dstPixels.size());
-
-    for (size_t i = 0, size = srcPixels.size(); i < size; i++)
-        dstPixels[i] = palette.colors[srcPixels[i]];
-
+    expandPalette(indexedImage.pixels(), palette, result.pixels());
     return result;
 }
 
@@ -26,3 +25,95 @@ RgbaImage flipVertically(RgbaImageView image) {
         memcpy(result[h - y - 1].data(), image[y].data(), image[y].size_bytes());
     return result;
 }
+
+void expandPalette(std::span<const uint8_t> indices, const Palette &palette, std::span<Color> dst) {
+    assert(indices.size() == dst.size());
+
+    const uint8_t *src = indices.data();
+    Color *out = dst.data();
+    size_t size = indices.size();
+    size_t i = 0;
+
+#if defined(MM_USE_NEON)
+    // Table lookups in NEON are limited to 64-byte tables, so the palette is split into channel planes, and each
+    // plane into four 64-entry chunks. Out-of-range indices leave the accumulator untouched in vqtbx4q_u8, so
+    // chaining the lookups with shifted indices covers the whole 256-entry range. Setting up the tables costs about
+    // as much as converting a few hundred pixels, so this is only done for larger images.
+    if (size >= 1024) {
+        alignas(16) uint8_t planes[4][256];
+        for (size_t j = 0; j < 256; j++) {
+            planes[0][j] = palette.colors[j].r;
+            planes[1][j] = palette.colors[j].g;
+            planes[2][j] = palette.colors[j].b;
+            planes[3][j] = palette.colors[j].a;
+        }
+
+        uint8x16x4_t tables[4][4];
+        for (size_t c = 0; c < 4; c++) {
+            for (size_t k = 0; k < 4; k++) {
+                const uint8_t *chunk = &planes[c][k * 64];
+                tables[c][k] = {{vld1q_u8(chunk), vld1q_u8(chunk + 16), vld1q_u8(chunk + 32), vld1q_u8(chunk + 48)}};
+            }
+        }
+
+        uint8x16_t offset64 = vdupq_n_u8(64);
+        for (; i + BATCH <= size; i += BATCH) {
+            uint8x16_t index0 = vld1q_u8(src + i);
+            uint8x16_t index1 = vsubq_u8(index0, offset64);
+            uint8x16_t index2 = vsubq_u8(index1, offset64);
+            uint8x16_t index3 = vsubq_u8(index2, offset64);
+
+            uint8x16x4_t pixels;
+            for (size_t c = 0; c < 4; c++) {
+                uint8x16_t channel = vqtbl4q_u8(tables[c][0], index0);
+                channel = vqtbx4q_u8(channel, tables[c][1], index1);
+                channel = vqtbx4q_u8(channel, tables[c][2], index2);
+                pixels.val[c] = vqtbx4q_u8(channel, tables[c][3], index3);
+            }
+            vst4q_u8(reinterpret_cast<uint8_t *>(out + i), pixels);
+        }
+    }
+#endif
+
+    // There is no gather in SSE2, and emulating it with shuffles is slower than just doing the lookups one by one.
+    for (; i < size; i++)
+        out[i] = palette.colors[src[i]];
+}
+
+void interleaveRgbPlanes(std::span<const uint8_t> r, std::span<const uint8_t> g, std::span<const uint8_t> b,
+                         std::span<Color> dst) {
+    assert(r.size() >= dst.size() && g.size() >= dst.size() && b.size() >= dst.size());
+
+    Color *out = dst.data();
+    size_t size = dst.size();
+    size_t i = 0;
+
+#if defined(MM_USE_SSE2)
+    __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+    for (; i + BATCH <= size; i += BATCH) {
+        __m128i rr = _mm_loadu_si128(reinterpret_cast<const __m128i *>(r.data() + i));
+        __m128i gg = _mm_loadu_si128(reinterpret_cast<const __m128i *>(g.data() + i));
+        __m128i bb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b.data() + i));
+
+        __m128i rgLo = _mm_unpacklo_epi8(rr, gg);
+        __m128i rgHi = _mm_unpackhi_epi8(rr, gg);
+        __m128i baLo = _mm_unpacklo_epi8(bb, alpha);
+        __m128i baHi = _mm_unpackhi_epi8(bb, alpha);
+
+        __m128i *target = reinterpret_cast<__m128i *>(out + i);
+        _mm_storeu_si128(target + 0, _mm_unpacklo_epi16(rgLo, baLo));
+        _mm_storeu_si128(target + 1, _mm_unpackhi_epi16(rgLo, baLo));
+        _mm_storeu_si128(target + 2, _mm_unpacklo_epi16(rgHi, baHi));
+        _mm_storeu_si128(target + 3, _mm_unpackhi_epi16(rgHi, baHi));
+    }
+#elif defined(MM_USE_NEON)
+    uint8x16_t alpha = vdupq_n_u8(0xFF);
+    for (; i + BATCH <= size; i += BATCH) {
+        uint8x16x4_t pixels = {{vld1q_u8(r.data() + i), vld1q_u8(g.data() + i), vld1q_u8(b.data() + i), alpha}};
+        vst4q_u8(reinterpret_cast<uint8_t *>(out + i), pixels);
+    }
+#endif
+
+    for (; i < size; i++)
+        out[i] = Color(r[i], g[i], b[i]);
+}
@@ -1,8 +1,31 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include "Image.h"
 #include "Palette.h"
 
 RgbaImage makeRgbaImage(GrayscaleImageView indexedImage, const Palette &palette);
 
 RgbaImage flipVertically(RgbaImageView image);
+
+/**
+ * Converts indexed pixels into RGBA by looking them up in the provided palette.
+ *
+ * @param indices                       Indexed pixels.
+ * @param palette                       Palette to use.
+ * @param[out] dst                      Output pixels, must be the same size as `indices`.
+ */
+void expandPalette(std::span<const uint8_t> indices, const Palette &palette, std::span<Color> dst);
+
+/**
+ * Interleaves separate 8-bit color planes into RGBA pixels. Alpha is set to 255.
+ *
+ * @param r                             Red plane.
+ * @param g                             Green plane.
+ * @param b                             Blue plane.
+ * @param[out] dst                      Output pixels, all planes must be at least as large as this span.
+ */
+void interleaveRgbPlanes(std::span<const uint8_t> r, std::span<const uint8_t> g, std::span<const uint8_t> b,
+                         std::span<Color> dst);
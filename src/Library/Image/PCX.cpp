@@ -7,6 +7,9 @@
 #include <memory>
 
 #include "Utility/Exception.h"
+#include "Utility/Simd.h"
+
+#include "ImageFunctions.h"
 
 enum {
     PCX_VERSION_2_5 = 0,
@@ -53,17 +56,6 @@ static inline int bs_get_bytes_left(bstreamer *bs) {
     return bs->buffer_end - bs->buffer;
 }
 
-static inline unsigned int bs_get_byte(bstreamer *bs) {
-    unsigned int byte;
-    if (bs_get_bytes_left(bs) > 0) {
-        byte = bs->buffer[0];
-        bs->buffer++;
-        return byte;
-    }
-
-    return 0;
-}
-
 static inline unsigned int bs_get_buffer(bstreamer *bs, uint8_t *dst, unsigned int size) {
     int size_min = std::min((unsigned int)(bs->buffer_end - bs->buffer), size);
     memcpy(dst, bs->buffer, size_min);
@@ -71,27 +63,63 @@ static inline unsigned int bs_get_buffer(bstreamer *bs, uint8_t *dst, unsigned i
     return size_min;
 }
 
-static int pcx_rle_decode(bstreamer *bs, uint8_t *dst, unsigned int bytes_per_scanline, int compressed) {
-    unsigned int i = 0;
-    unsigned char run, value;
+/**
+ * @return                              Number of bytes at the start of `[src, end)` that are not RLE run markers.
+ */
+static size_t pcx_literal_span(const uint8_t *src, const uint8_t *end) {
+    const uint8_t *pos = src;
+
+    // Skip 16-byte blocks without run markers, the exact position of the marker is then found in the scalar loop.
+#if defined(MM_USE_SSE2)
+    __m128i markerMask = _mm_set1_epi8(static_cast<char>(0xc0));
+    for (; end - pos >= 16; pos += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, markerMask), markerMask)))
+            break;
+    }
+#elif defined(MM_USE_NEON)
+    uint8x16_t markerMask = vdupq_n_u8(0xc0);
+    for (; end - pos >= 16; pos += 16)
+        if (vmaxvq_u8(vceqq_u8(vandq_u8(vld1q_u8(pos), markerMask), markerMask)))
+            break;
+#endif
+
+    while (pos < end && *pos < 0xc0)
+        pos++;
+    return pos - src;
+}
 
+static int pcx_rle_decode(bstreamer *bs, uint8_t *dst, unsigned int bytes_per_scanline, int compressed) {
     if (bs_get_bytes_left(bs) < 1)
         return -1;
 
-    if (compressed) {
-        while (i < bytes_per_scanline && bs_get_bytes_left(bs) > 0) {
-            run = 1;
-            value = bs_get_byte(bs);
-            if (value >= 0xc0 && bs_get_bytes_left(bs) > 0) {
-                run = value & 0x3f;
-                value = bs_get_byte(bs);
-            }
-            while (i < bytes_per_scanline && run--)
-                dst[i++] = value;
-        }
-    } else {
+    if (!compressed) {
         bs_get_buffer(bs, dst, bytes_per_scanline);
+        return 0;
+    }
+
+    // Runs are expanded with memset, and spans of literal bytes are found with SIMD & copied with a single memcpy, so
+    // that we're not going byte by byte for either.
+    const uint8_t *src = bs->buffer;
+    const uint8_t *end = bs->buffer_end;
+    unsigned int i = 0;
+    while (i < bytes_per_scanline && src < end) {
+        uint8_t value = *src++;
+        if (value >= 0xc0 && src < end) {
+            unsigned int run = std::min(static_cast<unsigned int>(value & 0x3f), bytes_per_scanline - i);
+            memset(dst + i, *src++, run);
+            i += run;
+        } else {
+            // Note that a trailing run marker byte is a literal.
+            dst[i++] = value;
+
+            size_t literals = pcx_literal_span(src, src + std::min<size_t>(bytes_per_scanline - i, end - src));
+            memcpy(dst + i, src, literals);
+            src += literals;
+            i += literals;
+        }
     }
+    bs->buffer = src;
     return 0;
 }
 
@@ -105,7 +133,6 @@ RgbaImage pcx::decode(const Blob &data) {
     if (header->manufacturer != 0x0a)
         throw Exception("Invalid PCX starting byte, expected {:02x}, got {:02x}", 0x0a, header->manufacturer);
 
-
     if (header->version < PCX_VERSION_2_5 || header->version == PCX_VERSION_NOT_VALID || header->version > PCX_VERSION_3_0)
         throw Exception("Invalid PCX version: {}", header->version);
 
@@ -134,9 +161,9 @@ RgbaImage pcx::decode(const Blob &data) {
         if (ret < 0)
             throw Exception("PCX image data is corrupted");
 
-        auto line = result[y];
-        for (unsigned int x = 0; x < width; x++)
-            line[x] = Color(scanline[x], scanline[x + header->bytes_per_row], scanline[x + (header->bytes_per_row << 1)]);
+        const uint8_t *planes = scanline.get();
+        interleaveRgbPlanes({planes, width}, {planes + header->bytes_per_row, width},
+                            {planes + 2 * header->bytes_per_row, width}, result[y]);
     }
 
     return result;
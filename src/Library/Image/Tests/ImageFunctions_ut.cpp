@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <vector>
+
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Image/ImageFunctions.h"
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static Palette randomPalette(RandomEngine *rng) {
+    Palette result;
+    for (Color &color : result.colors)
+        color = Color::fromC32(rng->random(0x10000) | (rng->random(0x10000) << 16));
+    return result;
+}
+
+static GrayscaleImage randomIndexedImage(RandomEngine *rng, ssize_t width, ssize_t height) {
+    GrayscaleImage result = GrayscaleImage::uninitialized(width, height);
+    for (uint8_t &pixel : result.pixels())
+        pixel = rng->random(256);
+    return result;
+}
+
+UNIT_TEST(ImageFunctions, MakeRgbaImage) {
+    MersenneTwisterRandomEngine rng;
+    Palette palette = randomPalette(&rng);
+
+    // Odd sizes to cover the tails, and a large one to cover the vectorized path.
+    for (auto [w, h] : {std::pair(1, 1), std::pair(7, 3), std::pair(17, 17), std::pair(256, 256)}) {
+        GrayscaleImage indexed = randomIndexedImage(&rng, w, h);
+        RgbaImage rgba = makeRgbaImage(indexed, palette);
+        ASSERT_EQ(rgba.width(), w);
+        ASSERT_EQ(rgba.height(), h);
+        for (size_t i = 0; i < indexed.pixels().size(); i++)
+            EXPECT_EQ(rgba.pixels()[i], palette.colors[indexed.pixels()[i]]);
+    }
+
+    EXPECT_FALSE(makeRgbaImage(GrayscaleImageView(), palette));
+}
+
+UNIT_TEST(ImageFunctions, InterleaveRgbPlanes) {
+    MersenneTwisterRandomEngine rng;
+    for (size_t size : {0, 1, 15, 16, 33, 1000}) {
+        std::vector<uint8_t> r(size), g(size), b(size);
+        for (size_t i = 0; i < size; i++) {
+            r[i] = rng.random(256);
+            g[i] = rng.random(256);
+            b[i] = rng.random(256);
+        }
+
+        std::vector<Color> pixels(size);
+        interleaveRgbPlanes(r, g, b, pixels);
+        for (size_t i = 0; i < size; i++)
+            EXPECT_EQ(pixels[i], Color(r[i], g[i], b[i], 255));
+    }
+}
+
+UNIT_TEST(ImageFunctions, FlipVertically) {
+    RgbaImage image = RgbaImage::uninitialized(3, 4);
+    for (ssize_t y = 0; y < 4; y++)
+        for (ssize_t x = 0; x < 3; x++)
+            image[y][x] = Color(x, y, 0);
+
+    RgbaImage flipped = flipVertically(image);
+    for (ssize_t y = 0; y < 4; y++)
+        for (ssize_t x = 0; x < 3; x++)
+            EXPECT_EQ(flipped[y][x], Color(x, 3 - y, 0));
+}
+
+UNIT_BENCHMARK(ImageFunctions, Benchmark) {
+    MersenneTwisterRandomEngine rng;
+    Palette palette = randomPalette(&rng);
+    GrayscaleImage indexed = randomIndexedImage(&rng, 512, 512);
+    RgbaImage rgba = RgbaImage::uninitialized(512, 512);
+    size_t pixels = indexed.pixels().size();
+    std::ranges::fill(rgba.pixels(), Color()); // Fault in the pages before measuring anything.
+
+    double paletteNs = benchmarkNsPerItem(pixels, 20, [&] {
+        expandPalette(indexed.pixels(), palette, rgba.pixels());
+    });
+    double paletteScalarNs = benchmarkNsPerItem(pixels, 20, [&] {
+        const uint8_t *src = indexed.pixels().data();
+        Color *dst = rgba.pixels().data();
+        for (size_t i = 0; i < pixels; i++)
+            dst[i] = palette.colors[src[i]];
+    });
+
+    std::vector<uint8_t> planes(3 * pixels);
+    for (uint8_t &value : planes)
+        value = rng.random(256);
+    std::span<const uint8_t> r(planes.data(), pixels);
+    std::span<const uint8_t> g(planes.data() + pixels, pixels);
+    std::span<const uint8_t> b(planes.data() + 2 * pixels, pixels);
+    double interleaveNs = benchmarkNsPerItem(pixels, 20, [&] {
+        interleaveRgbPlanes(r, g, b, rgba.pixels());
+    });
+    double interleaveScalarNs = benchmarkNsPerItem(pixels, 20, [&] {
+        Color *dst = rgba.pixels().data();
+        for (size_t i = 0; i < pixels; i++)
+            dst[i] = Color(r[i], g[i], b[i]);
+    });
+
+    double flipNs = benchmarkNsPerItem(pixels, 20, [&] {
+        RgbaImage flipped = flipVertically(rgba);
+    });
+
+    reportBenchmark("expandPalette", paletteNs, "pixel");
+    reportBenchmark("expandPalette, scalar", paletteScalarNs, "pixel");
+    reportBenchmark("interleaveRgbPlanes", interleaveNs, "pixel");
+    reportBenchmark("interleaveRgbPlanes, scalar", interleaveScalarNs, "pixel");
+    reportBenchmark("flipVertically", flipNs, "pixel");
+}
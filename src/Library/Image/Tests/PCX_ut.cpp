@@ -0,0 +1,44 @@
+#include "Testing/Unit/UnitBenchmark.h"
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Image/PCX.h"
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+static RgbaImage randomImage(RandomEngine *rng, ssize_t width, ssize_t height) {
+    // Mix of flat areas & noise, so that both RLE runs and literals are exercised.
+    RgbaImage result = RgbaImage::uninitialized(width, height);
+    for (ssize_t y = 0; y < height; y++) {
+        for (ssize_t x = 0; x < width; x++) {
+            if ((x / 8 + y / 8) % 2) {
+                result[y][x] = Color(x / 8 * 20, y / 8 * 20, 200);
+            } else {
+                result[y][x] = Color(rng->random(256), rng->random(256), rng->random(256));
+            }
+        }
+    }
+    return result;
+}
+
+UNIT_TEST(PCX, RoundTrip) {
+    MersenneTwisterRandomEngine rng;
+    for (auto [w, h] : {std::pair(1, 1), std::pair(3, 5), std::pair(17, 16), std::pair(200, 100)}) {
+        RgbaImage image = randomImage(&rng, w, h);
+        RgbaImage decoded = pcx::decode(pcx::encode(image));
+        ASSERT_EQ(decoded.width(), w);
+        ASSERT_EQ(decoded.height(), h);
+        for (ssize_t y = 0; y < h; y++)
+            for (ssize_t x = 0; x < w; x++)
+                EXPECT_EQ(decoded[y][x], image[y][x]);
+    }
+}
+
+UNIT_BENCHMARK(PCX, Benchmark) {
+    MersenneTwisterRandomEngine rng;
+    RgbaImage image = randomImage(&rng, 640, 480);
+    Blob data = pcx::encode(image);
+
+    double ns = benchmarkNsPerItem(image.pixels().size(), 20, [&] {
+        RgbaImage decoded = pcx::decode(data);
+    });
+    reportBenchmark("pcx::decode", ns, "pixel");
+}
@@ -19,3 +19,10 @@ enum class LodOpenFlag {
 using enum LodOpenFlag;
 MM_DECLARE_FLAGS(LodOpenFlags, LodOpenFlag)
 MM_DECLARE_OPERATORS_FOR_FLAGS(LodOpenFlags)
+
+enum class LodWriteFlag {
+    LOD_DEDUPLICATE = 0x1, // Store identical entries only once, with all index entries pointing to the same data.
+};
+using enum LodWriteFlag;
+MM_DECLARE_FLAGS(LodWriteFlags, LodWriteFlag)
+MM_DECLARE_OPERATORS_FOR_FLAGS(LodWriteFlags)
@@ -6,10 +6,12 @@
 #include <unordered_map>
 #include <string>
 #include <vector>
+#include <memory_resource>
 
 #include "Library/Compression/Compression.h"
 #include "Library/Snapshots/SnapshotSerialization.h"
 
+#include "Utility/Memory/Arena.h"
 #include "Utility/Streams/BlobInputStream.h"
 #include "Utility/Exception.h"
 #include "Utility/String/Ascii.h"
@@ -102,7 +104,7 @@ void LodReader::open(Blob blob, LodOpenFlags openFlags) {
     rootEntry.dataSize = blob.size() - rootEntry.dataOffset;
 
     BlobInputStream dirStream(blob.subBlob(rootEntry.dataOffset, rootEntry.dataSize));
-    std::unordered_map<std::string, LodRegion> files;
+    std::unordered_map<std::string, LodRegion, TransparentStringHash, TransparentStringEquals> files;
     for (const LodEntry &entry : parseFileEntries(dirStream, rootEntry, version)) {
         std::string name = ascii::toLower(entry.name);
         if (files.contains(name)) {
@@ -134,20 +136,28 @@ void LodReader::close() {
     _files = {};
 }
 
+static std::pmr::string toLowerScratch(std::string_view filename) {
+    std::pmr::string result(filename.size(), '\0', &scratchArena());
+    std::transform(filename.begin(), filename.end(), result.begin(), [](char c) { return ascii::toLower(c); });
+    return result;
+}
+
 bool LodReader::exists(std::string_view filename) const {
     assert(isOpen());
 
-    return _files.contains(ascii::toLower(filename));
+    ArenaScope scope(scratchArena());
+    return _files.contains(std::string_view(toLowerScratch(filename)));
 }
 
 Blob LodReader::read(std::string_view filename) const {
     assert(isOpen());
 
-    const auto pos = _files.find(ascii::toLower(filename));
+    ArenaScope scope(scratchArena());
+    const auto pos = _files.find(std::string_view(toLowerScratch(filename)));
     if (pos == _files.cend())
         throw Exception("Entry '{}' doesn't exist in LOD file '{}'", filename, _lod.displayPath());
 
-    return _lod.subBlob(pos->second.offset, pos->second.size).withDisplayPath(fmt::format("{}/{}", _lod.displayPath(), filename));
+    return _lod.subBlob(pos->second.offset, pos->second.size).withDisplayPath(_lod, filename);
 }
 
 std::vector<std::string> LodReader::ls() const {
@@ -5,6 +5,7 @@
 #include <unordered_map>
 
 #include "Utility/Memory/Blob.h"
+#include "Utility/String/TransparentFunctors.h"
 
 #include "LodEnums.h"
 #include "LodInfo.h"
@@ -82,5 +83,5 @@ class LodReader final {
  private:
     Blob _lod;
     LodInfo _info;
-    std::unordered_map<std::string, LodRegion> _files;
+    std::unordered_map<std::string, LodRegion, TransparentStringHash, TransparentStringEquals> _files;
 };
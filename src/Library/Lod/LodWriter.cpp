@@ -1,5 +1,7 @@
 #include "LodWriter.h"
 
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <memory>
@@ -14,31 +16,32 @@
 
 LodWriter::LodWriter() {}
 
-LodWriter::LodWriter(std::string_view path, LodInfo info) {
-    open(path, std::move(info));
+LodWriter::LodWriter(std::string_view path, LodInfo info, LodWriteFlags writeFlags) {
+    open(path, std::move(info), writeFlags);
 }
 
-LodWriter::LodWriter(OutputStream *stream, LodInfo info) {
-    open(stream, std::move(info));
+LodWriter::LodWriter(OutputStream *stream, LodInfo info, LodWriteFlags writeFlags) {
+    open(stream, std::move(info), writeFlags);
 }
 
 LodWriter::~LodWriter() {
     close();
 }
 
-void LodWriter::open(std::string_view path, LodInfo info) {
+void LodWriter::open(std::string_view path, LodInfo info, LodWriteFlags writeFlags) {
     std::unique_ptr<OutputStream> ownedStream = std::make_unique<FileOutputStream>(path); // If this throws, no field is overwritten.
-    open(ownedStream.get(), std::move(info));
+    open(ownedStream.get(), std::move(info), writeFlags);
     _ownedStream = std::move(ownedStream);
 }
 
-void LodWriter::open(OutputStream *stream, LodInfo info) {
+void LodWriter::open(OutputStream *stream, LodInfo info, LodWriteFlags writeFlags) {
     assert(stream);
 
     close();
 
     _stream = stream;
     _info = std::move(info);
+    _writeFlags = writeFlags;
 }
 
 void LodWriter::close() {
@@ -53,10 +56,26 @@ void LodWriter::close() {
     header.numDirectories = 1;
     serialize(header, _stream, tags::via<LodHeader_MM6>);
 
-    // Write out root entry.
+    // Lay out file data. With deduplication on, identical files share a single copy.
     size_t dataSize = 0;
-    for (const auto &[_, data] : _files)
+    std::vector<size_t> dataOffsets;
+    std::vector<const Blob *> uniqueData;
+    std::unordered_map<std::string_view, size_t> dataOffsetByContents;
+    for (const auto &[_, data] : _files) {
+        if (_writeFlags & LOD_DEDUPLICATE) {
+            auto [pos, inserted] = dataOffsetByContents.emplace(data.string_view(), dataSize);
+            if (!inserted) {
+                dataOffsets.push_back(pos->second);
+                continue;
+            }
+        }
+
+        dataOffsets.push_back(dataSize);
+        uniqueData.push_back(&data);
         dataSize += data.size();
+    }
+
+    // Write out root entry.
     size_t indexSize = _files.size() * fileEntrySize(_info.version);
 
     LodEntry directoryEntry;
@@ -67,16 +86,13 @@ void LodWriter::close() {
     serialize(directoryEntry, _stream, tags::via<LodEntry_MM6>);
 
     // Write out file entries.
-    size_t currentOffset = indexSize;
     std::vector<LodEntry> fileEntries;
     for (const auto &[name, data] : _files) {
         LodEntry &entry = fileEntries.emplace_back();
         entry.name = name;
-        entry.dataOffset = currentOffset;
+        entry.dataOffset = indexSize + dataOffsets[fileEntries.size() - 1];
         entry.dataSize = data.size();
         entry.numItems = 0;
-
-        currentOffset += data.size();
     }
 
     if (_info.version == LOD_VERSION_MM8) {
@@ -85,14 +101,15 @@ void LodWriter::close() {
         serialize(fileEntries, _stream, tags::unsized, tags::via<LodEntry_MM6>);
     }
 
-    for (const auto &[_, data] : _files)
-        _stream->write(data);
+    for (const Blob *data : uniqueData)
+        _stream->write(*data);
 
     // Close shop.
     _files.clear(); // Important to release the Blobs first, as they might point into a file that we're about to overwrite...
     _ownedStream = {}; // ...here.
     _stream = {};
     _info = {};
+    _writeFlags = 0;
 }
 
 void LodWriter::write(std::string_view filename, const Blob &data) {
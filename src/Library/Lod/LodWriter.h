@@ -8,17 +8,18 @@
 #include "Utility/Streams/OutputStream.h"
 #include "Utility/Memory/Blob.h"
 
+#include "LodEnums.h"
 #include "LodInfo.h"
 
 class LodWriter {
  public:
     LodWriter();
-    LodWriter(std::string_view path, LodInfo info);
-    LodWriter(OutputStream *stream, LodInfo info);
+    LodWriter(std::string_view path, LodInfo info, LodWriteFlags writeFlags = 0);
+    LodWriter(OutputStream *stream, LodInfo info, LodWriteFlags writeFlags = 0);
     ~LodWriter();
 
-    void open(std::string_view path, LodInfo info);
-    void open(OutputStream *stream, LodInfo info);
+    void open(std::string_view path, LodInfo info, LodWriteFlags writeFlags = 0);
+    void open(OutputStream *stream, LodInfo info, LodWriteFlags writeFlags = 0);
 
     void close();
 
@@ -33,5 +34,6 @@ class LodWriter {
     std::unique_ptr<OutputStream> _ownedStream;
     OutputStream *_stream = nullptr;
     LodInfo _info;
+    LodWriteFlags _writeFlags;
     std::map<std::string, Blob> _files; // Having this one sorted makes implementation simpler.
 };
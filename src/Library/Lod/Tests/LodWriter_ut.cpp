@@ -45,3 +45,33 @@ UNIT_TEST(LodWriter, TestWrite) {
     EXPECT_EQ(reader.read("3").string_view(), file3);
     EXPECT_EQ(reader.read("4").string_view(), file4);
 }
+
+UNIT_TEST(LodWriter, TestDeduplicate) {
+    LodInfo info;
+    info.version = LOD_VERSION_MM8;
+    info.rootName = "data";
+
+    std::string file1 = std::string(100'000, '1');
+    std::string file2 = std::string(100'000, '2');
+
+    Blob plainLod, dedupLod;
+    for (auto [lod, flags] : {std::pair(&plainLod, LodWriteFlags()), std::pair(&dedupLod, LodWriteFlags(LOD_DEDUPLICATE))}) {
+        BlobOutputStream stream(lod, "some.lod");
+        LodWriter writer(&stream, info, flags);
+        writer.write("a", Blob::view(file1));
+        writer.write("b", Blob::view(file2));
+        writer.write("c", Blob::view(file1));
+        writer.write("d", Blob::view(file1));
+        writer.close();
+        stream.close();
+    }
+
+    EXPECT_EQ(dedupLod.size() + 2 * file1.size(), plainLod.size()); // Two copies of file1 were dropped.
+
+    LodReader reader(std::move(dedupLod));
+    EXPECT_EQ(reader.ls(), (std::vector<std::string>{"a", "b", "c", "d"}));
+    EXPECT_EQ(reader.read("a").string_view(), file1);
+    EXPECT_EQ(reader.read("b").string_view(), file2);
+    EXPECT_EQ(reader.read("c").string_view(), file1);
+    EXPECT_EQ(reader.read("d").string_view(), file1);
+}
@@ -105,8 +105,17 @@ LodFileFormat lod::magic(const Blob &blob, std::string_view fileName) {
     return LOD_FILE_RAW;
 }
 
-Blob lod::decodeCompressed(const Blob &blob) {
-    LodFileFormat format = magic(blob, {});
+static Blob uncompress(const Blob &blob, size_t decompressedSize, LodFileFormat format, bool checkCorruption) {
+    Blob result = zlib::uncompress(blob, decompressedSize);
+
+    // zlib::uncompress returns an empty blob on error, and header says there should be some data.
+    if (checkCorruption && result.size() == 0)
+        throw Exception("Cannot uncompress LOD entry of type '{}': data is corrupted", toString(format));
+    return result;
+}
+
+static Blob decodeCompressedInternal(const Blob &blob, bool checkCorruption) {
+    LodFileFormat format = lod::magic(blob, {});
     if (format == LOD_FILE_RAW)
         return Blob::share(blob); // Not compressed.
 
@@ -124,7 +133,7 @@ Blob lod::decodeCompressed(const Blob &blob) {
             result = stream.readBlobOrFail(header.dataSize);
         }
         if (header.decompressedSize)
-            result = zlib::uncompress(result, header.decompressedSize);
+            result = uncompress(result, header.decompressedSize, format, checkCorruption);
         return result;
     }
 
@@ -135,15 +144,49 @@ Blob lod::decodeCompressed(const Blob &blob) {
 
         Blob result = stream.readBlobOrFail(header.dataSize);
         if (header.decompressedSize)
-            result = zlib::uncompress(result, header.decompressedSize);
+            result = uncompress(result, header.decompressedSize, format, checkCorruption);
         return result;
     }
 
     throw Exception("Cannot uncompress LOD entry of type '{}', operation is not supported", toString(format));
 }
 
-Blob lod::encodeCompressed(const Blob &blob) {
-    Blob compressed = zlib::compress(blob);
+Blob lod::decodeCompressed(const Blob &blob) {
+    return decodeCompressedInternal(blob, false);
+}
+
+Blob lod::decodeCompressedOrFail(const Blob &blob) {
+    return decodeCompressedInternal(blob, true);
+}
+
+size_t lod::decompressedSize(const Blob &blob) {
+    LodFileFormat format = lod::magic(blob, {});
+    if (format == LOD_FILE_RAW)
+        return blob.size();
+
+    if (format == LOD_FILE_COMPRESSED) {
+        BlobInputStream stream(blob);
+        LodCompressionHeader_MM6 header;
+        deserialize(stream, &header);
+
+        if (header.decompressedSize)
+            return header.decompressedSize;
+        return header.dataSize == blob.size() ? stream.tail().size() : header.dataSize; // See decodeCompressedInternal.
+    }
+
+    if (format == LodFileFormat::LOD_FILE_PSEUDO_IMAGE) {
+        BlobInputStream stream(blob);
+        LodImageHeader_MM6 header;
+        deserialize(stream, &header);
+
+        return header.decompressedSize ? header.decompressedSize : header.dataSize;
+    }
+
+    throw Exception("Cannot uncompress LOD entry of type '{}', operation is not supported", toString(format));
+}
+
+Blob lod::encodeCompressed(const Blob &blob, int level) {
+    Blob compressed = zlib::compress(blob, level);
 
     LodCompressionHeader_MM6 header;
     header.version = 91969;
@@ -31,19 +31,42 @@ LodFileFormat magic(const Blob &blob, std::string_view fileName);
  *
  * In case of `LOD_FILE_RAW`, it just does nothing and returns the blob as is.
  *
+ * Note that corrupted compressed data is not reported, an empty `Blob` is returned instead.
+ *
  * @param blob                          `Blob` from a LOD file.
  * @return                              Uncompressed `Blob`.
  * @throw Exception                     If the provided `Blob` is of unsupported type.
  */
 Blob decodeCompressed(const Blob &blob);
 
+/**
+ * Same as `decodeCompressed`, but throws if the compressed data is corrupted.
+ *
+ * @param blob                          `Blob` from a LOD file.
+ * @return                              Uncompressed `Blob`.
+ * @throw Exception                     If the provided `Blob` is of unsupported type, or if its compressed data is
+ *                                      corrupted.
+ */
+Blob decodeCompressedOrFail(const Blob &blob);
+
+/**
+ * Reads the size of the uncompressed data from the headers, without uncompressing it. Can be used to reject entries
+ * that are too big before spending time & memory on `decodeCompressed`.
+ *
+ * @param blob                          `Blob` from a LOD file.
+ * @return                              Size of the `Blob` that `decodeCompressed` would return for valid data.
+ * @throw Exception                     If the provided `Blob` is of unsupported type.
+ */
+size_t decompressedSize(const Blob &blob);
+
 /**
  * This function compresses the provided `Blob` into the `LOD_FILE_COMPRESSED` format.
  *
  * @param blob                          `Blob` to compress.
+ * @param level                         zlib compression level, 0-9. Default value of -1 means zlib's default level.
  * @return                              Compressed `Blob` in `LOD_FILE_COMPRESSED` format.
  */
-Blob encodeCompressed(const Blob &blob);
+Blob encodeCompressed(const Blob &blob, int level = -1);
 
 /**
  * This function processes `LOD_FILE_PALETTE` and `LOD_FILE_IMAGE` formats. In case of the latter, the pixel data
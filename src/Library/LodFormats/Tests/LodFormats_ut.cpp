@@ -0,0 +1,38 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/LodFormats/LodFormats.h"
+
+#include "Utility/Memory/Blob.h"
+#include "Utility/Exception.h"
+
+UNIT_TEST(LodFormats, CompressedRoundTrip) {
+    std::string data(10'000, 'x');
+    for (size_t i = 0; i < data.size(); i += 7)
+        data[i] = static_cast<char>(i);
+
+    for (int level : {-1, 0, 1, 9}) {
+        Blob compressed = lod::encodeCompressed(Blob::view(data), level);
+        EXPECT_EQ(lod::magic(compressed, {}), LOD_FILE_COMPRESSED);
+        EXPECT_EQ(lod::decodeCompressed(compressed).string_view(), data);
+        EXPECT_EQ(lod::decodeCompressedOrFail(compressed).string_view(), data);
+        EXPECT_EQ(lod::decompressedSize(compressed), data.size());
+    }
+
+    EXPECT_EQ(lod::decompressedSize(Blob::view(data)), data.size()); // Raw data.
+}
+
+UNIT_TEST(LodFormats, CorruptedCompressed) {
+    std::string data(10'000, 'x');
+    std::string compressed = std::string(lod::encodeCompressed(Blob::view(data)).string_view());
+
+    // Mangle the zlib stream, but keep the LOD compression header intact.
+    for (size_t i = compressed.size() / 2; i < compressed.size(); i++)
+        compressed[i] ^= 0x55;
+
+    Blob blob = Blob::view(compressed);
+    EXPECT_EQ(lod::magic(blob, {}), LOD_FILE_COMPRESSED);
+    EXPECT_EQ(lod::decodeCompressed(blob).size(), 0); // Not reported, for compatibility with the engine code.
+    EXPECT_THROW((void) lod::decodeCompressedOrFail(blob), Exception);
+}
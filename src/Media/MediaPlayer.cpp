@@ -3,9 +3,12 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <vector>
 #include <thread>
@@ -40,13 +43,14 @@ extern "C" {
 
 #include "GUI/GUIWindow.h"
 
-using namespace std::chrono_literals; // NOLINT
-
 OpenALSoundProvider *provider = nullptr;
 
 MPlayer *pMediaPlayer = nullptr;
 PMovie pMovie_Track;
 
+/** Max number of decoded video frames that the decode thread can get ahead of playback. */
+static constexpr size_t MAX_QUEUED_VIDEO_FRAMES = 8;
+
 class AVStreamWrapper {
  public:
     AVStreamWrapper() {
@@ -101,6 +105,11 @@ class AVStreamWrapper {
             close();
             return false;
         }
+        if (type_ == AVMEDIA_TYPE_VIDEO) {
+            // Let libavcodec pick the number of threads.
+            dec_ctx->thread_count = 0;
+            dec_ctx->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+        }
         if (avcodec_open2(dec_ctx, dec, nullptr) < 0) {
             close();
             return false;
@@ -218,26 +227,20 @@ class AVVideoStream : public AVStreamWrapper {
         return true;
     }
 
-    Blob decode_frame(AVPacket *avpacket) {
-        Blob result;
+    /**
+     * Decodes a video packet. Note that with frame threading the decoder lags behind by several packets, so decoded
+     * frames don't generally correspond to the packet that was passed in.
+     *
+     * @param avpacket                  Packet to decode, or `nullptr` to drain the decoder at the end of stream.
+     * @param callback                  Callback to invoke for each decoded frame, taking frame pts (in frames) and
+     *                                  a `Blob` with BGRA pixels.
+     */
+    template<class Callback>
+    void decode_frames(AVPacket *avpacket, Callback &&callback) {
         AVFrame *frame = av_frame_alloc();
 
-        if (!queue.empty()) {
-            result = std::move(queue.front());
-            queue.pop();
-        }
-
         if (avcodec_send_packet(dec_ctx, avpacket) >= 0) {
-            int res = 0;
-            while (res >= 0) {
-                res = avcodec_receive_frame(dec_ctx, frame);
-                if (res == AVERROR(EAGAIN) || res == AVERROR_EOF) {
-                    break;
-                }
-                if (res < 0) {
-                    av_frame_free(&frame);
-                    return result;
-                }
+            while (avcodec_receive_frame(dec_ctx, frame) >= 0) {
                 int linesizes[4] = { 0, 0, 0, 0 };
                 if (av_image_fill_linesizes(linesizes, AV_PIX_FMT_RGB32, width) < 0) {
                     assert(false);
@@ -250,24 +253,19 @@ class AVVideoStream : public AVStreamWrapper {
                     assert(false);
                 }
 
-                Blob tmp_blob = Blob::fromMalloc(std::move(tmp_buf), tmp_size);
+                int64_t pts = frame->best_effort_timestamp;
+                if (pts == AV_NOPTS_VALUE)
+                    pts = next_pts;
+                next_pts = pts + 1;
 
-                if (!result) {
-                    result = std::move(tmp_blob);
-                } else {
-                    queue.push(std::move(tmp_blob));
-                }
+                callback(pts, Blob::fromMalloc(std::move(tmp_buf), tmp_size));
             }
         }
 
         av_frame_free(&frame);
-
-        last_frame = Blob::share(result);
-
-        return result;
     }
 
-    Blob last_frame;
+    int64_t next_pts = 0;
     double frames_per_second = 0;
     double frame_len = 0;
     SwsContext *converter = nullptr;
@@ -275,6 +273,173 @@ class AVVideoStream : public AVStreamWrapper {
     int height = 0;
 };
 
+/**
+ * Demuxes & decodes a movie on a worker thread, keeping a bounded queue of decoded video frames ready for the main
+ * thread to display.
+ *
+ * Streams passed to `start` must not be touched from other threads until `stop` is called.
+ */
+class AVDecodeThread {
+ public:
+    struct VideoFrame {
+        int64_t pts = 0; // Frame number, keeps growing when looping.
+        Blob pixels; // BGRA pixels.
+    };
+
+    ~AVDecodeThread() {
+        stop();
+    }
+
+    /**
+     * @param format_ctx                Format context to read packets from.
+     * @param video                     Video stream to decode.
+     * @param audio                     Audio stream to decode, or `nullptr` if audio packets should be skipped.
+     * @param looping                   Whether to restart from the beginning at the end of stream.
+     */
+    void start(AVFormatContext *format_ctx, AVVideoStream *video, AVAudioStream *audio, bool looping) {
+        assert(!_thread.joinable());
+
+        _stopping = false;
+        _finished = false;
+        _thread = std::thread([=, this] { run(format_ctx, video, audio, looping); });
+    }
+
+    void stop() {
+        if (!_thread.joinable())
+            return;
+
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _frameConsumed.notify_all();
+        _thread.join();
+
+        _frames.clear();
+        _audio.clear();
+    }
+
+    [[nodiscard]] bool isStarted() const {
+        return _thread.joinable();
+    }
+
+    /**
+     * @return                          Whether decoding has finished and all decoded frames were consumed.
+     */
+    [[nodiscard]] bool isFinished() {
+        std::lock_guard lock(_mutex);
+        return _finished && _frames.empty();
+    }
+
+    /**
+     * Pops all frames that are due for display.
+     *
+     * @param desiredPts                Number of the frame that should be on screen right now.
+     * @param wait                      If set, blocks until at least one frame is decoded, and then pops it even if
+     *                                  it's not yet due. Returns `std::nullopt` only if decoding has finished.
+     * @param[out] popped               Number of frames popped.
+     * @return                          Last popped frame, or `std::nullopt` if no frames were popped.
+     */
+    std::optional<VideoFrame> popFrames(int64_t desiredPts, bool wait, int *popped = nullptr) {
+        std::unique_lock lock(_mutex);
+        if (wait)
+            _frameProduced.wait(lock, [&] { return _finished || !_frames.empty(); });
+
+        std::optional<VideoFrame> result;
+        int count = 0;
+        while (!_frames.empty() && (_frames.front().pts <= desiredPts || (wait && count == 0))) {
+            result = std::move(_frames.front());
+            _frames.pop_front();
+            count++;
+        }
+        lock.unlock();
+
+        if (count)
+            _frameConsumed.notify_one();
+        if (popped)
+            *popped = count;
+        return result;
+    }
+
+    /**
+     * @return                          Audio buffers decoded since the last call.
+     */
+    std::deque<Blob> popAudio() {
+        std::lock_guard lock(_mutex);
+        return std::exchange(_audio, {});
+    }
+
+ private:
+    void run(AVFormatContext *format_ctx, AVVideoStream *video, AVAudioStream *audio, bool looping) {
+        AVPacket *avpacket = av_packet_alloc();
+        int64_t ptsOffset = 0;
+        int64_t lastPts = -1;
+
+        auto pushFrame = [&](int64_t pts, Blob pixels) {
+            lastPts = pts;
+            std::unique_lock lock(_mutex);
+            _frameConsumed.wait(lock, [&] { return _stopping || _frames.size() < MAX_QUEUED_VIDEO_FRAMES; });
+            if (_stopping)
+                return;
+            _frames.push_back({ptsOffset + pts, std::move(pixels)});
+            lock.unlock();
+            _frameProduced.notify_one();
+        };
+
+        while (!isStopping()) {
+            if (av_read_frame(format_ctx, avpacket) < 0) {
+                video->decode_frames(nullptr, pushFrame); // Get the frames that are still in the decoder.
+                if (!looping || isStopping())
+                    break;
+
+                video->reset();
+                if (audio)
+                    audio->reset();
+                if (av_seek_frame(format_ctx, -1, 0, AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY) < 0)
+                    break;
+                ptsOffset += lastPts + 1;
+                lastPts = -1;
+                continue;
+            }
+
+            if (avpacket->stream_index == video->stream_idx) {
+                video->decode_frames(avpacket, pushFrame);
+            } else if (audio && avpacket->stream_index == audio->stream_idx) {
+                Blob buffer = audio->decode_frame(avpacket);
+                if (buffer) {
+                    std::lock_guard lock(_mutex);
+                    _audio.push_back(std::move(buffer));
+                }
+            }
+
+            av_packet_unref(avpacket);
+        }
+
+        av_packet_free(&avpacket);
+
+        {
+            std::lock_guard lock(_mutex);
+            _finished = true;
+        }
+        _frameProduced.notify_all();
+    }
+
+    bool isStopping() {
+        std::lock_guard lock(_mutex);
+        return _stopping;
+    }
+
+ private:
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _frameProduced;
+    std::condition_variable _frameConsumed;
+    std::deque<VideoFrame> _frames;
+    std::deque<Blob> _audio;
+    bool _stopping = false;
+    bool _finished = false;
+};
+
 static Recti calculateVideoRectangle(const IMovie &movie) {
     Sizei scaleSize;
     if (render->GetPresentDimensions() != render->GetRenderDimensions())
@@ -305,8 +470,6 @@ class Movie : public IMovie {
         format_ctx = nullptr;
         playback_time = 0.0;
 
-        last_resampled_frame_num = -1;
-
         audio_data_in_device = nullptr;
         format_ctx = nullptr;
 
@@ -332,6 +495,8 @@ class Movie : public IMovie {
     }
 
     inline void ReleaseAVCodec() {
+        _decoder.stop();
+
         audio.close();
         video.close();
 
@@ -394,171 +559,56 @@ class Movie : public IMovie {
             return Blob();
         }
 
+        if (!_decoder.isStarted())
+            _decoder.start(format_ctx, &video, audio.stream_idx >= 0 ? &audio : nullptr, looping);
+
         auto current_time = std::chrono::system_clock::now();
         auto diff = std::chrono::time_point_cast<std::chrono::milliseconds>(current_time) - std::chrono::time_point_cast<std::chrono::milliseconds>(start_time);
 
         playback_time += std::chrono::duration_cast<std::chrono::milliseconds>(diff).count();
         start_time = current_time;
 
+        // Audio packets are queued into playing as soon as they're decoded.
+        for (const Blob &buffer : _decoder.popAudio())
+            provider->Stream16(audio_data_in_device, buffer.size() / 2, buffer.data());
+
         int desired_frame_number = (int)((playback_time / video.frame_len) + 0.5);
-        if (last_resampled_frame_num == desired_frame_number) {
-            return Blob::share(video.last_frame);
-        }
-        last_resampled_frame_num++;
-        if (last_resampled_frame_num == video.stream->duration) {
-            if (looping) {
-                video.reset();
-                audio.reset();
-                int err = av_seek_frame(format_ctx, -1, 0,
-                                        AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY);
-                char err_buf[2048];
-                av_strerror(err, err_buf, 2048);
-                if (err < 0) {
-                    Close();
-                    return Blob();
-                }
-                last_resampled_frame_num = 0;
-                playback_time = 0;
-                desired_frame_number = 0;
-            } else {
-                playing = false;
-                return Blob();
-            }
+        if (auto frame = _decoder.popFrames(desired_frame_number, !_currentFrame)) {
+            _currentFrame = std::move(frame->pixels);
+            _currentPts = frame->pts;
+        } else if (_decoder.isFinished()) {
+            // Movie is finished. Note that if the decoder is just lagging behind, we show the current frame again.
+            playing = false;
+            return Blob();
         }
 
-        AVPacket *avpacket = av_packet_alloc();
-
-        // keep reading packets until we hit the end or find a video packet
-        do {
-            if (av_read_frame(format_ctx, avpacket) < 0) {
-                // probably movie is finished
-                playing = false;
-                av_packet_free(&avpacket);
-                return Blob();
-            }
-
-            // Is this a packet from the video stream?
-            // audio packet - queue into playing
-            if (avpacket->stream_index == audio.stream_idx) {
-                Blob buffer = audio.decode_frame(avpacket);
-                if (buffer) {
-                    provider->Stream16(audio_data_in_device,
-                                       buffer.size() / 2,
-                                       buffer.data());
-                }
-            } else if (avpacket->stream_index == video.stream_idx) {
-              // Decode video frame
-              // video packet - decode & maybe show
-              video.decode_frame(avpacket);
-            } else {
-                assert(false);  // unknown stream
-            }
-        } while (avpacket->stream_index != video.stream_idx ||
-                 avpacket->pts <= desired_frame_number);
-
-        av_packet_free(&avpacket);
-
-        return Blob::share(video.last_frame);
+        return Blob::share(_currentFrame);
     }
 
     virtual void PlayBink() override {
-        // fix for #39 - choppy sound with bink
-
-        AVPacket packet;
-
-
-        // create texture
-        GraphicsImage *tex = GraphicsImage::Create(pMovie_Track->GetWidth(), pMovie_Track->GetHeight());
-
-        // holds decoded audio
-        std::queue<Blob> buffq;
-
-        // loop through once and add all audio packets to queue
-        while (av_read_frame(format_ctx, &packet) >= 0) {
-            if (packet.stream_index == audio.stream_idx) {
-                Blob buffer = audio.decode_frame(&packet);
-                if (buffer) buffq.push(std::move(buffer));
-            }
-        }
-        logger->trace("Audio Packets Queued");
-
-        // reset video to start
-        int err = avformat_seek_file(format_ctx, -1, 0, 0, 0, AVSEEK_FLAG_BACKWARD);
-        //int err = av_seek_frame(format_ctx, -1, 0, AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY);
-        if (err < 0) {
-            logger->warning("Seek to start failed! - Exit Movie");
-            tex->Release();
+        if (!prepare())
             return;
-        }
-        start_time = std::chrono::system_clock::now();
-        logger->trace("Video stream reset");
-
-        int lastvideopts = -1;
-        int desired_frame_number;
-        auto current_time = std::chrono::system_clock::now();
-        int audioupdaterate = (30.0f * video.frame_len) / 1000.0f;
-
-        // loop through and do video
-        while (av_read_frame(format_ctx, &packet) >= 0) {
-            do {
-                // get playback time - and wait till we need the next frame
-                current_time = std::chrono::system_clock::now();
-                playback_time = (std::chrono::duration_cast<std::chrono::milliseconds>(current_time - start_time)).count();
-                desired_frame_number = (int)((playback_time / video.frame_len)/* + 0.25*/);
-                std::this_thread::sleep_for(5ms);
-            } while (lastvideopts == desired_frame_number);
-
-            // ignore audio packets
-            if (packet.stream_index == audio.stream_idx) { continue; }
-
-            if (packet.stream_index == video.stream_idx) {
-                // check if anymore sound frames still in decoder
-                Blob buffer = audio.decode_frame(NULL);
-                if (buffer) buffq.push(std::move(buffer));
-
-                // stream required sound frames
-                // nwc and intro are 15fps vid but need 30fps sound
-                // jvc is 10fps video but need 30 fps sound
-                for (int i = 0; i < audioupdaterate; i++) {
-                    if (!buffq.empty()) {
-                        provider->Stream16(audio_data_in_device,
-                                            buffq.front().size() / 2,
-                                            buffq.front().data());
-                        buffq.pop();
-                    }
-                }
-
-                // Decode video frame and show
-                lastvideopts = packet.pts;
-                video.decode_frame(&packet);
-
-                render->BeginScene2D();
-                // update pixels from buffer
-                tex->rgba() = RgbaImage::copy(tex->width(), tex->height(), static_cast<const Color *>(video.last_frame.data()));
-
-                // update texture
-                render->Update_Texture(tex);
-                render->DrawImage(tex, calculateVideoRectangle(*pMovie_Track));
-                render->Present();
-            }
 
+        while (true) {
             MessageLoopWithWait();
 
-            av_packet_unref(&packet);
+            render->BeginScene2D();
+            if (renderFrame())
+                break;
+            render->Present();
 
-            // exit movie
-            if (!playing) break;
+            waitForNextFrame();
         }
-        // hold for frame length at end of packets
-        std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(video.frame_len)));
-
-        // clean up
-        while (!buffq.empty()) buffq.pop();
-        tex->Release();
-
-        return;
     }
 
+    /**
+     * Sleeps until the next video frame is due for display.
+     */
+    void waitForNextFrame() const {
+        // Capping the wait so that we don't stop processing messages for too long.
+        double wait_ms = std::clamp((_currentPts + 1) * video.frame_len - playback_time, 0.0, 100.0);
+        std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(wait_ms));
+    }
     virtual std::string GetFormat() override {
         return format_ctx->iformat->name;
     }
@@ -603,7 +653,6 @@ class Movie : public IMovie {
             start_time = std::chrono::system_clock::now();
             logger->trace("Video stream reset");
 
-            _lastVideoPts = -1;
             _currentTime = std::chrono::system_clock::now();
             _audioUpdateRate = (30.0f * video.frame_len) / 1000.0f;
         }
@@ -611,35 +660,25 @@ class Movie : public IMovie {
     }
 
     virtual bool renderFrame() override {
-        Blob buffer;
         if (GetFormat() == "bink") {
-            if (av_read_frame(format_ctx, &_binkPacket) >= 0) {
-                int desired_frame_number{};
-                do {
-                    // get playback time - and wait till we need the next frame
-                    _currentTime = std::chrono::system_clock::now();
-                    playback_time = (std::chrono::duration_cast<std::chrono::milliseconds>(_currentTime - start_time)).count();
-                    desired_frame_number = (int)((playback_time / video.frame_len));
-                    std::this_thread::sleep_for(5ms);
-                } while (_lastVideoPts == desired_frame_number);
-
-                // ignore audio packets
-                if (_binkPacket.stream_index == audio.stream_idx) {
-                    // but still render the last frame
-                    if (video.last_frame) {
-                        _renderTexture(video.last_frame);
-                    }
-                    return false;
-                }
+            // Audio was decoded in prepare(), so the decode thread only handles video.
+            if (!_decoder.isStarted())
+                _decoder.start(format_ctx, &video, nullptr, false);
 
-                if (_binkPacket.stream_index == video.stream_idx) {
-                    // check if anymore sound frames still in decoder
-                    buffer = audio.decode_frame(NULL);
+            _currentTime = std::chrono::system_clock::now();
+            playback_time = (std::chrono::duration_cast<std::chrono::milliseconds>(_currentTime - start_time)).count();
+            int desired_frame_number = (int)((playback_time / video.frame_len));
+
+            int popped = 0;
+            if (auto frame = _decoder.popFrames(desired_frame_number, !_currentFrame, &popped)) {
+                // Stream required sound frames, nwc and intro are 15fps vid but need 30fps sound, jvc is 10fps video
+                // but need 30 fps sound. We do this for each frame, including the skipped ones, so that sound stays
+                // in sync.
+                for (int j = 0; j < popped; j++) {
+                    // Check if anymore sound frames still in decoder.
+                    Blob buffer = audio.decode_frame(NULL);
                     if (buffer) _binkBuffer.push(std::move(buffer));
 
-                    // stream required sound frames
-                    // nwc and intro are 15fps vid but need 30fps sound
-                    // jvc is 10fps video but need 30 fps sound
                     for (int i = 0; i < _audioUpdateRate; i++) {
                         if (!_binkBuffer.empty()) {
                             provider->Stream16(audio_data_in_device,
@@ -648,25 +687,21 @@ class Movie : public IMovie {
                             _binkBuffer.pop();
                         }
                     }
-
-                    // Decode video frame and show
-                    _lastVideoPts = _binkPacket.pts;
-                    video.decode_frame(&_binkPacket);
-                    _renderTexture(video.last_frame);
                 }
 
-                av_packet_unref(&_binkPacket);
-
-                // exit movie
-                if (!playing) return true;
-            } else {
-                // hold for frame length at end of packets
-                std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(video.frame_len)));
+                _currentFrame = std::move(frame->pixels);
+                _currentPts = frame->pts;
+            } else if (_decoder.isFinished() && desired_frame_number > _currentPts) {
+                // Hold the last frame for its frame length, then exit.
                 return true;
             }
-        } else {
-            std::this_thread::sleep_for(2ms);
 
+            if (_currentFrame)
+                _renderTexture(_currentFrame);
+
+            // exit movie
+            if (!playing) return true;
+        } else {
             Blob buffer = GetFrame();
             if (!buffer) {
                 return true;
@@ -698,7 +733,6 @@ class Movie : public IMovie {
     OpenALSoundProvider::StreamingTrackBuffer *audio_data_in_device;
 
     AVVideoStream video;
-    int last_resampled_frame_num;
 
     std::chrono::time_point<std::chrono::system_clock> start_time;
     bool looping;
@@ -712,10 +746,14 @@ class Movie : public IMovie {
     AVPacket _binkPacket;
     // Bink decoded audio buffer
     std::queue<Blob> _binkBuffer;
-    int _lastVideoPts = -1;
-    int _desiredFrameNumber;
     std::chrono::system_clock::time_point _currentTime;
     int _audioUpdateRate;
+
+    // Decoding happens in a worker thread, which is started on first use. Note that it must be declared after the
+    // streams so that it's destroyed first.
+    AVDecodeThread _decoder;
+    Blob _currentFrame;
+    int64_t _currentPts = -1;
 };
 
 void MPlayer::Initialize() {
@@ -842,8 +880,6 @@ void MPlayer::PlayFullscreenMovie(std::string_view pFilename) {
             render->ClearBlack();
             render->BeginScene2D();
 
-            std::this_thread::sleep_for(2ms);
-
             Blob buffer = pMovie_Track->GetFrame();
             if (!buffer) {
                 break;
@@ -857,6 +893,8 @@ void MPlayer::PlayFullscreenMovie(std::string_view pFilename) {
             render->DrawImage(tex, calculateVideoRectangle(*pMovie_Track));
 
             render->Present();
+
+            pMovie->waitForNextFrame();
         }
         tex->Release();
     }
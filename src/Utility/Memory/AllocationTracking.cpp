@@ -0,0 +1,151 @@
+#include "AllocationTracking.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+
+#ifdef OE_TRACK_ALLOCATIONS
+#   ifdef _MSC_VER
+#       include <malloc.h> // For _aligned_malloc & _aligned_free.
+#   endif
+
+static thread_local AllocationStats threadStats;
+static thread_local bool threadTrackingSuspended = false; // Set when updating the scope registry.
+
+static void countAllocation(size_t size) noexcept {
+    if (threadTrackingSuspended)
+        return;
+    threadStats.allocations++;
+    threadStats.bytes += size;
+}
+
+static void countDeallocation() noexcept {
+    if (!threadTrackingSuspended)
+        threadStats.deallocations++;
+}
+
+static void *trackedAllocate(size_t size) noexcept {
+    countAllocation(size);
+    return std::malloc(size ? size : 1);
+}
+
+static void *trackedAllocateAligned(size_t size, std::align_val_t alignment) noexcept {
+    countAllocation(size);
+
+    size_t align = static_cast<size_t>(alignment);
+#   ifdef _MSC_VER
+    return _aligned_malloc(size ? size : 1, align);
+#   else
+    return std::aligned_alloc(align, (size + align) / align * align); // Size must be a non-zero multiple of alignment.
+#   endif
+}
+
+static void trackedDeallocate(void *p) noexcept {
+    if (!p)
+        return;
+    countDeallocation();
+    std::free(p);
+}
+
+static void trackedDeallocateAligned(void *p) noexcept {
+    if (!p)
+        return;
+    countDeallocation();
+#   ifdef _MSC_VER
+    _aligned_free(p);
+#   else
+    std::free(p);
+#   endif
+}
+
+static void *checked(void *p) {
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(size_t size) { return checked(trackedAllocate(size)); }
+void *operator new[](size_t size) { return checked(trackedAllocate(size)); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return trackedAllocate(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return trackedAllocate(size); }
+void *operator new(size_t size, std::align_val_t alignment) { return checked(trackedAllocateAligned(size, alignment)); }
+void *operator new[](size_t size, std::align_val_t alignment) { return checked(trackedAllocateAligned(size, alignment)); }
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return trackedAllocateAligned(size, alignment); }
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return trackedAllocateAligned(size, alignment); }
+
+void operator delete(void *p) noexcept { trackedDeallocate(p); }
+void operator delete[](void *p) noexcept { trackedDeallocate(p); }
+void operator delete(void *p, size_t) noexcept { trackedDeallocate(p); }
+void operator delete[](void *p, size_t) noexcept { trackedDeallocate(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { trackedDeallocate(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { trackedDeallocate(p); }
+void operator delete(void *p, std::align_val_t) noexcept { trackedDeallocateAligned(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { trackedDeallocateAligned(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { trackedDeallocateAligned(p); }
+void operator delete[](void *p, size_t, std::align_val_t) noexcept { trackedDeallocateAligned(p); }
+void operator delete(void *p, std::align_val_t, const std::nothrow_t &) noexcept { trackedDeallocateAligned(p); }
+void operator delete[](void *p, std::align_val_t, const std::nothrow_t &) noexcept { trackedDeallocateAligned(p); }
+
+AllocationStats threadAllocationStats() {
+    return threadStats;
+}
+
+class SuspendedTrackingScope {
+ public:
+    SuspendedTrackingScope() : _oldValue(threadTrackingSuspended) {
+        threadTrackingSuspended = true;
+    }
+
+    ~SuspendedTrackingScope() {
+        threadTrackingSuspended = _oldValue;
+    }
+
+ private:
+    bool _oldValue;
+};
+#else
+AllocationStats threadAllocationStats() {
+    return {};
+}
+
+class SuspendedTrackingScope {
+ public:
+    SuspendedTrackingScope() {} // NOLINT: user-provided so that there are no unused variable warnings.
+};
+#endif
+
+struct AllocationScopeRegistry {
+    std::mutex mutex;
+    std::unordered_map<std::string, AllocationStats> statsByName;
+};
+
+static AllocationScopeRegistry &scopeRegistry() {
+    static AllocationScopeRegistry registry;
+    return registry;
+}
+
+AllocationStats allocationScopeStats(const std::string &name) {
+    AllocationScopeRegistry &registry = scopeRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto pos = registry.statsByName.find(name);
+    return pos == registry.statsByName.end() ? AllocationStats() : pos->second;
+}
+
+void resetAllocationScopeStats() {
+    SuspendedTrackingScope suspended;
+    AllocationScopeRegistry &registry = scopeRegistry();
+    std::lock_guard lock(registry.mutex);
+    registry.statsByName.clear();
+}
+
+AllocationScope::~AllocationScope() {
+    AllocationStats delta = threadAllocationStats() - _start;
+
+    // Registry bookkeeping shouldn't show up in the enclosing scopes.
+    SuspendedTrackingScope suspended;
+    AllocationScopeRegistry &registry = scopeRegistry();
+    std::lock_guard lock(registry.mutex);
+    registry.statsByName[_name] += delta;
+}
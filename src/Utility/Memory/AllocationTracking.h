@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Utility/Preprocessor.h"
+
+/**
+ * Heap allocation statistics.
+ */
+struct AllocationStats {
+    int64_t allocations = 0; // Number of calls to `operator new`.
+    int64_t deallocations = 0; // Number of calls to `operator delete`.
+    int64_t bytes = 0; // Total number of bytes allocated.
+
+    friend AllocationStats operator+(const AllocationStats &l, const AllocationStats &r) {
+        return {l.allocations + r.allocations, l.deallocations + r.deallocations, l.bytes + r.bytes};
+    }
+
+    friend AllocationStats operator-(const AllocationStats &l, const AllocationStats &r) {
+        return {l.allocations - r.allocations, l.deallocations - r.deallocations, l.bytes - r.bytes};
+    }
+
+    AllocationStats &operator+=(const AllocationStats &other) {
+        return *this = *this + other;
+    }
+
+    friend bool operator==(const AllocationStats &l, const AllocationStats &r) = default;
+};
+
+/**
+ * Allocation tracking is enabled with the `OE_TRACK_ALLOCATIONS` CMake option, which replaces global `operator new`
+ * and `operator delete` with versions that count allocations per thread. When it's disabled, all the functions below
+ * return zeros and `MM_ALLOCATION_SCOPE` compiles into nothing.
+ *
+ * Note that the replacement operators are defined in `AllocationTracking.cpp`, and are linked in only if something in
+ * the binary uses the functions declared in this header.
+ */
+#ifdef OE_TRACK_ALLOCATIONS
+inline constexpr bool ALLOCATION_TRACKING_ENABLED = true;
+#else
+inline constexpr bool ALLOCATION_TRACKING_ENABLED = false;
+#endif
+
+/**
+ * @return                              Allocation stats for the current thread, since thread start. Take a difference
+ *                                      of two values to get the number of allocations between two points in time.
+ */
+AllocationStats threadAllocationStats();
+
+/**
+ * @param name                          Scope name, as passed to `MM_ALLOCATION_SCOPE`.
+ * @return                              Allocation stats accumulated in all scopes with the provided name, summed over
+ *                                      all threads. Nested scopes are inclusive, e.g. allocations in a nested scope
+ *                                      are also counted in the outer one.
+ */
+AllocationStats allocationScopeStats(const std::string &name);
+
+/**
+ * Resets the stats for all allocation scopes.
+ */
+void resetAllocationScopeStats();
+
+/**
+ * Counts allocations made in the current thread during its lifetime, and adds them to the stats for the scope with
+ * the provided name. Use via `MM_ALLOCATION_SCOPE`.
+ */
+class AllocationScope {
+ public:
+    explicit AllocationScope(const char *name) : _name(name), _start(threadAllocationStats()) {}
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope &) = delete;
+    AllocationScope &operator=(const AllocationScope &) = delete;
+
+ private:
+    const char *_name;
+    AllocationStats _start;
+};
+
+/**
+ * Counts allocations until the end of the current block, and adds them to the stats for the scope with the provided
+ * name. Example usage:
+ * ```
+ * void ProcessPartyCollisionsODM(...) {
+ *     MM_ALLOCATION_SCOPE("collisions");
+ *     ...
+ * }
+ * ```
+ *
+ * Then `allocationScopeStats("collisions")` can be used to check the number of allocations.
+ *
+ * @param name                          Scope name, must be a string literal.
+ */
+#ifdef OE_TRACK_ALLOCATIONS
+#   define MM_ALLOCATION_SCOPE(name) AllocationScope MM_PP_CAT(allocationScope, __LINE__)(name)
+#else
+#   define MM_ALLOCATION_SCOPE(name) ((void) 0)
+#endif
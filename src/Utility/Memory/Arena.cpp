@@ -0,0 +1,66 @@
+#include "Arena.h"
+
+#include <cassert>
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+static constexpr size_t FRAME_ARENA_CAPACITY = 4 * 1024 * 1024;
+static constexpr size_t SCRATCH_ARENA_CAPACITY = 256 * 1024;
+
+Arena::Arena(size_t capacity) : _capacity(capacity) {}
+
+Arena::~Arena() = default;
+
+void Arena::reset() {
+    _offset = 0;
+    _stats = ArenaStats();
+}
+
+void Arena::rewind(size_t position) {
+    assert(position <= _offset);
+    _offset = position;
+    _stats.bytesUsed = _offset;
+}
+
+void *Arena::do_allocate(size_t bytes, size_t alignment) {
+    _stats.allocations++;
+
+    if (!_buffer)
+        _buffer = std::make_unique_for_overwrite<std::byte[]>(_capacity);
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(_buffer.get());
+    uintptr_t start = (base + _offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t size = std::max<size_t>(bytes, 1); // So that the returned pointer always points inside the buffer.
+    if (start + size <= base + _capacity) {
+        _offset = start + size - base;
+        _stats.bytesUsed = _offset;
+        return reinterpret_cast<void *>(start);
+    }
+
+    _stats.overflows++;
+    return ::operator new(bytes, std::align_val_t(alignment));
+}
+
+void Arena::do_deallocate(void *p, size_t bytes, size_t alignment) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(_buffer.get());
+    uintptr_t pos = reinterpret_cast<uintptr_t>(p);
+    if (_buffer && pos >= base && pos < base + _capacity)
+        return; // Arena memory is released in reset() & rewind().
+
+    ::operator delete(p, bytes, std::align_val_t(alignment));
+}
+
+bool Arena::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+
+Arena &frameArena() {
+    static Arena arena(FRAME_ARENA_CAPACITY);
+    return arena;
+}
+
+Arena &scratchArena() {
+    thread_local Arena arena(SCRATCH_ARENA_CAPACITY);
+    return arena;
+}
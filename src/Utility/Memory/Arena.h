@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+/**
+ * Allocation statistics of an `Arena`, counted since the last reset.
+ */
+struct ArenaStats {
+    size_t allocations = 0; // Total number of allocations.
+    size_t overflows = 0; // Number of allocations that didn't fit into the arena and went to the heap.
+    size_t bytesUsed = 0; // Number of bytes used in the arena's buffer, including alignment padding.
+};
+
+/**
+ * Fixed-capacity bump allocator.
+ *
+ * Allocations are served from a single preallocated buffer by bumping an offset, and deallocations are no-ops.
+ * Memory is reclaimed all at once with `reset`. Once the buffer is exhausted, allocations fall through to the heap,
+ * and these are freed normally when deallocated.
+ *
+ * This class is a `std::pmr::memory_resource`, so it can be plugged into `std::pmr` containers:
+ * ```
+ * std::pmr::vector<int> ids(&frameArena());
+ * ```
+ *
+ * All the memory allocated from the arena must be released before the arena is reset.
+ */
+class Arena : public std::pmr::memory_resource {
+ public:
+    /**
+     * @param capacity                  Size of the arena's buffer, in bytes. Buffer is allocated lazily, on first
+     *                                  allocation.
+     */
+    explicit Arena(size_t capacity);
+    virtual ~Arena();
+
+    /**
+     * Releases all the memory allocated from the arena & resets statistics.
+     */
+    void reset();
+
+    /**
+     * @return                          Current position in the arena's buffer. Can later be passed to `rewind`.
+     */
+    [[nodiscard]] size_t position() const {
+        return _offset;
+    }
+
+    /**
+     * Releases all the memory allocated from the arena after the provided position. Statistics are not affected.
+     *
+     * @param position                  Position previously returned by `position`.
+     */
+    void rewind(size_t position);
+
+    [[nodiscard]] size_t capacity() const {
+        return _capacity;
+    }
+
+    [[nodiscard]] const ArenaStats &stats() const {
+        return _stats;
+    }
+
+ protected:
+    virtual void *do_allocate(size_t bytes, size_t alignment) override;
+    virtual void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+    virtual bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+ private:
+    std::unique_ptr<std::byte[]> _buffer;
+    size_t _capacity = 0;
+    size_t _offset = 0;
+    ArenaStats _stats;
+};
+
+/**
+ * Rewinds the arena to its current position when going out of scope. Handy for scratch allocations in functions
+ * that might be called in a loop:
+ * ```
+ * ArenaScope scope(scratchArena());
+ * std::pmr::string path(&scratchArena());
+ * ```
+ */
+class ArenaScope {
+ public:
+    explicit ArenaScope(Arena &arena) : _arena(arena), _position(arena.position()) {}
+
+    ~ArenaScope() {
+        _arena.rewind(_position);
+    }
+
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+
+ private:
+    Arena &_arena;
+    size_t _position;
+};
+
+/**
+ * @return                              Arena for per-frame scratch data. It's reset by the engine at the end of each
+ *                                      frame, so nothing allocated from it can outlive the current frame. Can only
+ *                                      be used from the main thread.
+ */
+Arena &frameArena();
+
+/**
+ * @return                              Scratch arena for the current thread. It's never reset, so users are
+ *                                      expected to wrap their allocations in an `ArenaScope`.
+ */
+Arena &scratchArena();
@@ -62,7 +62,7 @@ Blob Blob::fromFile(std::string_view path) {
     result._data = mmap->data();
     result._size = mmap->size();
     result._state = std::move(mmap);
-    result._displayPath = std::move(pathString);
+    result._displayPath = std::make_shared<const std::string>(std::move(pathString));
     return result;
 }
 
@@ -151,5 +151,33 @@ Blob Blob::share(const Blob &other) {
     result._size = other._size;
     result._state = other._state;
     result._displayPath = other._displayPath;
+    result._displayName = other._displayName;
     return result;
 }
+
+std::string Blob::displayPath() const {
+    std::string result = _displayPath ? *_displayPath : std::string();
+    if (!_displayName.empty()) {
+        result += '/';
+        result += _displayName;
+    }
+    return result;
+}
+
+Blob Blob::withDisplayPath(std::string_view displayPath) {
+    _displayPath = std::make_shared<const std::string>(displayPath);
+    _displayName.clear();
+    return std::move(*this);
+}
+
+Blob Blob::withDisplayPath(const Blob &parent, std::string_view name) {
+    _displayPath = parent._displayPath;
+    if (parent._displayName.empty()) {
+        _displayName = name;
+    } else {
+        _displayName = parent._displayName;
+        _displayName += '/';
+        _displayName += name;
+    }
+    return std::move(*this);
+}
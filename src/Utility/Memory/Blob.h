@@ -140,6 +140,7 @@ class Blob final {
         swap(l._size, r._size);
         swap(l._state, r._state);
         swap(l._displayPath, r._displayPath);
+        swap(l._displayName, r._displayName);
     }
 
     [[nodiscard]] size_t size() const {
@@ -166,18 +167,25 @@ class Blob final {
         return {static_cast<const char *>(_data), _size};
     }
 
-    [[nodiscard]] const std::string &displayPath() const {
-        return _displayPath;
-    }
+    [[nodiscard]] std::string displayPath() const;
 
-    Blob withDisplayPath(std::string_view displayPath) {
-        _displayPath = displayPath;
-        return std::move(*this);
-    }
+    Blob withDisplayPath(std::string_view displayPath);
+
+    /**
+     * Same as `withDisplayPath(parent.displayPath() + "/" + name)`, but the full path is only built when it's
+     * requested. Parent's display path is shared, and short names fit into `std::string`'s inline buffer, so this
+     * doesn't allocate. Use it for blobs that are cut out of an archive on a hot path, like `LodReader::read` does.
+     *
+     * @param parent                    Blob to take the display path prefix from.
+     * @param name                      Name to append to the parent's display path.
+     * @return                          This blob, with display path set.
+     */
+    Blob withDisplayPath(const Blob &parent, std::string_view name);
 
  private:
     const void *_data = nullptr;
     size_t _size = 0;
     std::shared_ptr<void> _state;
-    std::string _displayPath;
+    std::shared_ptr<const std::string> _displayPath;
+    std::string _displayName; // Appended to `_displayPath` with a slash if not empty.
 };
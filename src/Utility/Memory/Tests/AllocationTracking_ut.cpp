@@ -0,0 +1,71 @@
+#include <memory>
+#include <thread>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Memory/AllocationTracking.h"
+
+// Compilers are allowed to elide new/delete pairs, so we're passing the pointers through a volatile.
+static void *volatile sink = nullptr;
+
+static void allocateAndFree(size_t size) {
+    sink = new char[size];
+    delete[] static_cast<char *>(sink);
+}
+
+UNIT_TEST(AllocationTracking, ThreadStats) {
+    AllocationStats start = threadAllocationStats();
+    allocateAndFree(100);
+    allocateAndFree(200);
+    AllocationStats delta = threadAllocationStats() - start;
+
+    if (ALLOCATION_TRACKING_ENABLED) {
+        EXPECT_EQ(delta, AllocationStats(2, 2, 300));
+    } else {
+        EXPECT_EQ(delta, AllocationStats());
+    }
+}
+
+UNIT_TEST(AllocationTracking, OtherThreadsNotCounted) {
+    AllocationStats start = threadAllocationStats();
+    AllocationStats threadDelta;
+    std::thread thread([&] {
+        AllocationStats threadStart = threadAllocationStats();
+        allocateAndFree(10);
+        threadDelta = threadAllocationStats() - threadStart;
+    });
+    AllocationStats delta = threadAllocationStats() - start; // Thread creation might allocate, so we stop here.
+    thread.join();
+
+    if (ALLOCATION_TRACKING_ENABLED) {
+        EXPECT_EQ(threadDelta, AllocationStats(1, 1, 10));
+        EXPECT_LE(delta.bytes, 1024); // Whatever std::thread allocated, but not our 10 bytes.
+    } else {
+        EXPECT_EQ(threadDelta, AllocationStats());
+    }
+}
+
+UNIT_TEST(AllocationTracking, Scopes) {
+    resetAllocationScopeStats();
+
+    for (int i = 0; i < 3; i++) {
+        MM_ALLOCATION_SCOPE("outer");
+        allocateAndFree(1);
+        {
+            MM_ALLOCATION_SCOPE("inner");
+            allocateAndFree(2);
+        }
+    }
+
+    if (ALLOCATION_TRACKING_ENABLED) {
+        EXPECT_EQ(allocationScopeStats("outer"), AllocationStats(6, 6, 9));
+        EXPECT_EQ(allocationScopeStats("inner"), AllocationStats(3, 3, 6));
+    } else {
+        EXPECT_EQ(allocationScopeStats("outer"), AllocationStats());
+        EXPECT_EQ(allocationScopeStats("inner"), AllocationStats());
+    }
+    EXPECT_EQ(allocationScopeStats("unknown"), AllocationStats());
+
+    resetAllocationScopeStats();
+    EXPECT_EQ(allocationScopeStats("outer"), AllocationStats());
+}
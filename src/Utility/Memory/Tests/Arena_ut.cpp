@@ -0,0 +1,71 @@
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Memory/Arena.h"
+
+UNIT_TEST(Arena, Basic) {
+    Arena arena(1024);
+    {
+        std::pmr::vector<int> v(&arena);
+        for (int i = 0; i < 10; i++)
+            v.push_back(i);
+        EXPECT_EQ(v[9], 9);
+    }
+
+    EXPECT_GT(arena.stats().allocations, 0);
+    EXPECT_EQ(arena.stats().overflows, 0);
+    EXPECT_GT(arena.stats().bytesUsed, 10 * sizeof(int));
+
+    arena.reset();
+    EXPECT_EQ(arena.stats().allocations, 0);
+    EXPECT_EQ(arena.stats().bytesUsed, 0);
+    EXPECT_EQ(arena.position(), 0);
+}
+
+UNIT_TEST(Arena, Alignment) {
+    Arena arena(1024);
+    for (size_t alignment : {1, 2, 4, 8, 16, 64}) {
+        void *p = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignment, 0);
+        arena.deallocate(p, 3, alignment);
+    }
+    EXPECT_EQ(arena.stats().overflows, 0);
+}
+
+UNIT_TEST(Arena, Overflow) {
+    Arena arena(64);
+    void *a = arena.allocate(48, 8);
+    void *b = arena.allocate(48, 8); // Doesn't fit, goes to the heap.
+    EXPECT_NE(a, b);
+    EXPECT_EQ(arena.stats().allocations, 2);
+    EXPECT_EQ(arena.stats().overflows, 1);
+    EXPECT_EQ(arena.stats().bytesUsed, 48);
+    arena.deallocate(b, 48, 8);
+    arena.deallocate(a, 48, 8);
+
+    // Zero-size allocations at the end of the buffer are fine too.
+    void *c = arena.allocate(16, 1);
+    void *d = arena.allocate(0, 1);
+    arena.deallocate(d, 0, 1);
+    arena.deallocate(c, 16, 1);
+}
+
+UNIT_TEST(Arena, Scope) {
+    Arena arena(1024);
+    (void) arena.allocate(10, 1);
+    size_t position = arena.position();
+    {
+        ArenaScope scope(arena);
+        std::pmr::string s("a string that doesn't fit into the small string buffer", &arena);
+        EXPECT_GT(arena.position(), position);
+    }
+    EXPECT_EQ(arena.position(), position);
+}
+
+UNIT_TEST(Arena, Global) {
+    EXPECT_EQ(&frameArena(), &frameArena());
+    EXPECT_EQ(&scratchArena(), &scratchArena());
+    EXPECT_NE(static_cast<void *>(&frameArena()), static_cast<void *>(&scratchArena()));
+}
@@ -56,6 +56,18 @@ UNIT_TEST(Blob, DisplayPathCopyShare) {
     EXPECT_EQ(Blob::share(blob).displayPath(), "1.bin");
 }
 
+UNIT_TEST(Blob, DisplayPathFromParent) {
+    Blob parent = Blob::fromString("12345").withDisplayPath("1.lod");
+    Blob child = parent.subBlob(1, 2).withDisplayPath(parent, "a.bin");
+    Blob grandChild = child.subBlob(1, 1).withDisplayPath(child, "b.bin");
+
+    EXPECT_EQ(child.displayPath(), "1.lod/a.bin");
+    EXPECT_EQ(grandChild.displayPath(), "1.lod/a.bin/b.bin");
+    EXPECT_EQ(Blob::copy(grandChild).displayPath(), "1.lod/a.bin/b.bin");
+    EXPECT_EQ(Blob::share(grandChild).displayPath(), "1.lod/a.bin/b.bin");
+    EXPECT_EQ(Blob::share(grandChild).withDisplayPath("2.bin").displayPath(), "2.bin");
+}
+
 UNIT_TEST(Blob, DisplayPathFromFile) {
     ScopedTestFile tmp("1.bin", "123");
 
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cassert>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * Bounded lock-free multi-producer single-consumer queue.
+ *
+ * This is a ring buffer of preallocated slots, each slot carrying a sequence number that tells producers and the
+ * consumer whether the slot is free or filled. Producers claim slots with a CAS on the tail position, the consumer
+ * owns the head position. Neither pushing nor popping allocates, and values are moved in and out of the slots, so
+ * the slots effectively work as a pool of `T` objects.
+ *
+ * `tryPush` can be called from any number of threads concurrently. `tryPop` and `empty` must only be called from a
+ * single consumer thread.
+ */
+template<class T>
+class MpscQueue {
+ public:
+    /**
+     * @param capacity                  Maximal number of elements in the queue, must be a power of two.
+     */
+    explicit MpscQueue(size_t capacity) : _cells(std::make_unique<Cell[]>(capacity)), _mask(capacity - 1) {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+
+        for (size_t i = 0; i < capacity; i++)
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    [[nodiscard]] size_t capacity() const {
+        return _mask + 1;
+    }
+
+    /**
+     * @param value                     Value to push. It is moved from only if this function returns `true`.
+     * @return                          Whether the value was pushed, `false` if the queue is full.
+     */
+    template<class U>
+    [[nodiscard]] bool tryPush(U &&value) {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true) {
+            cell = &_cells[pos & _mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            ptrdiff_t diff = static_cast<ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false; // Slot still holds a value from the previous lap, so the queue is full.
+            } else {
+                pos = _tail.load(std::memory_order_relaxed); // Another producer took this slot.
+            }
+        }
+
+        cell->value = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @param[out] value                Target to move the popped value into.
+     * @return                          Whether a value was popped, `false` if the queue is empty.
+     */
+    [[nodiscard]] bool tryPop(T *value) {
+        Cell &cell = _cells[_head & _mask];
+        if (cell.sequence.load(std::memory_order_acquire) != _head + 1)
+            return false;
+
+        *value = std::move(cell.value);
+        cell.value = T(); // Don't keep moved-from resources alive in the slot.
+        cell.sequence.store(_head + capacity(), std::memory_order_release);
+        _head++;
+        return true;
+    }
+
+    /**
+     * @return                          Whether the queue is empty. Note that a push that's in flight in another
+     *                                  thread is not visible until it completes.
+     */
+    [[nodiscard]] bool empty() const {
+        return _cells[_head & _mask].sequence.load(std::memory_order_acquire) != _head + 1;
+    }
+
+ private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask;
+    alignas(64) std::atomic<size_t> _tail = 0; // Written by producers.
+    alignas(64) size_t _head = 0; // Owned by the consumer.
+};
@@ -0,0 +1,150 @@
+#include "Process.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#include "Utility/Exception.h"
+
+#ifdef _WINDOWS
+#   define WIN32_LEAN_AND_MEAN
+#   include <Windows.h>
+
+#   include "Utility/Win/Unicode.h"
+#else
+#   include <fcntl.h>
+#   include <spawn.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+
+extern char **environ;
+#endif
+
+std::string quoteWindowsArgument(std::string_view arg) {
+    if (!arg.empty() && arg.find_first_of(" \t\n\v\"") == std::string_view::npos)
+        return std::string(arg);
+
+    // Backslashes are only special when followed by a quote, and then they have to be doubled. This includes the
+    // closing quote that we're adding at the end.
+    std::string result = "\"";
+    size_t backslashes = 0;
+    for (char c : arg) {
+        if (c == '\\') {
+            backslashes++;
+            continue;
+        }
+
+        if (c == '"') {
+            result.append(backslashes * 2 + 1, '\\');
+        } else {
+            result.append(backslashes, '\\');
+        }
+        result += c;
+        backslashes = 0;
+    }
+    result.append(backslashes * 2, '\\');
+    result += '"';
+    return result;
+}
+
+#ifdef _WINDOWS
+bool runProcess(const std::vector<std::string> &commandLine, std::string *output) {
+    assert(!commandLine.empty());
+
+    std::string command;
+    for (const std::string &arg : commandLine) {
+        if (!command.empty())
+            command += ' ';
+        command += quoteWindowsArgument(arg);
+    }
+    std::wstring wcommand = win::toUtf16(command); // CreateProcessW needs a mutable buffer.
+
+    SECURITY_ATTRIBUTES attributes = {};
+    attributes.nLength = sizeof(attributes);
+    attributes.bInheritHandle = TRUE;
+
+    HANDLE readPipe, writePipe;
+    if (!CreatePipe(&readPipe, &writePipe, &attributes, 0))
+        throw Exception("Could not create a pipe for process '{}'", commandLine[0]);
+    SetHandleInformation(readPipe, HANDLE_FLAG_INHERIT, 0);
+
+    STARTUPINFOW startupInfo = {};
+    startupInfo.cb = sizeof(startupInfo);
+    startupInfo.dwFlags = STARTF_USESTDHANDLES;
+    startupInfo.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+    startupInfo.hStdOutput = writePipe;
+    startupInfo.hStdError = writePipe;
+
+    PROCESS_INFORMATION processInfo = {};
+    BOOL started = CreateProcessW(nullptr, wcommand.data(), nullptr, nullptr, TRUE, 0, nullptr, nullptr,
+                                  &startupInfo, &processInfo);
+    CloseHandle(writePipe); // Otherwise ReadFile won't return once the child exits.
+    if (!started) {
+        CloseHandle(readPipe);
+        throw Exception("Could not start process '{}'", commandLine[0]);
+    }
+
+    char buffer[4096];
+    DWORD size = 0;
+    while (ReadFile(readPipe, buffer, sizeof(buffer), &size, nullptr) && size > 0)
+        output->append(buffer, size);
+    CloseHandle(readPipe);
+
+    DWORD exitCode = 1;
+    WaitForSingleObject(processInfo.hProcess, INFINITE);
+    GetExitCodeProcess(processInfo.hProcess, &exitCode);
+    CloseHandle(processInfo.hProcess);
+    CloseHandle(processInfo.hThread);
+    return exitCode == 0;
+}
+#else
+bool runProcess(const std::vector<std::string> &commandLine, std::string *output) {
+    assert(!commandLine.empty());
+
+    std::vector<char *> argv;
+    for (const std::string &arg : commandLine)
+        argv.push_back(const_cast<char *>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    int pipeFds[2];
+    if (pipe(pipeFds) != 0)
+        Exception::throwFromErrno(commandLine[0]);
+
+    // Don't leak the pipe into processes spawned concurrently from other threads, the read below would then block
+    // until these exit too. There's no pipe2 on macOS, so the race is still there, just a lot less likely.
+    fcntl(pipeFds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(pipeFds[1], F_SETFD, FD_CLOEXEC);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, pipeFds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, pipeFds[1], STDERR_FILENO);
+
+    pid_t pid;
+    int error = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(pipeFds[1]); // Otherwise read won't return once the child exits.
+    if (error != 0) {
+        close(pipeFds[0]);
+        throw Exception("Could not start process '{}': {}", commandLine[0], std::strerror(error));
+    }
+
+    char buffer[4096];
+    while (true) {
+        ssize_t size = read(pipeFds[0], buffer, sizeof(buffer));
+        if (size < 0 && errno == EINTR)
+            continue;
+        if (size <= 0)
+            break;
+        output->append(buffer, size);
+    }
+    close(pipeFds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR)
+            Exception::throwFromErrno(commandLine[0]);
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Quotes a single command line argument so that `CommandLineToArgvW` & MSVC CRT parse it back as-is. Arguments that
+ * don't need quoting are returned unchanged.
+ *
+ * @param arg                           Argument to quote.
+ * @return                              Quoted argument.
+ */
+std::string quoteWindowsArgument(std::string_view arg);
+
+/**
+ * Runs a child process and waits for it to finish. No shell is involved, so arguments are passed to the child
+ * process as-is.
+ *
+ * @param commandLine                   Command line of the process to run, first element is the path to the
+ *                                      executable. `PATH` is searched if it doesn't contain a directory.
+ * @param[out] output                   Combined stdout & stderr of the child process.
+ * @return                              Whether the process has exited successfully.
+ * @throws Exception                    If the process couldn't be started.
+ */
+bool runProcess(const std::vector<std::string> &commandLine, std::string *output);
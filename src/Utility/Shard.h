@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+/**
+ * Splits the provided items into `count` contiguous parts whose sizes differ by at most one, and returns one of them.
+ * Concatenating all the parts in order gives back the original items.
+ *
+ * @param items                         Items to split.
+ * @param index                         Index of the part to return, in `[0, count)`.
+ * @param count                         Total number of parts.
+ * @return                              Part of `items` at `index`.
+ */
+template<class T>
+std::span<T> shard(std::span<T> items, int index, int count) {
+    assert(count > 0 && index >= 0 && index < count);
+
+    size_t begin = items.size() * index / count;
+    size_t end = items.size() * (index + 1) / count;
+    return items.subspan(begin, end - begin);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+/**
+ * SIMD instruction set detection. Defines `MM_USE_SSE2` or `MM_USE_NEON` & includes the corresponding intrinsics
+ * header. Code that uses these should always have a scalar fallback for when neither is defined.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define MM_USE_SSE2
+#   include <emmintrin.h>
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#   define MM_USE_NEON
+#   include <arm_neon.h>
+#endif
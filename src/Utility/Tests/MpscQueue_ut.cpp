@@ -0,0 +1,81 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/MpscQueue.h"
+
+UNIT_TEST(MpscQueue, PushPop) {
+    MpscQueue<int> queue(4);
+    EXPECT_EQ(queue.capacity(), 4);
+    EXPECT_TRUE(queue.empty());
+
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(&value));
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++)
+            EXPECT_TRUE(queue.tryPush(round * 10 + i));
+        EXPECT_FALSE(queue.tryPush(100));
+        EXPECT_FALSE(queue.empty());
+
+        for (int i = 0; i < 4; i++) {
+            EXPECT_TRUE(queue.tryPop(&value));
+            EXPECT_EQ(value, round * 10 + i);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+UNIT_TEST(MpscQueue, MoveOnly) {
+    MpscQueue<std::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(2)));
+
+    std::unique_ptr<int> extra = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.tryPush(std::move(extra)));
+    EXPECT_NE(extra, nullptr); // Failed push doesn't consume the value.
+
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(queue.tryPop(&value));
+    EXPECT_EQ(*value, 1);
+    EXPECT_TRUE(queue.tryPop(&value));
+    EXPECT_EQ(*value, 2);
+    EXPECT_FALSE(queue.tryPop(&value));
+}
+
+UNIT_TEST(MpscQueue, MultipleProducers) {
+    constexpr int producerCount = 4;
+    constexpr int valuesPerProducer = 20000;
+
+    MpscQueue<int> queue(64);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; p++) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < valuesPerProducer; i++)
+                while (!queue.tryPush(p * valuesPerProducer + i))
+                    std::this_thread::yield();
+        });
+    }
+
+    // Values from each producer must arrive in order, and nothing should get lost.
+    std::vector<int> nextValues(producerCount, 0);
+    int received = 0;
+    while (received < producerCount * valuesPerProducer) {
+        int value;
+        if (!queue.tryPop(&value)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        int producer = value / valuesPerProducer;
+        EXPECT_EQ(value % valuesPerProducer, nextValues[producer]);
+        nextValues[producer]++;
+        received++;
+    }
+
+    for (std::thread &producer : producers)
+        producer.join();
+    EXPECT_TRUE(queue.empty());
+}
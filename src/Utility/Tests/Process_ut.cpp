@@ -0,0 +1,88 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Exception.h"
+#include "Utility/Process.h"
+
+/**
+ * Parses a command line the way `CommandLineToArgvW` parses everything after the executable name.
+ */
+static std::vector<std::string> parseWindowsCommandLine(std::string_view commandLine) {
+    std::vector<std::string> result;
+    size_t i = 0;
+    while (true) {
+        while (i < commandLine.size() && (commandLine[i] == ' ' || commandLine[i] == '\t'))
+            i++;
+        if (i == commandLine.size())
+            return result;
+
+        std::string arg;
+        bool quoted = false;
+        while (i < commandLine.size() && (quoted || (commandLine[i] != ' ' && commandLine[i] != '\t'))) {
+            size_t backslashes = 0;
+            while (i < commandLine.size() && commandLine[i] == '\\') {
+                backslashes++;
+                i++;
+            }
+
+            if (i < commandLine.size() && commandLine[i] == '"') {
+                arg.append(backslashes / 2, '\\');
+                if (backslashes % 2 == 1) {
+                    arg += '"';
+                } else {
+                    quoted = !quoted;
+                }
+                i++;
+            } else {
+                arg.append(backslashes, '\\');
+                if (i < commandLine.size() && (quoted || (commandLine[i] != ' ' && commandLine[i] != '\t')))
+                    arg += commandLine[i++];
+            }
+        }
+        result.push_back(std::move(arg));
+    }
+}
+
+UNIT_TEST(Process, QuoteWindowsArgument) {
+    EXPECT_EQ(quoteWindowsArgument("abc"), "abc");
+    EXPECT_EQ(quoteWindowsArgument("C:\\a\\b"), "C:\\a\\b");
+    EXPECT_EQ(quoteWindowsArgument(""), "\"\"");
+    EXPECT_EQ(quoteWindowsArgument("a b"), "\"a b\"");
+    EXPECT_EQ(quoteWindowsArgument("a\"b"), "\"a\\\"b\"");
+    EXPECT_EQ(quoteWindowsArgument("C:\\a b\\"), "\"C:\\a b\\\\\"");
+    EXPECT_EQ(quoteWindowsArgument("a\\\"b"), "\"a\\\\\\\"b\"");
+}
+
+UNIT_TEST(Process, QuoteWindowsArgumentRoundTrip) {
+    std::vector<std::string> args = {
+        "", " ", "abc", "a b", "\"", "\"\"", "\\", "\\\\", "a\\", "a b\\", "a b\\\\", "\\\"", "a\\\\\"b c", "\"a b\"",
+        "C:\\Program Files\\OpenEnroth\\", "tab\there", "--shard-index", "it's", "\\\\server\\share\\a b"
+    };
+
+    std::string commandLine;
+    for (const std::string &arg : args)
+        commandLine += quoteWindowsArgument(arg) + " ";
+    EXPECT_EQ(parseWindowsCommandLine(commandLine), args);
+}
+
+UNIT_TEST(Process, MissingExecutable) {
+    std::string output;
+    EXPECT_THROW(runProcess({"__oe_no_such_executable__"}, &output), Exception);
+}
+
+#ifndef _WINDOWS
+UNIT_TEST(Process, Run) {
+    std::string output;
+    EXPECT_TRUE(runProcess({"sh", "-c", "exit 0"}, &output));
+    EXPECT_EQ(output, "");
+
+    // Arguments are passed as-is, and stderr goes into the output too.
+    output.clear();
+    EXPECT_FALSE(runProcess({"sh", "-c", "printf '%s|' \"$@\"; echo err >&2; exit 3", "sh", "a b", "c'd", "e\"f", ""},
+                            &output));
+    EXPECT_EQ(output, "a b|c'd|e\"f||err\n");
+}
+#endif
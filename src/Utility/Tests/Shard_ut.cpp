@@ -0,0 +1,44 @@
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Shard.h"
+
+UNIT_TEST(Shard, Partition) {
+    for (int size : {0, 1, 2, 7, 10, 64, 101}) {
+        std::vector<int> items(size);
+        std::iota(items.begin(), items.end(), 0);
+
+        for (int count : {1, 2, 3, 8, 16, 200}) {
+            std::vector<int> joined;
+            for (int index = 0; index < count; index++) {
+                std::span<int> part = shard(std::span<int>(items), index, count);
+
+                // Parts are balanced.
+                EXPECT_GE(part.size(), size / count);
+                EXPECT_LE(part.size(), size / count + 1);
+
+                joined.insert(joined.end(), part.begin(), part.end());
+            }
+
+            // Concatenating the parts gives back all the items, each exactly once & in order.
+            EXPECT_EQ(joined, items);
+        }
+    }
+}
+
+UNIT_TEST(Shard, Values) {
+    std::vector<int> items = {0, 1, 2, 3, 4, 5, 6};
+    auto part = [&](int index, int count) {
+        std::span<int> result = shard(std::span<int>(items), index, count);
+        return std::vector<int>(result.begin(), result.end());
+    };
+
+    EXPECT_EQ(part(0, 3), std::vector<int>({0, 1}));
+    EXPECT_EQ(part(1, 3), std::vector<int>({2, 3}));
+    EXPECT_EQ(part(2, 3), std::vector<int>({4, 5, 6}));
+    EXPECT_EQ(part(0, 10), std::vector<int>());
+    EXPECT_EQ(part(9, 10), std::vector<int>({6}));
+}
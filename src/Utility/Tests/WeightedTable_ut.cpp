@@ -0,0 +1,60 @@
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/WeightedTable.h"
+
+UNIT_TEST(WeightedTable, Empty) {
+    WeightedTable<int> table;
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.totalWeight(), 0);
+    EXPECT_EQ(table.find(1), nullptr);
+
+    table.add(1, 0);
+    EXPECT_TRUE(table.empty());
+}
+
+UNIT_TEST(WeightedTable, Find) {
+    WeightedTable<char> table;
+    table.add('a', 2);
+    table.add('b', 0);
+    table.add('c', 1);
+    table.add('d', 3);
+    EXPECT_EQ(table.size(), 3);
+    EXPECT_EQ(table.totalWeight(), 6);
+
+    EXPECT_EQ(*table.find(1), 'a');
+    EXPECT_EQ(*table.find(2), 'a');
+    EXPECT_EQ(*table.find(3), 'c');
+    EXPECT_EQ(*table.find(4), 'd');
+    EXPECT_EQ(*table.find(6), 'd');
+    EXPECT_EQ(table.find(7), nullptr);
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.find(1), nullptr);
+}
+
+// Checks that lookups match a linear scan over the weights, which is what the table replaces.
+UNIT_TEST(WeightedTable, MatchesLinearScan) {
+    std::vector<int> weights = {0, 5, 0, 0, 1, 7, 0, 3, 3, 0};
+
+    WeightedTable<int> table;
+    for (size_t i = 0; i < weights.size(); i++)
+        table.add(i, weights[i]);
+
+    for (int weight = 1; weight <= table.totalWeight(); weight++) {
+        int sum = 0;
+        int expected = -1;
+        for (size_t i = 0; i < weights.size(); i++) {
+            sum += weights[i];
+            if (sum >= weight) {
+                expected = i;
+                break;
+            }
+        }
+
+        ASSERT_NE(table.find(weight), nullptr);
+        EXPECT_EQ(*table.find(weight), expected);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cassert>
+#include <algorithm>
+#include <vector>
+
+/**
+ * Cumulative weight table for weighted random sampling.
+ *
+ * Values are stored in the order they were added, so looking up weight `w` returns the first value for which
+ * the sum of weights of all values up to and including it is not less than `w`. This is exactly what a linear scan
+ * over a list of weights does, but takes `O(log(n))` and doesn't allocate.
+ *
+ * Values with zero weights are never returned, and thus are not stored.
+ */
+template<class T>
+class WeightedTable {
+ public:
+    void clear() {
+        _values.clear();
+        _cumulativeWeights.clear();
+    }
+
+    /**
+     * @param value                     Value to add.
+     * @param weight                    Non-negative weight of the value. Zero weights are ignored.
+     */
+    void add(const T &value, int weight) {
+        assert(weight >= 0);
+        if (weight == 0)
+            return;
+
+        _values.push_back(value);
+        _cumulativeWeights.push_back(totalWeight() + weight);
+    }
+
+    /**
+     * @return                          Sum of the weights of all values in this table.
+     */
+    [[nodiscard]] int totalWeight() const {
+        return _cumulativeWeights.empty() ? 0 : _cumulativeWeights.back();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _values.empty();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _values.size();
+    }
+
+    /**
+     * @param weight                    Weight to look up, usually a random number in `[1, totalWeight()]`.
+     * @return                          Pointer to the first value whose cumulative weight is not less than `weight`,
+     *                                  or `nullptr` if `weight` is greater than `totalWeight()`.
+     */
+    [[nodiscard]] const T *find(int weight) const {
+        auto pos = std::lower_bound(_cumulativeWeights.begin(), _cumulativeWeights.end(), weight);
+        if (pos == _cumulativeWeights.end())
+            return nullptr;
+        return &_values[pos - _cumulativeWeights.begin()];
+    }
+
+ private:
+    std::vector<T> _values;
+    std::vector<int> _cumulativeWeights;
+};
@@ -20,6 +20,8 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Utility/Memory/AllocationTracking.h"
+
 static bool characterHasJar(int charIndex, int jarIndex) {
     for (const ItemGen &item : pParty->pCharacters[charIndex].pInventoryItemList)
         if (item.uItemID == ITEM_QUEST_LICH_JAR_FULL && item.uHolderPlayer == jarIndex)
@@ -87,6 +89,21 @@ GAME_TEST(Issues, Issue1051) {
     EXPECT_EQ(frameTimeTape, tape(15)); // Don't redo this at different FPS, the problem won't reproduce.
 }
 
+GAME_TEST(Issues, Issue1051Allocations) {
+    // Same trace as above, lots of Magogs bumping into each other & into the party. Collision code reuses its scratch
+    // buffers, so it should only allocate when these grow.
+    if (!ALLOCATION_TRACKING_ENABLED)
+        GTEST_SKIP();
+
+    auto collisionsTape = tapes.scopeAllocations("collisions");
+    test.playTraceFromTestData("issue_1051.mm7", "issue_1051.json");
+    // Worst case is the first frame, when the 13 actor mirror arrays grow to fit all the actors on the map - that's
+    // ~10 reallocations each for a few hundred actors. Allocating per actor or per collision attempt would instead
+    // show up in every frame, including the last one.
+    EXPECT_LE(collisionsTape.max(), 150);
+    EXPECT_EQ(collisionsTape.back(), 0);
+}
+
 GAME_TEST(Issues, Issue1068) {
     // Kills assert if characters don't have learning skill, but party has an npc that gives learning boost.
     auto expTape = charTapes.experiences();
@@ -624,8 +641,7 @@ GAME_TEST(Prs, Pr1440) {
 
 GAME_TEST(Issues, Issue1447A) {
     // Fire bolt doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle &par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return static_cast<int>(engine->particle_engine->pParticles.size()); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447A.mm7", "issue_1447A.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -634,8 +650,7 @@ GAME_TEST(Issues, Issue1447A) {
 
 GAME_TEST(Issues, Issue1447B) {
     // Fireball doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle& par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return static_cast<int>(engine->particle_engine->pParticles.size()); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447B.mm7", "issue_1447B.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -644,8 +659,7 @@ GAME_TEST(Issues, Issue1447B) {
 
 GAME_TEST(Issues, Issue1447C) {
     // Acid blast doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle& par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return static_cast<int>(engine->particle_engine->pParticles.size()); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447C.mm7", "issue_1447C.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -0,0 +1,100 @@
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Snapshots/CompositeSnapshots.h"
+#include "Engine/LOD.h"
+#include "Engine/MapInfo.h"
+
+#include "Library/Binary/BlobSerialization.h"
+#include "Library/Lod/LodReader.h"
+#include "Library/LodFormats/LodFormats.h"
+
+#include "Utility/ScopeGuard.h"
+
+// Tests that check level data from the shipped maps, as opposed to the trace-based regression tests in GameTests_NNNN.
+
+static int countFacePolygonMismatches(const BLVFace &face, int modelIdx, std::span<const Vec3f> vertices) {
+    BLVFace flatFace = face;
+    flatFace.index = -1; // This one is flattened on each Contains call.
+
+    std::vector<Vec3f> points;
+    Vec3f centroid(0, 0, 0);
+    for (int i = 0; i < face.uNumVertices; i++) {
+        const Vec3f &vertex = vertices[face.pVertexIDs[i]];
+        const Vec3f &next = vertices[face.pVertexIDs[(i + 1) % face.uNumVertices]];
+        points.push_back(vertex);
+        points.push_back((vertex + next) / 2);
+        points.push_back(vertex + Vec3f(2, 2, 2));
+        points.push_back(vertex - Vec3f(2, 2, 2));
+        centroid += vertex;
+    }
+    if (face.uNumVertices > 0)
+        points.push_back(centroid / static_cast<float>(face.uNumVertices));
+
+    int result = 0;
+    for (const Vec3f &point : points)
+        for (FaceAttributes plane : {FaceAttributes(), FaceAttributes(FACE_XY_PLANE)})
+            for (int slack : {0, 3})
+                result += face.Contains(point, modelIdx, slack, plane) != flatFace.Contains(point, modelIdx, slack, plane);
+    return result;
+}
+
+GAME_TEST(Levels, FacePolygons) {
+    // Pre-flattened face polygons should give exactly the same results as flattening faces on the fly, for all the
+    // faces in all the shipped maps.
+    IndoorLocation indoor;
+    OutdoorLocation outdoor;
+    IndoorLocation *oldIndoor = pIndoor;
+    OutdoorLocation *oldOutdoor = pOutdoor;
+    MM_AT_SCOPE_EXIT(pIndoor = oldIndoor; pOutdoor = oldOutdoor);
+    pIndoor = &indoor;
+    pOutdoor = &outdoor;
+
+    int numMaps = 0;
+    for (MapId map : pMapStats->pInfos.indices()) {
+        const std::string &fileName = pMapStats->pInfos[map].fileName;
+        if (fileName.empty() || !pGames_LOD->exists(fileName))
+            continue;
+        numMaps++;
+
+        int mismatches = 0;
+        if (fileName.ends_with(".blv")) {
+            IndoorLocation_MM7 location;
+            deserialize(lod::decodeCompressed(pGames_LOD->read(fileName)), &location);
+            reconstruct(location, &indoor);
+            indoor.buildFacePolygons(); // No doors loaded, so all faces are pre-flattened.
+
+            for (const BLVFace &face : indoor.pFaces)
+                mismatches += countFacePolygonMismatches(face, MODEL_INDOOR, indoor.pVertices);
+        } else {
+            OutdoorLocation_MM7 location;
+            deserialize(lod::decodeCompressed(pGames_LOD->read(fileName)), &location);
+
+            outdoor.pBModels.clear();
+            for (size_t i = 0; i < location.models.size(); i++) {
+                BSPModel &model = outdoor.pBModels.emplace_back();
+                model.index = i;
+                reconstruct(std::forward_as_tuple(location.models[i], location.modelExtras[i]), &model);
+                model.buildFacePolygons();
+            }
+
+            for (BSPModel &model : outdoor.pBModels) {
+                for (ODMFace &odmFace : model.pFaces) {
+                    BLVFace face;
+                    face.FromODM(&odmFace);
+                    mismatches += countFacePolygonMismatches(face, model.index, model.pVertices);
+                }
+            }
+        }
+
+        EXPECT_EQ(mismatches, 0) << fileName;
+    }
+
+    EXPECT_GT(numMaps, 60);
+}
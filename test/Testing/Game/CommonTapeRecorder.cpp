@@ -1,6 +1,7 @@
 #include "CommonTapeRecorder.h"
 
 #include <cassert>
+#include <optional>
 #include <ranges>
 #include <string>
 
@@ -165,3 +166,22 @@ TestMultiTape<std::string> CommonTapeRecorder::allGUIWindowsText() {
 TestMultiTape<SpecialAttackType> CommonTapeRecorder::specialAttacks() {
     return _controller->recordFunctionTape<SpecialAttackType>(CALL_SPECIAL_ATTACK);
 }
+
+TestTape<int64_t> CommonTapeRecorder::allocations() {
+    // Tapes are created on the control thread, so we can only take the first snapshot on the first tick.
+    return custom([last = std::optional<AllocationStats>()] mutable {
+        AllocationStats current = threadAllocationStats();
+        int64_t result = last ? current.allocations - last->allocations : 0;
+        last = current;
+        return result;
+    });
+}
+
+TestTape<int64_t> CommonTapeRecorder::scopeAllocations(const std::string &name) {
+    return custom([name, last = std::optional<AllocationStats>()] mutable {
+        AllocationStats current = allocationScopeStats(name);
+        int64_t result = last ? current.allocations - last->allocations : 0;
+        last = current;
+        return result;
+    });
+}
@@ -18,6 +18,8 @@
 
 #include "Library/Config/ConfigEntry.h"
 
+#include "Utility/Memory/AllocationTracking.h"
+
 #include "TestController.h"
 
 class CommonTapeRecorder {
@@ -114,6 +116,31 @@ class CommonTapeRecorder {
      */
     TestMultiTape<SpecialAttackType> specialAttacks();
 
+    /**
+     * Return a tape object of per-frame heap allocation counts on the game thread. Only works if the
+     * `OE_TRACK_ALLOCATIONS` CMake option is enabled, otherwise all the values are zero.
+     *
+     * The counts also include the allocations made by the tape recorders themselves, so expect some noise. Typical use
+     * is to check that a steady-state frame doesn't allocate much:
+     * ```
+     * if (!ALLOCATION_TRACKING_ENABLED)
+     *     GTEST_SKIP();
+     * auto allocationsTape = tapes.allocations();
+     * test.playTraceFromTestData(...);
+     * EXPECT_LE(allocationsTape.max(), 100);
+     * ```
+     *
+     * @return                          Tape object.
+     */
+    TestTape<int64_t> allocations();
+
+    /**
+     * @param name                      Allocation scope name, as passed to `MM_ALLOCATION_SCOPE`.
+     * @return                          Tape object of per-frame heap allocation counts inside the scope with the
+     *                                  provided name, summed over all threads.
+     */
+    TestTape<int64_t> scopeAllocations(const std::string &name);
+
  private:
     TestController *_controller = nullptr;
 };
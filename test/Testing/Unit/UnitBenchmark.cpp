@@ -0,0 +1,7 @@
+#include "UnitBenchmark.h"
+
+#include <fmt/core.h>
+
+void reportBenchmark(std::string_view name, double nsPerItem, std::string_view item) {
+    fmt::print("[ BENCHMARK] {}: {:.3f} ns/{}\n", name, nsPerItem, item);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include "UnitTest.h"
+
+/**
+ * Defines a benchmark. Benchmarks are unit tests that are disabled by default, run them with
+ * `--gtest_also_run_disabled_tests --gtest_filter=*.DISABLED_*`.
+ *
+ * Benchmarks should still check their results against a reference implementation - there's no point in timing code
+ * that's broken.
+ */
+#define UNIT_BENCHMARK(SuiteName, TestName) \
+    UNIT_TEST(SuiteName, DISABLED_##TestName)
+
+/**
+ * @param itemCount                     Number of items processed by a single `callable` invocation.
+ * @param iterations                    Number of times to invoke `callable`.
+ * @param callable                      Code to time.
+ * @return                              Average time spent per item, in nanoseconds.
+ */
+template<class Callable>
+double benchmarkNsPerItem(size_t itemCount, int iterations, Callable &&callable) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        callable();
+    auto time = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(time).count() / (static_cast<double>(itemCount) * iterations);
+}
+
+/**
+ * Prints out a benchmark result in a uniform format, e.g. `[ BENCHMARK] pcx::decode: 1.234 ns/pixel`.
+ *
+ * @param name                          Name of the code that was timed.
+ * @param nsPerItem                     Time per item, as returned from `benchmarkNsPerItem`.
+ * @param item                          Name of a single item, e.g. `"pixel"`.
+ */
+void reportBenchmark(std::string_view name, double nsPerItem, std::string_view item);